@@ -380,6 +380,12 @@ public class PlatformCache extends PlatformAbstractTarget {
     /** */
     public static final int OP_PERSISTENCE_ENABLED = 99;
 
+    /** */
+    public static final int OP_LOC_PART_ITERATOR = 100;
+
+    /** */
+    public static final int OP_BATCH = 101;
+
     /** Underlying JCache in binary mode. */
     private final IgniteCacheProxy cache;
 
@@ -994,6 +1000,96 @@ public class PlatformCache extends PlatformAbstractTarget {
         return args;
     }
 
+    /** {@inheritDoc} */
+    @Override public void processInStreamOutStream(int type, BinaryRawReaderEx reader, BinaryRawWriterEx writer)
+        throws IgniteCheckedException {
+        switch (type) {
+            case OP_BATCH:
+                processBatch(reader, writer);
+
+                break;
+
+            default:
+                super.processInStreamOutStream(type, reader, writer);
+        }
+    }
+
+    /**
+     * Executes a batch of independent single-key operations in one platform call.
+     * Operations are executed in order and stop at the first failure. The count of executed
+     * operations is followed by their results and the error of the failed operation, if any.
+     *
+     * @param reader Reader.
+     * @param writer Writer.
+     */
+    private void processBatch(BinaryRawReaderEx reader, BinaryRawWriterEx writer) {
+        int cnt = reader.readInt();
+
+        int doneCntPos = writer.reserveInt();
+
+        int done = 0;
+
+        Exception err = null;
+
+        try {
+            for (; done < cnt; done++) {
+                int op = reader.readInt();
+
+                switch (op) {
+                    case OP_PUT:
+                        cache.put(reader.readObjectDetached(), reader.readObjectDetached());
+
+                        break;
+
+                    case OP_PUT_IF_ABSENT: {
+                        boolean res = cache.putIfAbsent(reader.readObjectDetached(), reader.readObjectDetached());
+
+                        writer.writeBoolean(res);
+
+                        break;
+                    }
+
+                    case OP_GET: {
+                        Object res = cache.get(reader.readObjectDetached());
+
+                        writer.writeObjectDetached(res);
+
+                        break;
+                    }
+
+                    case OP_CONTAINS_KEY: {
+                        boolean res = cache.containsKey(reader.readObjectDetached());
+
+                        writer.writeBoolean(res);
+
+                        break;
+                    }
+
+                    case OP_REMOVE_OBJ: {
+                        boolean res = cache.remove(reader.readObjectDetached());
+
+                        writer.writeBoolean(res);
+
+                        break;
+                    }
+
+                    default:
+                        throw new IgniteException("Unsupported batch operation: " + op);
+                }
+            }
+        }
+        catch (Exception e) {
+            err = convertException(e);
+        }
+
+        writer.writeInt(doneCntPos, done);
+
+        writer.writeBoolean(err != null);
+
+        if (err != null)
+            PlatformUtils.writeError(err, writer);
+    }
+
     /** {@inheritDoc} */
     @Override public PlatformTarget processInStreamOutObject(int type, BinaryRawReaderEx reader)
         throws IgniteCheckedException {
@@ -1048,6 +1144,16 @@ public class PlatformCache extends PlatformAbstractTarget {
                 return new PlatformCacheIterator(platformCtx, iter);
             }
 
+            case OP_LOC_PART_ITERATOR: {
+                int part = reader.readInt();
+                int pageSize = reader.readInt();
+
+                ScanQuery qry = new ScanQuery(part).setLocal(true).setPageSize(pageSize);
+
+                // Cursor keeps the partition reserved until it is closed.
+                return new PlatformCacheIterator(platformCtx, cache.query(qry));
+            }
+
             default:
                 return super.processInStreamOutObject(type, reader);
         }
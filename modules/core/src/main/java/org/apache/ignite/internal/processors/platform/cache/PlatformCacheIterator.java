@@ -20,9 +20,12 @@ package org.apache.ignite.internal.processors.platform.cache;
 import java.util.Iterator;
 import javax.cache.Cache;
 import org.apache.ignite.IgniteCheckedException;
+import org.apache.ignite.cache.query.QueryCursor;
+import org.apache.ignite.internal.binary.BinaryRawReaderEx;
 import org.apache.ignite.internal.binary.BinaryRawWriterEx;
 import org.apache.ignite.internal.processors.platform.PlatformAbstractTarget;
 import org.apache.ignite.internal.processors.platform.PlatformContext;
+import org.jetbrains.annotations.Nullable;
 
 /**
  * Interop cache iterator.
@@ -31,9 +34,18 @@ public class PlatformCacheIterator extends PlatformAbstractTarget {
     /** Operation: next entry. */
     private static final int OP_NEXT = 1;
 
+    /** Operation: next batch of entries. */
+    private static final int OP_NEXT_BATCH = 2;
+
+    /** Operation: close iterator. */
+    private static final int OP_CLOSE = 3;
+
     /** Iterator. */
     private final Iterator<Cache.Entry> iter;
 
+    /** Cursor the iterator is obtained from. */
+    @Nullable private final QueryCursor<Cache.Entry> cursor;
+
     /**
      * Constructor.
      *
@@ -44,6 +56,34 @@ public class PlatformCacheIterator extends PlatformAbstractTarget {
         super(platformCtx);
 
         this.iter = iter;
+
+        cursor = null;
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param platformCtx Context.
+     * @param cursor Cursor. Closed together with the iterator.
+     */
+    public PlatformCacheIterator(PlatformContext platformCtx, QueryCursor<Cache.Entry> cursor) {
+        super(platformCtx);
+
+        this.cursor = cursor;
+
+        iter = cursor.iterator();
+    }
+
+    /** {@inheritDoc} */
+    @Override public long processInLongOutLong(int type, long val) throws IgniteCheckedException {
+        if (type == OP_CLOSE) {
+            if (cursor != null)
+                cursor.close();
+
+            return TRUE;
+        }
+
+        return super.processInLongOutLong(type, val);
     }
 
     /** {@inheritDoc} */
@@ -69,4 +109,36 @@ public class PlatformCacheIterator extends PlatformAbstractTarget {
                 super.processOutStream(type, writer);
         }
     }
+
+    /** {@inheritDoc} */
+    @Override public void processInStreamOutStream(int type, BinaryRawReaderEx reader, BinaryRawWriterEx writer)
+        throws IgniteCheckedException {
+        switch (type) {
+            case OP_NEXT_BATCH: {
+                int batchSize = reader.readInt();
+
+                int cntPos = writer.reserveInt();
+
+                int cnt = 0;
+
+                while (cnt < batchSize && iter.hasNext()) {
+                    Cache.Entry e = iter.next();
+
+                    assert e != null;
+
+                    writer.writeObjectDetached(e.getKey());
+                    writer.writeObjectDetached(e.getValue());
+
+                    cnt++;
+                }
+
+                writer.writeInt(cntPos, cnt);
+
+                break;
+            }
+
+            default:
+                super.processInStreamOutStream(type, reader, writer);
+        }
+    }
 }
@@ -25,8 +25,11 @@
 
 #include <ignite/binary/binary_consts.h>
 #include <ignite/binary/binary_containers.h>
+#include <ignite/binary/binary_fields.h>
 #include <ignite/binary/binary_type.h>
+#include <ignite/binary/binary_view.h>
 #include <ignite/binary/binary_object.h>
+#include <ignite/binary/binary_object_builder.h>
 #include <ignite/binary/binary_raw_reader.h>
 #include <ignite/binary/binary_raw_writer.h>
 #include <ignite/binary/binary_reader.h>
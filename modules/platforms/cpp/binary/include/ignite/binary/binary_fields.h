@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares macros generating BinaryType Write() and Read() functions
+ * from the list of the type fields.
+ */
+
+#ifndef _IGNITE_BINARY_BINARY_FIELDS
+#define _IGNITE_BINARY_BINARY_FIELDS
+
+#include <ignite/binary/binary_type.h>
+#include <ignite/impl/binary/binary_field_visitors.h>
+
+/**
+ * @def IGNITE_BINARY_FIELDS_START(T)
+ * Start the list of fields of the binary type. Generates Write() and
+ * Read() functions which write and read the listed fields in the order
+ * they are listed. Should be used between IGNITE_BINARY_TYPE_START and
+ * IGNITE_BINARY_TYPE_END or within other BinaryType specialization:
+ * @code
+ * IGNITE_BINARY_TYPE_START(Person)
+ *     ...
+ *     IGNITE_BINARY_FIELDS_START(Person)
+ *         IGNITE_BINARY_FIELD(name)
+ *         IGNITE_BINARY_FIELD(age)
+ *     IGNITE_BINARY_FIELDS_END
+ * IGNITE_BINARY_TYPE_END
+ * @endcode
+ *
+ * Field IDs are resolved with GetFieldId() on the first use and cached.
+ */
+#define IGNITE_BINARY_FIELDS_START(T) \
+static void Write(ignite::binary::BinaryWriter& writer, const T& obj) \
+{ \
+    ignite::impl::binary::BinaryFieldWriter visitor(writer); \
+    VisitFields(visitor, obj); \
+} \
+\
+static void Read(ignite::binary::BinaryReader& reader, T& dst) \
+{ \
+    ignite::impl::binary::BinaryFieldReader visitor(reader); \
+    VisitFields(visitor, dst); \
+} \
+\
+IGNITE_BINARY_FIELDS_VISIT_START
+
+/**
+ * @def IGNITE_BINARY_RAW_FIELDS_START(T)
+ * Start the list of fields of the binary type written in raw mode.
+ * Same as IGNITE_BINARY_FIELDS_START, but the object has no schema and its
+ * fields can not be accessed by name, so the fields must not be reordered.
+ */
+#define IGNITE_BINARY_RAW_FIELDS_START(T) \
+static void Write(ignite::binary::BinaryWriter& writer, const T& obj) \
+{ \
+    ignite::binary::BinaryRawWriter rawWriter = writer.RawWriter(); \
+    ignite::impl::binary::BinaryRawFieldWriter visitor(rawWriter); \
+    VisitFields(visitor, obj); \
+} \
+\
+static void Read(ignite::binary::BinaryReader& reader, T& dst) \
+{ \
+    ignite::binary::BinaryRawReader rawReader = reader.RawReader(); \
+    ignite::impl::binary::BinaryRawFieldReader visitor(rawReader); \
+    VisitFields(visitor, dst); \
+} \
+\
+IGNITE_BINARY_FIELDS_VISIT_START
+
+/**
+ * @def IGNITE_BINARY_FIELDS_VISIT_START
+ * Start the function visiting the fields. Used internally.
+ */
+#define IGNITE_BINARY_FIELDS_VISIT_START \
+template<typename V, typename O> \
+static void VisitFields(V& visitor, O& obj) \
+{
+
+/**
+ * @def IGNITE_BINARY_FIELD(member)
+ * Declare field named as the member.
+ */
+#define IGNITE_BINARY_FIELD(member) \
+IGNITE_BINARY_FIELD_AS(member, #member)
+
+/**
+ * @def IGNITE_BINARY_FIELD_AS(member, name)
+ * Declare field with the given name.
+ *
+ * Field ID is cached in a zero-initialized static, as initialization of
+ * a local static object is not thread-safe on older compilers. Threads
+ * racing on the first call store the same value.
+ */
+#define IGNITE_BINARY_FIELD_AS(member, name) \
+{ \
+    static int32_t fieldId = 0; \
+    if (!fieldId) \
+        fieldId = GetFieldId(name); \
+    visitor.Field(ignite::binary::BinaryFieldId(name, fieldId), obj.member); \
+}
+
+/**
+ * @def IGNITE_BINARY_FIELDS_END
+ * End the list of fields of the binary type.
+ */
+#define IGNITE_BINARY_FIELDS_END \
+}
+
+#endif //_IGNITE_BINARY_BINARY_FIELDS
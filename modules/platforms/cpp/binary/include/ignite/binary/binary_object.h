@@ -39,6 +39,8 @@ namespace ignite
 
     namespace binary
     {
+        class BinaryObjectBuilder;
+
         /**
          * Binary object.
          *
@@ -48,6 +50,7 @@ namespace ignite
         class IGNITE_IMPORT_EXPORT BinaryObject
         {
             friend class ignite::impl::binary::BinaryWriterImpl;
+            friend class BinaryObjectBuilder;
         public:
             /// @cond INTERNAL
             /**
@@ -120,6 +123,9 @@ namespace ignite
              * @throw IgniteError if the there is no specified field or if it
              *     is not of the specified type.
              *
+             * BinaryStringView and BinaryInt8ArrayView can be used to get
+             * string and byte array values without copying them.
+             *
              * @param name Field name.
              * @return Field value.
              */
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::binary::BinaryObjectBuilder class.
+ */
+
+#ifndef _IGNITE_BINARY_BINARY_OBJECT_BUILDER
+#define _IGNITE_BINARY_BINARY_OBJECT_BUILDER
+
+#include <ignite/binary/binary_object.h>
+#include <ignite/impl/binary/binary_object_builder_impl.h>
+
+namespace ignite
+{
+    namespace binary
+    {
+        /**
+         * Binary object builder.
+         *
+         * Allows to change, add and remove fields of the binary object
+         * without deserializing it. Fields which have not been changed are
+         * copied to the new object as is.
+         */
+        class IGNITE_IMPORT_EXPORT BinaryObjectBuilder
+        {
+        public:
+            /**
+             * Constructor.
+             * @throw IgniteError if the object has compact footer.
+             *
+             * @param obj Original object. Its memory should stay valid
+             *     until the object is built.
+             */
+            explicit BinaryObjectBuilder(const BinaryObject& obj) :
+                impl(obj.impl)
+            {
+                // No-op.
+            }
+
+            /**
+             * Set field value. Field is added if the original object does
+             * not have it.
+             *
+             * @param name Field name.
+             * @param val Value.
+             * @return *this.
+             */
+            template<typename T>
+            BinaryObjectBuilder& SetField(const char* name, const T& val)
+            {
+                impl.SetField<T>(name, val);
+
+                return *this;
+            }
+
+            /**
+             * Remove field.
+             *
+             * @param name Field name.
+             * @return *this.
+             */
+            BinaryObjectBuilder& RemoveField(const char* name)
+            {
+                impl.RemoveField(name);
+
+                return *this;
+            }
+
+            /**
+             * Build object.
+             * @throw IgniteError if the memory is the memory of the original
+             *     object.
+             *
+             * @warning Handles nested in the unchanged field values are
+             *     copied as is. They stay valid only if no field between the
+             *     handle and the referred object is changed or removed.
+             *
+             * @param mem Memory to write the object to. Its contents are
+             *     replaced.
+             * @return Built object.
+             */
+            BinaryObject Build(impl::interop::InteropMemory& mem)
+            {
+                return BinaryObject(impl.Build(mem));
+            }
+
+        private:
+            IGNITE_NO_COPY_ASSIGNMENT(BinaryObjectBuilder);
+
+            /** Implementation. */
+            impl::binary::BinaryObjectBuilderImpl impl;
+        };
+    }
+}
+
+#endif //_IGNITE_BINARY_BINARY_OBJECT_BUILDER
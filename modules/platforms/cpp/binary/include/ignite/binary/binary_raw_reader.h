@@ -32,6 +32,7 @@
 #include "ignite/binary/binary_consts.h"
 #include "ignite/binary/binary_containers.h"
 #include "ignite/binary/binary_enum_entry.h"
+#include "ignite/binary/binary_view.h"
 #include "ignite/guid.h"
 #include "ignite/date.h"
 #include "ignite/timestamp.h"
@@ -85,6 +86,14 @@ namespace ignite
              */
             int32_t ReadInt8Array(int8_t* res, int32_t len);
 
+            /**
+             * Read array of 8-byte signed integers without copying it. Maps to "byte[]" type in Java.
+             *
+             * @return View of the array. Valid while the memory the object is
+             *     read from is alive. Null if the array in stream was null.
+             */
+            BinaryInt8ArrayView ReadInt8ArrayView();
+
             /**
              * Read bool. Maps to "boolean" type in Java.
              *
@@ -307,6 +316,14 @@ namespace ignite
              */
             int32_t ReadString(char* res, int32_t len);
 
+            /**
+             * Read string without copying it.
+             *
+             * @return View of the string. Valid while the memory the object is
+             *     read from is alive. Null if the string in stream was null.
+             */
+            BinaryStringView ReadStringView();
+
             /**
              * Read string from the stream.
              *
@@ -72,6 +72,15 @@ namespace ignite
              */
             int8_t ReadInt8(const char* fieldName);
 
+            /**
+             * Read 8-byte signed integer. Maps to "byte" type in Java.
+             *
+             * @param field Field.
+             * @param field Field.
+             * @return Result.
+             */
+            int8_t ReadInt8(const BinaryFieldId& field);
+
             /**
              * Read array of 8-byte signed integers. Maps to "byte[]" type in Java.
              *
@@ -85,6 +94,24 @@ namespace ignite
              */
             int32_t ReadInt8Array(const char* fieldName, int8_t* res, int32_t len);
 
+            /**
+             * Read array of 8-byte signed integers without copying it. Maps to "byte[]" type in Java.
+             *
+             * @param fieldName Field name.
+             * @return View of the array. Valid while the memory the object is
+             *     read from is alive. Null if the field is not found or null.
+             */
+            BinaryInt8ArrayView ReadInt8ArrayView(const char* fieldName);
+
+            /**
+             * Read array of 8-byte signed integers without copying it. Maps to "byte[]" type in Java.
+             *
+             * @param field Field.
+             * @return View of the array. Valid while the memory the object is
+             *     read from is alive. Null if the field is not found or null.
+             */
+            BinaryInt8ArrayView ReadInt8ArrayView(const BinaryFieldId& field);
+
             /**
              * Read bool. Maps to "short" type in Java.
              *
@@ -93,6 +120,14 @@ namespace ignite
              */
             bool ReadBool(const char* fieldName);
 
+            /**
+             * Read bool. Maps to "short" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            bool ReadBool(const BinaryFieldId& field);
+
             /**
              * Read array of bools. Maps to "bool[]" type in Java.
              *
@@ -114,6 +149,14 @@ namespace ignite
              */
             int16_t ReadInt16(const char* fieldName);
 
+            /**
+             * Read 16-byte signed integer. Maps to "short" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            int16_t ReadInt16(const BinaryFieldId& field);
+
             /**
              * Read array of 16-byte signed integers. Maps to "short[]" type in Java.
              *
@@ -135,6 +178,14 @@ namespace ignite
              */
             uint16_t ReadUInt16(const char* fieldName);
 
+            /**
+             * Read 16-byte unsigned integer. Maps to "char" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            uint16_t ReadUInt16(const BinaryFieldId& field);
+
             /**
              * Read array of 16-byte unsigned integers. Maps to "char[]" type in Java.
              *
@@ -156,6 +207,14 @@ namespace ignite
              */
             int32_t ReadInt32(const char* fieldName);
 
+            /**
+             * Read 32-byte signed integer. Maps to "int" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            int32_t ReadInt32(const BinaryFieldId& field);
+
             /**
              * Read array of 32-byte signed integers. Maps to "int[]" type in Java.
              *
@@ -177,6 +236,14 @@ namespace ignite
              */
             int64_t ReadInt64(const char* fieldName);
 
+            /**
+             * Read 64-byte signed integer. Maps to "long" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            int64_t ReadInt64(const BinaryFieldId& field);
+
             /**
              * Read array of 64-byte signed integers. Maps to "long[]" type in Java.
              *
@@ -198,6 +265,14 @@ namespace ignite
              */
             float ReadFloat(const char* fieldName);
 
+            /**
+             * Read float. Maps to "float" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            float ReadFloat(const BinaryFieldId& field);
+
             /**
              * Read array of floats. Maps to "float[]" type in Java.
              * 
@@ -219,6 +294,14 @@ namespace ignite
              */
             double ReadDouble(const char* fieldName);
 
+            /**
+             * Read double. Maps to "double" type in Java.
+             *
+             * @param field Field.
+             * @return Result.
+             */
+            double ReadDouble(const BinaryFieldId& field);
+
             /**
              * Read array of doubles. Maps to "double[]" type in Java.
              *
@@ -352,6 +435,39 @@ namespace ignite
                     return std::string();
             }
 
+            /**
+             * Read string from the stream.
+             *
+             * @param field Field.
+             * @return String. Empty if the field is not found or null.
+             */
+            std::string ReadString(const BinaryFieldId& field)
+            {
+                std::string res;
+
+                impl->ReadString(field, res);
+
+                return res;
+            }
+
+            /**
+             * Read string without copying it.
+             *
+             * @param fieldName Field name.
+             * @return View of the string. Valid while the memory the object is
+             *     read from is alive. Null if the field is not found or null.
+             */
+            BinaryStringView ReadStringView(const char* fieldName);
+
+            /**
+             * Read string without copying it.
+             *
+             * @param field Field.
+             * @return View of the string. Valid while the memory the object is
+             *     read from is alive. Null if the field is not found or null.
+             */
+            BinaryStringView ReadStringView(const BinaryFieldId& field);
+
             /**
              * Start string array read.
              *
@@ -481,6 +597,20 @@ namespace ignite
                 return impl->ReadObject<T>(fieldName);
             }
 
+            /**
+             * Read object.
+             *
+             * @param field Field.
+             * @return Object.
+             *
+             * @trapam T Object type. BinaryType class template should be specialized for the type.
+             */
+            template<typename T>
+            T ReadObject(const BinaryFieldId& field)
+            {
+                return impl->ReadObject<T>(field);
+            }
+
             /**
              * Read enum value.
              *
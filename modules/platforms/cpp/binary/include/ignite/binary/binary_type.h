@@ -142,8 +142,91 @@ namespace ignite
          */
         IGNITE_IMPORT_EXPORT int32_t GetBinaryStringHashCode(const char* val);
 
+        /**
+         * Field name with the precomputed field ID.
+         *
+         * Writer and reader methods taking the field ID do not resolve the ID
+         * on every call, so the instance is supposed to be created once per
+         * field, e.g. as a namespace-scope constant:
+         * @code
+         * const ignite::binary::BinaryFieldId FIELD_NAME("name");
+         *
+         * writer.WriteString(FIELD_NAME, obj.name);
+         * @endcode
+         *
+         * The ID should be the same as the one returned by
+         * BinaryType::GetFieldId() for the field.
+         */
+        class BinaryFieldId
+        {
+        public:
+            /**
+             * Constructor. Field ID is computed as a hash code of the name,
+             * which matches the default BinaryType::GetFieldId().
+             *
+             * @param name Field name. Should outlive the instance.
+             */
+            explicit BinaryFieldId(const char* name) :
+                name(name),
+                id(GetBinaryStringHashCode(name))
+            {
+                // No-op.
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param name Field name. Should outlive the instance.
+             * @param id Field ID.
+             */
+            BinaryFieldId(const char* name, int32_t id) :
+                name(name),
+                id(id)
+            {
+                // No-op.
+            }
+
+            /**
+             * Get field name.
+             *
+             * @return Field name.
+             */
+            const char* GetName() const
+            {
+                return name;
+            }
+
+            /**
+             * Get field ID.
+             *
+             * @return Field ID.
+             */
+            int32_t GetId() const
+            {
+                return id;
+            }
+
+        private:
+            /** Field name. */
+            const char* name;
+
+            /** Field ID. */
+            int32_t id;
+        };
+
         /**
          * Binary type structure. Defines a set of functions required for type to be serialized and deserialized.
+         *
+         * Optional static function bool IsDeduplicated() returning true enables
+         * deduplication of the type: once the object is written within the
+         * top-level object, identical objects written after it are replaced
+         * with the handles. Java reads them as references to the same instance.
+         *
+         * @warning Deduplication compares content, while Java and .NET only
+         *     write handles for the same instance. Objects containing
+         *     deduplicated types may therefore have different bytes and hash
+         *     code than the same objects written by other platforms. Do not
+         *     use deduplicated types within cache keys or affinity keys.
          */
         template<typename T>
         struct IGNITE_IMPORT_EXPORT BinaryType { };
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::binary::BinaryView class template.
+ */
+
+#ifndef _IGNITE_BINARY_BINARY_VIEW
+#define _IGNITE_BINARY_BINARY_VIEW
+
+#include <stdint.h>
+
+namespace ignite
+{
+    namespace binary
+    {
+        /**
+         * View of the string or array value in the serialized data.
+         *
+         * The view does not own the data: it points directly to the memory
+         * the value has been read from, so the value is not copied. The view
+         * is only valid while that memory is alive and is not modified.
+         */
+        template<typename T>
+        class BinaryView
+        {
+        public:
+            /**
+             * Default constructor. Constructs null view.
+             */
+            BinaryView() :
+                data(0),
+                len(-1)
+            {
+                // No-op.
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param data Data.
+             * @param len Number of elements.
+             */
+            BinaryView(const T* data, int32_t len) :
+                data(data),
+                len(len)
+            {
+                // No-op.
+            }
+
+            /**
+             * Get data. Strings are not zero-terminated.
+             *
+             * @return Data. Null if the view is null.
+             */
+            const T* GetData() const
+            {
+                return data;
+            }
+
+            /**
+             * Get number of elements.
+             *
+             * @return Number of elements or -1 if the view is null.
+             */
+            int32_t GetLength() const
+            {
+                return len;
+            }
+
+            /**
+             * Check whether the view is null.
+             *
+             * @return True if the value was null or the field was not found.
+             */
+            bool IsNull() const
+            {
+                return len < 0;
+            }
+
+        private:
+            /** Data. */
+            const T* data;
+
+            /** Number of elements. */
+            int32_t len;
+        };
+
+        /** View of the string. */
+        typedef BinaryView<char> BinaryStringView;
+
+        /** View of the array of bytes. */
+        typedef BinaryView<int8_t> BinaryInt8ArrayView;
+    }
+}
+
+#endif //_IGNITE_BINARY_BINARY_VIEW
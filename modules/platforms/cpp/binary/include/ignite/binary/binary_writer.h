@@ -68,6 +68,14 @@ namespace ignite
              */
             void WriteInt8(const char* fieldName, int8_t val);
 
+            /**
+             * Write 8-byte signed integer. Maps to "byte" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteInt8(const BinaryFieldId& field, int8_t val);
+
             /**
              * Write array of 8-byte signed integers. Maps to "byte[]" type in Java.
              *
@@ -85,6 +93,14 @@ namespace ignite
              */
             void WriteBool(const char* fieldName, bool val);
 
+            /**
+             * Write bool. Maps to "short" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteBool(const BinaryFieldId& field, bool val);
+
             /**
              * Write array of bools. Maps to "bool[]" type in Java.
              *
@@ -102,6 +118,14 @@ namespace ignite
              */
             void WriteInt16(const char* fieldName, int16_t val);
 
+            /**
+             * Write 16-byte signed integer. Maps to "short" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteInt16(const BinaryFieldId& field, int16_t val);
+
             /**
              * Write array of 16-byte signed integers. Maps to "short[]" type in Java.
              *
@@ -119,6 +143,14 @@ namespace ignite
              */
             void WriteUInt16(const char* fieldName, uint16_t val);
 
+            /**
+             * Write 16-byte unsigned integer. Maps to "char" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteUInt16(const BinaryFieldId& field, uint16_t val);
+
             /**
              * Write array of 16-byte unsigned integers. Maps to "char[]" type in Java.
              *
@@ -136,6 +168,14 @@ namespace ignite
              */
             void WriteInt32(const char* fieldName, int32_t val);
 
+            /**
+             * Write 32-byte signed integer. Maps to "int" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteInt32(const BinaryFieldId& field, int32_t val);
+
             /**
              * Write array of 32-byte signed integers. Maps to "int[]" type in Java.
              *
@@ -153,6 +193,14 @@ namespace ignite
              */
             void WriteInt64(const char* fieldName, int64_t val);
 
+            /**
+             * Write 64-byte signed integer. Maps to "long" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteInt64(const BinaryFieldId& field, int64_t val);
+
             /**
              * Write array of 64-byte signed integers. Maps to "long[]" type in Java.
              *
@@ -170,6 +218,14 @@ namespace ignite
              */
             void WriteFloat(const char* fieldName, float val);
 
+            /**
+             * Write float. Maps to "float" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteFloat(const BinaryFieldId& field, float val);
+
             /**
              * Write array of floats. Maps to "float[]" type in Java.
              *
@@ -187,6 +243,14 @@ namespace ignite
              */
             void WriteDouble(const char* fieldName, double val);
 
+            /**
+             * Write double. Maps to "double" type in Java.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            void WriteDouble(const BinaryFieldId& field, double val);
+
             /**
              * Write array of doubles. Maps to "double[]" type in Java.
              *
@@ -292,6 +356,26 @@ namespace ignite
                 WriteString(fieldName, val.c_str());
             }
 
+            /**
+             * Write string.
+             *
+             * @param field Field.
+             * @param val String.
+             * @param len String length (characters).
+             */
+            void WriteString(const BinaryFieldId& field, const char* val, int32_t len);
+
+            /**
+             * Write string.
+             *
+             * @param field Field.
+             * @param val String.
+             */
+            void WriteString(const BinaryFieldId& field, const std::string& val)
+            {
+                WriteString(field, val.c_str(), static_cast<int32_t>(val.size()));
+            }
+
             /**
              * Start string array write.
              *
@@ -458,6 +542,18 @@ namespace ignite
                 impl->WriteObject<T>(fieldName, val);
             }
 
+            /**
+             * Write object.
+             *
+             * @param field Field.
+             * @param val Value.
+             */
+            template<typename T>
+            void WriteObject(const BinaryFieldId& field, const T& val)
+            {
+                impl->WriteObject<T>(field, val);
+            }
+
             /**
              * Write enum entry.
              *
@@ -0,0 +1,593 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares visitors of the fields declared with IGNITE_BINARY_FIELDS_START.
+ */
+
+#ifndef _IGNITE_IMPL_BINARY_BINARY_FIELD_VISITORS
+#define _IGNITE_IMPL_BINARY_BINARY_FIELD_VISITORS
+
+#include <stdint.h>
+#include <string>
+
+#include <ignite/common/common.h>
+
+#include "ignite/binary/binary_writer.h"
+#include "ignite/binary/binary_reader.h"
+#include "ignite/binary/binary_raw_writer.h"
+#include "ignite/binary/binary_raw_reader.h"
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            /**
+             * Writes the declared fields with their precomputed IDs.
+             */
+            class BinaryFieldWriter
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param writer Writer.
+                 */
+                explicit BinaryFieldWriter(ignite::binary::BinaryWriter& writer) :
+                    writer(writer)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int8_t val)
+                {
+                    writer.WriteInt8(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, bool val)
+                {
+                    writer.WriteBool(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int16_t val)
+                {
+                    writer.WriteInt16(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, uint16_t val)
+                {
+                    writer.WriteUInt16(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int32_t val)
+                {
+                    writer.WriteInt32(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int64_t val)
+                {
+                    writer.WriteInt64(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, float val)
+                {
+                    writer.WriteFloat(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, double val)
+                {
+                    writer.WriteDouble(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, const std::string& val)
+                {
+                    writer.WriteString(field, val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, const Guid& val)
+                {
+                    writer.WriteGuid(field.GetName(), val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, const Date& val)
+                {
+                    writer.WriteDate(field.GetName(), val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, const Timestamp& val)
+                {
+                    writer.WriteTimestamp(field.GetName(), val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, const Time& val)
+                {
+                    writer.WriteTime(field.GetName(), val);
+                }
+
+                /**
+                 * Write field of any other type.
+                 */
+                template<typename T>
+                void Field(const ignite::binary::BinaryFieldId& field, const T& val)
+                {
+                    writer.WriteObject(field, val);
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryFieldWriter);
+
+                /** Writer. */
+                ignite::binary::BinaryWriter& writer;
+            };
+
+            /**
+             * Reads the declared fields by their precomputed IDs.
+             */
+            class BinaryFieldReader
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param reader Reader.
+                 */
+                explicit BinaryFieldReader(ignite::binary::BinaryReader& reader) :
+                    reader(reader)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int8_t& val)
+                {
+                    val = reader.ReadInt8(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, bool& val)
+                {
+                    val = reader.ReadBool(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int16_t& val)
+                {
+                    val = reader.ReadInt16(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, uint16_t& val)
+                {
+                    val = reader.ReadUInt16(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int32_t& val)
+                {
+                    val = reader.ReadInt32(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, int64_t& val)
+                {
+                    val = reader.ReadInt64(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, float& val)
+                {
+                    val = reader.ReadFloat(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, double& val)
+                {
+                    val = reader.ReadDouble(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, std::string& val)
+                {
+                    val = reader.ReadString(field);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, Guid& val)
+                {
+                    val = reader.ReadGuid(field.GetName());
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, Date& val)
+                {
+                    val = reader.ReadDate(field.GetName());
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, Timestamp& val)
+                {
+                    val = reader.ReadTimestamp(field.GetName());
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId& field, Time& val)
+                {
+                    val = reader.ReadTime(field.GetName());
+                }
+
+                /**
+                 * Read field of any other type.
+                 */
+                template<typename T>
+                void Field(const ignite::binary::BinaryFieldId& field, T& val)
+                {
+                    val = reader.ReadObject<T>(field);
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryFieldReader);
+
+                /** Reader. */
+                ignite::binary::BinaryReader& reader;
+            };
+
+            /**
+             * Writes the declared fields in raw mode in the declaration order.
+             */
+            class BinaryRawFieldWriter
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param writer Raw writer.
+                 */
+                explicit BinaryRawFieldWriter(ignite::binary::BinaryRawWriter& writer) :
+                    writer(writer)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int8_t val)
+                {
+                    writer.WriteInt8(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, bool val)
+                {
+                    writer.WriteBool(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int16_t val)
+                {
+                    writer.WriteInt16(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, uint16_t val)
+                {
+                    writer.WriteUInt16(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int32_t val)
+                {
+                    writer.WriteInt32(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int64_t val)
+                {
+                    writer.WriteInt64(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, float val)
+                {
+                    writer.WriteFloat(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, double val)
+                {
+                    writer.WriteDouble(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, const std::string& val)
+                {
+                    writer.WriteString(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, const Guid& val)
+                {
+                    writer.WriteGuid(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, const Date& val)
+                {
+                    writer.WriteDate(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, const Timestamp& val)
+                {
+                    writer.WriteTimestamp(val);
+                }
+
+                /**
+                 * Write field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, const Time& val)
+                {
+                    writer.WriteTime(val);
+                }
+
+                /**
+                 * Write field of any other type.
+                 */
+                template<typename T>
+                void Field(const ignite::binary::BinaryFieldId&, const T& val)
+                {
+                    writer.WriteObject(val);
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryRawFieldWriter);
+
+                /** Raw writer. */
+                ignite::binary::BinaryRawWriter& writer;
+            };
+
+            /**
+             * Reads the declared fields in raw mode in the declaration order.
+             */
+            class BinaryRawFieldReader
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param reader Raw reader.
+                 */
+                explicit BinaryRawFieldReader(ignite::binary::BinaryRawReader& reader) :
+                    reader(reader)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int8_t& val)
+                {
+                    val = reader.ReadInt8();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, bool& val)
+                {
+                    val = reader.ReadBool();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int16_t& val)
+                {
+                    val = reader.ReadInt16();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, uint16_t& val)
+                {
+                    val = reader.ReadUInt16();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int32_t& val)
+                {
+                    val = reader.ReadInt32();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, int64_t& val)
+                {
+                    val = reader.ReadInt64();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, float& val)
+                {
+                    val = reader.ReadFloat();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, double& val)
+                {
+                    val = reader.ReadDouble();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, std::string& val)
+                {
+                    reader.ReadString(val);
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, Guid& val)
+                {
+                    val = reader.ReadGuid();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, Date& val)
+                {
+                    val = reader.ReadDate();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, Timestamp& val)
+                {
+                    val = reader.ReadTimestamp();
+                }
+
+                /**
+                 * Read field.
+                 */
+                void Field(const ignite::binary::BinaryFieldId&, Time& val)
+                {
+                    val = reader.ReadTime();
+                }
+
+                /**
+                 * Read field of any other type.
+                 */
+                template<typename T>
+                void Field(const ignite::binary::BinaryFieldId&, T& val)
+                {
+                    val = reader.ReadObject<T>();
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryRawFieldReader);
+
+                /** Raw reader. */
+                ignite::binary::BinaryRawReader& reader;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_BINARY_BINARY_FIELD_VISITORS
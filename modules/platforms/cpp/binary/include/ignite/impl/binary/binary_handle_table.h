@@ -0,0 +1,85 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_BINARY_BINARY_HANDLE_TABLE
+#define _IGNITE_IMPL_BINARY_BINARY_HANDLE_TABLE
+
+#include <stdint.h>
+#include <map>
+
+#include "ignite/impl/interop/interop_output_stream.h"
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            /**
+             * Objects written within a single top-level object. Used to
+             * replace repeated sub-objects with handles.
+             */
+            class BinaryHandleTable
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                BinaryHandleTable();
+
+                /**
+                 * Get number of handles written so far.
+                 *
+                 * @return Number of handles.
+                 */
+                int32_t GetHandleCount() const
+                {
+                    return handleCnt;
+                }
+
+                /**
+                 * Process the object which has just been written. If identical
+                 * object has already been written, the object is replaced with
+                 * the handle pointing to it. Otherwise the object is remembered.
+                 *
+                 * Handles are relative to their own position, so the objects
+                 * containing handles are neither replaced nor remembered.
+                 *
+                 * @param stream Stream positioned right after the object.
+                 * @param pos Object position.
+                 * @param hash Object hash code.
+                 * @param handleCnt Number of handles before the object has
+                 *     been written.
+                 */
+                void Deduplicate(interop::InteropOutputStream& stream, int32_t pos, int32_t hash,
+                    int32_t handleCnt);
+
+            private:
+                /** Objects keyed by length and hash code. */
+                typedef std::multimap<int64_t, int32_t> ObjectMap;
+
+                /** Positions of the written objects. */
+                ObjectMap objects;
+
+                /** Number of handles. */
+                int32_t handleCnt;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_BINARY_BINARY_HANDLE_TABLE
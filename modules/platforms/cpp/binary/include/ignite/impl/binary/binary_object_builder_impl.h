@@ -0,0 +1,227 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::binary::BinaryObjectBuilderImpl class.
+ */
+
+#ifndef _IGNITE_IMPL_BINARY_BINARY_OBJECT_BUILDER_IMPL
+#define _IGNITE_IMPL_BINARY_BINARY_OBJECT_BUILDER_IMPL
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <ignite/common/common.h>
+
+#include <ignite/impl/interop/interop_memory.h>
+#include <ignite/impl/interop/interop_output_stream.h>
+#include <ignite/impl/binary/binary_object_impl.h>
+#include <ignite/impl/binary/binary_writer_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            /**
+             * Binary object builder implementation.
+             *
+             * New values are serialized as they are set. Building the object
+             * only copies the serialized values, so the fields which have not
+             * been changed are never deserialized.
+             */
+            class IGNITE_IMPORT_EXPORT BinaryObjectBuilderImpl
+            {
+            public:
+                /**
+                 * Constructor.
+                 * @throw IgniteError if the object has compact footer.
+                 *
+                 * @param obj Original object.
+                 */
+                explicit BinaryObjectBuilderImpl(const BinaryObjectImpl& obj);
+
+                /**
+                 * Set field value. Field is added if the original object
+                 * does not have it.
+                 *
+                 * @param name Field name.
+                 * @param val Value.
+                 */
+                template<typename T>
+                void SetField(const char* name, const T& val)
+                {
+                    int32_t fieldId = GetFieldId(name);
+
+                    interop::InteropOutputStream out(&values);
+
+                    out.Position(values.Length());
+
+                    int32_t pos = out.Position();
+
+                    BinaryWriterImpl writer(&out, obj.metaMgr);
+
+                    writer.WriteTopObject(val);
+
+                    out.Synchronize();
+
+                    SetField(fieldId, name, pos, out.Position() - pos);
+                }
+
+                /**
+                 * Remove field.
+                 *
+                 * @param name Field name.
+                 */
+                void RemoveField(const char* name);
+
+                /**
+                 * Build object. Fields of the original object are kept in
+                 * their order, added fields follow them.
+                 *
+                 * Unchanged field which is a handle is replaced with a copy
+                 * of the referred object. Handles nested in the unchanged
+                 * field values are re-pointed to the copies of the referred
+                 * objects. Raw data is copied as is.
+                 * @throw IgniteError if the nested handle refers to the value
+                 *     of the changed or removed field.
+                 *
+                 * @param mem Memory to write the object to. Its contents are
+                 *     replaced. Should not be the memory of the original
+                 *     object.
+                 * @return Built object.
+                 */
+                BinaryObjectImpl Build(interop::InteropMemory& mem);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryObjectBuilderImpl);
+
+                /**
+                 * Changed field.
+                 */
+                struct Change
+                {
+                    /** Field ID. */
+                    int32_t id;
+
+                    /** Field name. */
+                    std::string name;
+
+                    /** Value position in the values memory. */
+                    int32_t pos;
+
+                    /** Value length. Negative if the field is removed. */
+                    int32_t len;
+                };
+
+                /**
+                 * Field of the original object.
+                 */
+                struct Field
+                {
+                    /** Field ID. */
+                    int32_t id;
+
+                    /** Value position relative to the object start. */
+                    int32_t pos;
+
+                    /** Value length. */
+                    int32_t len;
+                };
+
+                /**
+                 * Get field ID.
+                 *
+                 * @param name Field name.
+                 * @return Field ID.
+                 */
+                int32_t GetFieldId(const char* name);
+
+                /**
+                 * Record field change.
+                 *
+                 * @param fieldId Field ID.
+                 * @param name Field name.
+                 * @param pos Value position in the values memory.
+                 * @param len Value length. Negative if the field is removed.
+                 */
+                void SetField(int32_t fieldId, const char* name, int32_t pos, int32_t len);
+
+                /**
+                 * Find field change.
+                 *
+                 * @param fieldId Field ID.
+                 * @return Change or null if the field has not been changed.
+                 */
+                const Change* FindChange(int32_t fieldId) const;
+
+                /**
+                 * Get fields of the original object in the order of their
+                 * values.
+                 *
+                 * @param fields Fields.
+                 */
+                void GetFields(std::vector<Field>& fields) const;
+
+                /**
+                 * Value copied from the original object.
+                 */
+                struct CopiedValue
+                {
+                    /** Position in the original object memory. */
+                    int32_t pos;
+
+                    /** Value length. */
+                    int32_t len;
+
+                    /** Position in the built object memory. */
+                    int32_t newPos;
+                };
+
+                /**
+                 * Write unchanged field of the original object.
+                 *
+                 * @param writer Writer.
+                 * @param field Field.
+                 * @param copied Values copied so far. Written value is added.
+                 */
+                void WriteOriginalField(BinaryWriterImpl& writer, const Field& field,
+                    std::vector<CopiedValue>& copied) const;
+
+                /**
+                 * Register changed fields in the type metadata.
+                 */
+                void SubmitMeta();
+
+                /** Original object. */
+                BinaryObjectImpl obj;
+
+                /** Serialized values of the changed fields. */
+                interop::InteropUnpooledMemory values;
+
+                /** Changed fields in the order they have been changed first. */
+                std::vector<Change> changes;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_BINARY_BINARY_OBJECT_BUILDER_IMPL
@@ -47,6 +47,7 @@ namespace ignite
              */
             class IGNITE_IMPORT_EXPORT BinaryObjectImpl
             {
+                friend class BinaryObjectBuilderImpl;
             public:
                 /**
                  * Constructor.
@@ -34,6 +34,7 @@
 #include "ignite/binary/binary_consts.h"
 #include "ignite/binary/binary_type.h"
 #include "ignite/binary/binary_enum_entry.h"
+#include "ignite/binary/binary_view.h"
 #include "ignite/guid.h"
 #include "ignite/date.h"
 #include "ignite/timestamp.h"
@@ -111,6 +112,14 @@ namespace ignite
                  */
                 int8_t ReadInt8(const char* fieldName);
 
+                /**
+                 * Read 8-byte signed integer. Maps to "byte" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                int8_t ReadInt8(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read array of 8-byte signed integers. Maps to "byte[]" type in Java.
                  *
@@ -124,6 +133,29 @@ namespace ignite
                  */
                 int32_t ReadInt8Array(const char* fieldName, int8_t* res, const int32_t len);
 
+                /**
+                 * Read view of the array of 8-byte signed integers. Maps to "byte[]" type in Java.
+                 *
+                 * @return View. Null if the array in stream was null.
+                 */
+                ignite::binary::BinaryInt8ArrayView ReadInt8ArrayView();
+
+                /**
+                 * Read view of the array of 8-byte signed integers. Maps to "byte[]" type in Java.
+                 *
+                 * @param fieldName Field name.
+                 * @return View. Null if the field is not found or null.
+                 */
+                ignite::binary::BinaryInt8ArrayView ReadInt8ArrayView(const char* fieldName);
+
+                /**
+                 * Read view of the array of 8-byte signed integers. Maps to "byte[]" type in Java.
+                 *
+                 * @param field Field.
+                 * @return View. Null if the field is not found or null.
+                 */
+                ignite::binary::BinaryInt8ArrayView ReadInt8ArrayView(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read bool. Maps to "boolean" type in Java.
                  *
@@ -151,6 +183,14 @@ namespace ignite
                  */
                 bool ReadBool(const char* fieldName);
 
+                /**
+                 * Read bool. Maps to "short" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                bool ReadBool(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read bool array. Maps to "bool[]" type in Java.
                  *
@@ -191,6 +231,14 @@ namespace ignite
                  */
                 int16_t ReadInt16(const char* fieldName);
 
+                /**
+                 * Read 16-byte signed integer. Maps to "short" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                int16_t ReadInt16(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read array of 16-byte signed integers. Maps to "short[]" type in Java.
                  *
@@ -231,6 +279,14 @@ namespace ignite
                  */
                 uint16_t ReadUInt16(const char* fieldName);
 
+                /**
+                 * Read 16-byte unsigned integer. Maps to "char" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                uint16_t ReadUInt16(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read array of 16-byte unsigned integers. Maps to "char[]" type in Java.
                  *
@@ -271,6 +327,14 @@ namespace ignite
                  */
                 int32_t ReadInt32(const char* fieldName);
 
+                /**
+                 * Read 32-byte signed integer. Maps to "int" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                int32_t ReadInt32(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read array of 32-byte signed integers. Maps to "int[]" type in Java.
                  *
@@ -311,6 +375,14 @@ namespace ignite
                  */
                 int64_t ReadInt64(const char* fieldName);
 
+                /**
+                 * Read 64-byte signed integer. Maps to "long" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                int64_t ReadInt64(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read array of 64-byte signed integers. Maps to "long[]" type in Java.
                  *
@@ -351,6 +423,14 @@ namespace ignite
                  */
                 float ReadFloat(const char* fieldName);
 
+                /**
+                 * Read float. Maps to "float" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                float ReadFloat(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read float array. Maps to "float[]" type in Java.
                  *
@@ -391,6 +471,14 @@ namespace ignite
                  */
                 double ReadDouble(const char* fieldName);
 
+                /**
+                 * Read double. Maps to "double" type in Java.
+                 *
+                 * @param field Field.
+                 * @return Result.
+                 */
+                double ReadDouble(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Read double array. Maps to "double[]" type in Java.
                  *
@@ -610,7 +698,39 @@ namespace ignite
                  *     -1 will be returned in case array in stream was null.
                  */
                 int32_t ReadString(const char* fieldName, char* res, const int32_t len);
-                
+
+                /**
+                 * Read string.
+                 *
+                 * @param field Field.
+                 * @param res String to store result. Cleared if the field is
+                 *     not found or null.
+                 */
+                void ReadString(const ignite::binary::BinaryFieldId& field, std::string& res);
+
+                /**
+                 * Read view of the string.
+                 *
+                 * @return View. Null if the string in stream was null.
+                 */
+                ignite::binary::BinaryStringView ReadStringView();
+
+                /**
+                 * Read view of the string.
+                 *
+                 * @param fieldName Field name.
+                 * @return View. Null if the field is not found or null.
+                 */
+                ignite::binary::BinaryStringView ReadStringView(const char* fieldName);
+
+                /**
+                 * Read view of the string.
+                 *
+                 * @param field Field.
+                 * @return View. Null if the field is not found or null.
+                 */
+                ignite::binary::BinaryStringView ReadStringView(const ignite::binary::BinaryFieldId& field);
+
                 /**
                  * Start string array read.
                  *
@@ -688,11 +808,8 @@ namespace ignite
                 int32_t ReadCollection(OutputIterator out)
                 {
                     int32_t size;
-                    int32_t id = StartContainerSession(true, IGNITE_TYPE_COLLECTION, &size);
-
-                    // Reading collection type. We don't need it here but it should be read.
-                    if (size != -1)
-                        stream->ReadInt8();
+                    int8_t typ;
+                    int32_t id = StartContainerSession(true, IGNITE_TYPE_COLLECTION, &size, &typ);
 
                     while (HasNextElement(id))
                     {
@@ -725,11 +842,8 @@ namespace ignite
                     stream->Position(fieldPos);
 
                     int32_t size;
-                    int32_t id = StartContainerSession(false, IGNITE_TYPE_COLLECTION, &size);
-
-                    // Reading collection type. We don't need it here but it should be read.
-                    if (size != -1)
-                        stream->ReadInt8();
+                    int8_t typ;
+                    int32_t id = StartContainerSession(false, IGNITE_TYPE_COLLECTION, &size, &typ);
 
                     while (HasNextElement(id))
                     {
@@ -820,13 +934,14 @@ namespace ignite
                 {
                     CheckSession(id);
 
-                    if (++elemRead == elemCnt) {
-                        elemId = 0;
-                        elemCnt = -1;
-                        elemRead = 0;
-                    }
+                    int32_t retPos = OnElementRead();
 
-                    return ReadTopObject<T>();
+                    T res = ReadTopObject<T>();
+
+                    if (retPos >= 0)
+                        stream->Position(retPos);
+
+                    return res;
                 }
 
                 /**
@@ -841,14 +956,13 @@ namespace ignite
                 {
                     CheckSession(id);
 
-                    if (++elemRead == elemCnt) {
-                        elemId = 0;
-                        elemCnt = -1;
-                        elemRead = 0;
-                    }
+                    int32_t retPos = OnElementRead();
 
                     key = ReadTopObject<K>();
                     val = ReadTopObject<V>();
+
+                    if (retPos >= 0)
+                        stream->Position(retPos);
                 }
 
                 /**
@@ -887,6 +1001,27 @@ namespace ignite
                     return ReadTopObject<T>();
                 }
 
+                /**
+                 * Read object.
+                 *
+                 * @param field Field.
+                 * @return Object.
+                 */
+                template<typename T>
+                T ReadObject(const ignite::binary::BinaryFieldId& field)
+                {
+                    CheckRawMode(false);
+
+                    int32_t fieldPos = FindField(field.GetId());
+
+                    if (fieldPos <= 0)
+                        return GetNull<T>();
+
+                    stream->Position(fieldPos);
+
+                    return ReadTopObject<T>();
+                }
+
                 /**
                  * Read enum value.
                  *
@@ -985,8 +1120,13 @@ namespace ignite
 
                         case IGNITE_HDR_HND:
                         {
-                            IGNITE_ERROR_1(ignite::IgniteError::IGNITE_ERR_BINARY, 
-                                           "Circular references are not supported.");
+                            int32_t retPos = FollowHandle(pos);
+
+                            ReadTopObject0<R, T>(res);
+
+                            stream->Position(retPos);
+
+                            return;
                         }
 
                         case IGNITE_TYPE_BINARY:
@@ -1097,10 +1237,22 @@ namespace ignite
                 template<typename R, typename T>
                 void ReadTopObject0(std::vector<T>& res)
                 {
+                    int32_t pos = stream->Position();
                     int8_t hdr = stream->ReadInt8();
 
                     switch (hdr)
                     {
+                        case IGNITE_HDR_HND:
+                        {
+                            int32_t retPos = FollowHandle(pos);
+
+                            ReadTopObject0<R, T>(res);
+
+                            stream->Position(retPos);
+
+                            return;
+                        }
+
                         case IGNITE_TYPE_ARRAY:
                         {
                             int32_t elementNum = stream->ReadInt32();
@@ -1181,6 +1333,9 @@ namespace ignite
                 /** Amount of elements read. */
                 int32_t elemRead;
 
+                /** Position to continue from after the container reached through a handle is read. */
+                int32_t elemRetPos;
+
                 /** Footer beginning position. */
                 int32_t footerBegin;
 
@@ -1310,7 +1465,47 @@ namespace ignite
                     CheckRawMode(false);
                     CheckSingleMode(true);
 
-                    int32_t fieldId = idRslvr->GetFieldId(typeId, fieldName);
+                    return ReadField(idRslvr->GetFieldId(typeId, fieldName), func, expHdr, dflt);
+                }
+
+                /**
+                 * Read single value.
+                 *
+                 * @param field Field.
+                 * @param func Function to be invoked on stream.
+                 * @param epxHdr Expected header.
+                 * @param dflt Default value returned if field is not found.
+                 * @return Result.
+                 */
+                template<typename T>
+                T Read(
+                    const ignite::binary::BinaryFieldId& field,
+                    T(*func) (interop::InteropInputStream*),
+                    const int8_t expHdr,
+                    T dflt)
+                {
+                    CheckRawMode(false);
+                    CheckSingleMode(true);
+
+                    return ReadField(field.GetId(), func, expHdr, dflt);
+                }
+
+                /**
+                 * Read single value of the field with the given ID.
+                 *
+                 * @param fieldId Field ID.
+                 * @param func Function to be invoked on stream.
+                 * @param epxHdr Expected header.
+                 * @param dflt Default value returned if field is not found.
+                 * @return Result.
+                 */
+                template<typename T>
+                T ReadField(
+                    const int32_t fieldId,
+                    T(*func) (interop::InteropInputStream*),
+                    const int8_t expHdr,
+                    T dflt)
+                {
                     int32_t fieldPos = FindField(fieldId);
 
                     if (fieldPos <= 0)
@@ -1507,6 +1702,33 @@ namespace ignite
                  */
                 int32_t FindField(const int32_t fieldId);
 
+                /**
+                 * Check that the handle points to the object written before
+                 * it, which does not contain the handle.
+                 *
+                 * @param hndPos Handle position.
+                 * @param objPos Position of the object.
+                 */
+                void CheckHandle(int32_t hndPos, int32_t objPos) const;
+
+                /**
+                 * Read handle offset and position the stream on the object
+                 * the handle points to. Handle header should be already read.
+                 *
+                 * @param hndPos Handle position.
+                 * @return Position right after the handle.
+                 */
+                int32_t FollowHandle(int32_t hndPos);
+
+                /**
+                 * Count the element of the current container as read. Finishes
+                 * the read session after the last element.
+                 *
+                 * @return Position to continue from after the last element is read,
+                 *     if the container was reached through a handle, or -1.
+                 */
+                int32_t OnElementRead();
+
                 /**
                  * Check raw mode.
                  * 
@@ -1527,9 +1749,11 @@ namespace ignite
                  * @param expRawMode Expected raw mode.
                  * @param expHdr Expected header.
                  * @param size Container size.
+                 * @param typ Container type. Read for collections and maps only.
                  * @return Session ID.
                  */
-                int32_t StartContainerSession(const bool expRawMode, const int8_t expHdr, int32_t* size);
+                int32_t StartContainerSession(const bool expRawMode, const int8_t expHdr, int32_t* size,
+                    int8_t* typ = 0);
 
                 /**
                  * Check whether session ID matches.
@@ -1571,6 +1795,33 @@ namespace ignite
                  */
                 int32_t ReadStringInternal(char* res, const int32_t len);
 
+                /**
+                 * Internal string read routine.
+                 *
+                 * @param res String to store result.
+                 */
+                void ReadStringInternal(std::string& res);
+
+                /**
+                 * Internal view read routine.
+                 *
+                 * @param expHdr Expected header.
+                 * @return View.
+                 */
+                template<typename T>
+                ignite::binary::BinaryView<T> ReadViewInternal(const int8_t expHdr);
+
+                /**
+                 * Internal view read routine.
+                 *
+                 * @param fieldPos Field position or non-positive value if
+                 *     the field is not found.
+                 * @param expHdr Expected header.
+                 * @return View.
+                 */
+                template<typename T>
+                ignite::binary::BinaryView<T> ReadViewInternal(int32_t fieldPos, const int8_t expHdr);
+
                 /**
                  * Read type of the collection. Do not preserve stream position.
                  *
@@ -1647,6 +1898,17 @@ namespace ignite
             void IGNITE_IMPORT_EXPORT
             BinaryReaderImpl::ReadTopObject0<ignite::binary::BinaryReader, std::string>(std::string& res);
 
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, ignite::binary::BinaryStringView>(ignite::binary::BinaryStringView& res);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, ignite::binary::BinaryInt8ArrayView>(
+                    ignite::binary::BinaryInt8ArrayView& res);
+
             template<>
             void IGNITE_IMPORT_EXPORT
             BinaryReaderImpl::ReadTopObject0<
@@ -1667,6 +1929,26 @@ namespace ignite
             BinaryReaderImpl::ReadTopObject0<
                 ignite::binary::BinaryReader, std::vector<int64_t> >(std::vector<int64_t>& res);
 
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, std::vector<bool> >(std::vector<bool>& res);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, std::vector<uint16_t> >(std::vector<uint16_t>& res);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, std::vector<float> >(std::vector<float>& res);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryReaderImpl::ReadTopObject0<
+                ignite::binary::BinaryReader, std::vector<double> >(std::vector<double>& res);
+
             template<>
             inline int8_t BinaryReaderImpl::GetNull() const
             {
@@ -55,15 +55,35 @@ namespace ignite
 
             /**
              * Binary schema.
+             *
+             * First INLINE_FIELDS_NUM fields are stored in the schema itself,
+             * so writing an object with less fields does not allocate memory.
+             * The rest are stored in the vector shared with the schemas of the
+             * nested objects. As a nested object is written completely before
+             * the next field of the enclosing one, the schemas use the vector
+             * as a stack, and its memory is reused by all the objects written
+             * within the top-level object.
              */
             class IGNITE_IMPORT_EXPORT BinarySchema
             {
             public:
+                /** Number of fields stored in the schema itself. */
+                enum { INLINE_FIELDS_NUM = 16 };
+
                 /**
                  * Default constructor.
                  */
                 BinarySchema();
 
+                /**
+                 * Constructor.
+                 *
+                 * @param parent Schema of the enclosing object. Its storage
+                 *     is shared with the new schema. Own storage is used if
+                 *     null.
+                 */
+                explicit BinarySchema(BinarySchema* parent);
+
                 /**
                  * Destructor.
                  */
@@ -99,7 +119,10 @@ namespace ignite
                  *
                  * @return True if does not contain field info.
                  */
-                bool Empty() const;
+                bool Empty() const
+                {
+                    return fieldsNum == 0;
+                }
 
                 /** 
                  * Clear schema info.
@@ -126,11 +149,41 @@ namespace ignite
                 /** Type alias for vector of field info. */
                 typedef std::vector<BinarySchemaFieldInfo> FieldContainer;
 
+                /**
+                 * Write fields to stream.
+                 *
+                 * @param out Stream.
+                 * @param type Type of schema.
+                 * @param begin First field.
+                 * @param end Field after the last one.
+                 */
+                static void WriteFields(interop::InteropOutputStream& out, BinaryOffsetType::Type type,
+                    const BinarySchemaFieldInfo* begin, const BinarySchemaFieldInfo* end);
+
+                /**
+                 * Get last added field.
+                 *
+                 * @return Field info.
+                 */
+                const BinarySchemaFieldInfo& GetLastField() const;
+
                 /** Schema ID. */
                 int32_t id;
 
-                /** Information about written fields. */
-                FieldContainer* fieldsInfo;
+                /** Number of fields. */
+                int32_t fieldsNum;
+
+                /** First fields. */
+                BinarySchemaFieldInfo inlineFields[INLINE_FIELDS_NUM];
+
+                /** Storage of the rest of the fields. Not used by nested schemas. */
+                FieldContainer ownExtraFields;
+
+                /** Storage of the rest of the fields shared with nested schemas. */
+                FieldContainer* extraFields;
+
+                /** Position of the first field of the schema in the shared storage. */
+                FieldContainer::size_type extraBegin;
 
                 IGNITE_NO_COPY_ASSIGNMENT(BinarySchema);
             };
@@ -21,6 +21,7 @@
 #include <ignite/common/concurrent.h>
 
 #include "ignite/impl/binary/binary_type_snapshot.h"
+#include "ignite/impl/binary/binary_write_plan.h"
 
 namespace ignite
 {    
@@ -39,8 +40,9 @@ namespace ignite
                  * Constructor.
                  *
                  * @param snap Snapshot.
+                 * @param record Whether to record the write plan.
                  */
-                BinaryTypeHandler(SPSnap snap);
+                BinaryTypeHandler(SPSnap snap, bool record);
 
                 /**
                  * Callback invoked when field is being written.
@@ -49,7 +51,7 @@ namespace ignite
                  * @param fieldName Field name.
                  * @param fieldTypeId Field type ID.
                  */
-                void OnFieldWritten(int32_t fieldId, std::string fieldName, int32_t fieldTypeId);
+                void OnFieldWritten(int32_t fieldId, const char* fieldName, int32_t fieldTypeId);
 
                 /**
                  * Whether any difference exists.
@@ -71,6 +73,16 @@ namespace ignite
                     return updated;
                 }
 
+                /**
+                 * Get write plan recorded during the write session.
+                 *
+                 * @return Write plan or null if the plan is not recorded.
+                 */
+                const BinaryWritePlan* GetWritePlan() const
+                {
+                    return record ? &plan : 0;
+                }
+
             private:
                 /** Snapshot. */
                 SPSnap origin;
@@ -78,6 +90,12 @@ namespace ignite
                 /** Snapshot. */
                 SPSnap updated;
 
+                /** Whether to record the write plan. */
+                bool record;
+
+                /** Recorded write plan. */
+                BinaryWritePlan plan;
+
                 IGNITE_NO_COPY_ASSIGNMENT(BinaryTypeHandler);
             };
         }
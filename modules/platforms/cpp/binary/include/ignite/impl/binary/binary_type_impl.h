@@ -234,6 +234,55 @@ namespace ignite
                 // Call itself.
                 AffinityFieldNameGetter::Get(affField);
             }
+
+            IGNITE_DECLARE_BINARY_TYPE_METHOD_CHECKER(IsDeduplicated, bool(*)());
+
+            /**
+             * This type is used to check deduplication for binary types which have not IsDeduplicated
+             * method defined.
+             */
+            template<typename T>
+            struct DeduplicatedGetterDefault
+            {
+                static bool Get()
+                {
+                    return false;
+                }
+            };
+
+            /**
+             * This type is used to check deduplication for binary types which have IsDeduplicated
+             * method defined.
+             */
+            template<typename T>
+            struct DeduplicatedGetterMethod
+            {
+                static bool Get()
+                {
+                    return ignite::binary::BinaryType<T>::IsDeduplicated();
+                }
+            };
+
+            /**
+             * Check if the identical objects of the specified type written
+             * within the same top-level object should be replaced with
+             * handles.
+             *
+             * @return True if the objects should be deduplicated.
+             */
+            template<typename T>
+            bool IsDeduplicated()
+            {
+                using namespace common;
+
+                typedef typename Conditional<
+                    IsDeclaredBinaryTypeIsDeduplicated<T>::value,
+                    DeduplicatedGetterMethod<T>,
+                    DeduplicatedGetterDefault<T>
+                >::type DeduplicatedGetter;
+
+                return DeduplicatedGetter::Get();
+            }
         } // namespace binary
     } // namespace impl
 } // namespace ignite
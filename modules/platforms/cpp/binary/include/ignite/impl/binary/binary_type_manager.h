@@ -22,6 +22,7 @@
 
 #include <ignite/ignite_error.h>
 #include "ignite/impl/binary/binary_type_handler.h"
+#include "ignite/impl/binary/binary_type_table.h"
 #include "ignite/impl/binary/binary_type_updater.h"
 
 namespace ignite
@@ -94,20 +95,56 @@ namespace ignite
                 void SetUpdater(BinaryTypeUpdater* updater);
 
                 /**
-                 * Get metadata snapshop for the type.
+                 * Get metadata snapshop for the type. Does not take locks if
+                 * the type is registered.
                  *
                  * @param typeId Type ID.
                  * @return Metadata snapshot.
                  */
                 SPSnap GetMeta(int32_t typeId);
 
+                /**
+                 * Get write plan of the type. Does not take locks.
+                 *
+                 * Plan only exists once the type and all the fields in the
+                 * plan are registered, so the writes following the plan do not
+                 * need to track type updates.
+                 *
+                 * @param typeId Type ID.
+                 * @return Write plan or null if there is no plan for the type
+                 *     yet. Valid until the manager is destructed.
+                 */
+                const BinaryWritePlan* GetWritePlan(int32_t typeId) const
+                {
+                    return plans->Get(typeId);
+                }
+
             private:
-                /** Current snapshots. */
-                std::map<int32_t, SPSnap>* snapshots;
+                /**
+                 * Find pending snapshot. Should be called under the lock.
+                 *
+                 * @param typeId Type ID.
+                 * @return Pending snapshot or null if not found.
+                 */
+                const SPSnap* FindPending(int32_t typeId) const;
+
+                /**
+                 * Add write plan unless the plan for the type already exists
+                 * or the type is not registered yet.
+                 *
+                 * @param plan Recorded write plan.
+                 */
+                void AddWritePlan(const BinaryWritePlan& plan);
+
+                /** Registered snapshots. Read without locking, so the published snapshots are never changed. */
+                BinaryTypeTable<SPSnap>* snapshots;
 
                 /** Pending snapshots. */
                 std::vector<SPSnap>* pending;
 
+                /** Write plans. Read without locking. */
+                BinaryTypeTable<BinaryWritePlan>* plans;
+
                 /** Critical section. */
                 common::concurrent::CriticalSection cs;
 
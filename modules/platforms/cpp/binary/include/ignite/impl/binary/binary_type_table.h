@@ -0,0 +1,214 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_BINARY_BINARY_TYPE_TABLE
+#define _IGNITE_IMPL_BINARY_BINARY_TYPE_TABLE
+
+#include <stdint.h>
+#include <vector>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            /**
+             * Values keyed by type ID which are read without locking.
+             *
+             * Open addressing hash table. Entries are immutable and a filled
+             * slot is only replaced with another entry for the same type.
+             * Replaced entries and tables can be still in use by readers, so
+             * they are released on destruction only.
+             *
+             * Updates should be serialized by the caller.
+             */
+            template<typename T>
+            class BinaryTypeTable
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                BinaryTypeTable() :
+                    table(new Table(INITIAL_SIZE)),
+                    cnt(0),
+                    retiredTables(),
+                    retiredEntries()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                ~BinaryTypeTable()
+                {
+                    for (typename Table::iterator it = table->begin(); it != table->end(); ++it)
+                        delete *it;
+
+                    delete table;
+
+                    for (typename std::vector<Table*>::iterator it = retiredTables.begin();
+                        it != retiredTables.end(); ++it)
+                        delete *it;
+
+                    for (typename Table::iterator it = retiredEntries.begin(); it != retiredEntries.end(); ++it)
+                        delete *it;
+                }
+
+                /**
+                 * Get value. Does not take locks.
+                 *
+                 * @param typeId Type ID.
+                 * @return Value or null if there is no value for the type.
+                 *     Valid until the table is destructed.
+                 */
+                const T* Get(int32_t typeId) const
+                {
+                    common::concurrent::Memory::Fence();
+
+                    const Table& table0 = *table;
+
+                    const Entry* entry = table0[FindSlot(table0, typeId)];
+
+                    return entry ? &entry->val : 0;
+                }
+
+                /**
+                 * Put value. Replaces the current value for the type.
+                 *
+                 * @param typeId Type ID.
+                 * @param val Value.
+                 */
+                void Put(int32_t typeId, const T& val)
+                {
+                    // Keeping load factor under one half, so the probe sequences
+                    // are short and there is always a free slot.
+                    if ((cnt + 1) * 2 > table->size())
+                        Grow();
+
+                    Entry* entry = new Entry(typeId, val);
+
+                    size_t slot = FindSlot(*table, typeId);
+
+                    Entry* old = (*table)[slot];
+
+                    // Entry should be visible before the slot is filled.
+                    common::concurrent::Memory::Fence();
+
+                    (*table)[slot] = entry;
+
+                    if (old)
+                        retiredEntries.push_back(old);
+                    else
+                        ++cnt;
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(BinaryTypeTable);
+
+                /** Initial size of the table. */
+                enum { INITIAL_SIZE = 16 };
+
+                /**
+                 * Table entry.
+                 */
+                struct Entry
+                {
+                    /**
+                     * Constructor.
+                     *
+                     * @param typeId Type ID.
+                     * @param val Value.
+                     */
+                    Entry(int32_t typeId, const T& val) :
+                        typeId(typeId),
+                        val(val)
+                    {
+                        // No-op.
+                    }
+
+                    /** Type ID. */
+                    const int32_t typeId;
+
+                    /** Value. */
+                    const T val;
+                };
+
+                /** Table slots. Size is a power of two. */
+                typedef std::vector<Entry*> Table;
+
+                /**
+                 * Find the slot of the type.
+                 *
+                 * @param table Table.
+                 * @param typeId Type ID.
+                 * @return Slot filled with the entry for the type or the free
+                 *     slot where the entry should be put.
+                 */
+                static size_t FindSlot(const Table& table, int32_t typeId)
+                {
+                    size_t mask = table.size() - 1;
+                    size_t i = static_cast<uint32_t>(typeId) & mask;
+
+                    while (table[i] && table[i]->typeId != typeId)
+                        i = (i + 1) & mask;
+
+                    return i;
+                }
+
+                /**
+                 * Replace the table with the one of the double size.
+                 */
+                void Grow()
+                {
+                    Table* newTable = new Table(table->size() * 2);
+
+                    for (typename Table::iterator it = table->begin(); it != table->end(); ++it)
+                    {
+                        if (*it)
+                            (*newTable)[FindSlot(*newTable, (*it)->typeId)] = *it;
+                    }
+
+                    common::concurrent::Memory::Fence();
+
+                    retiredTables.push_back(table);
+
+                    table = newTable;
+                }
+
+                /** Current table. */
+                Table* table;
+
+                /** Number of entries. */
+                size_t cnt;
+
+                /** Replaced tables. */
+                std::vector<Table*> retiredTables;
+
+                /** Replaced entries. */
+                Table retiredEntries;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_BINARY_BINARY_TYPE_TABLE
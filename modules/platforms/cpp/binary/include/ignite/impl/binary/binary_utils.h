@@ -43,6 +43,24 @@ namespace ignite
 
         namespace binary
         {
+            /**
+             * Data hash implementation.
+             */
+            struct DataHashImpl
+            {
+                enum Type
+                {
+                    /** Portable scalar implementation. */
+                    SCALAR,
+
+                    /** SSE2 implementation. */
+                    SSE2,
+
+                    /** AVX2 implementation. */
+                    AVX2
+                };
+            };
+
             /**
              * Binary uilts.
              */
@@ -58,6 +76,27 @@ namespace ignite
                  */
                 static int32_t GetDataHashCode(const void* data, size_t size);
 
+                /**
+                 * Get data hash code with the specified implementation regardless
+                 * of the data size. Used to check implementations against each other.
+                 *
+                 * @param data Data pointer.
+                 * @param size Data size in bytes.
+                 * @param impl Implementation.
+                 * @return Hash code.
+                 * @throw IgniteError if the implementation is not supported.
+                 */
+                static int32_t GetDataHashCode(const void* data, size_t size, DataHashImpl::Type impl);
+
+                /**
+                 * Check whether the data hash implementation is supported by
+                 * the build and the processor.
+                 *
+                 * @param impl Implementation.
+                 * @return True if supported.
+                 */
+                static bool IsDataHashSupported(DataHashImpl::Type impl);
+
                 /**
                  * Utility method to read signed 8-bit integer from stream.
                  *
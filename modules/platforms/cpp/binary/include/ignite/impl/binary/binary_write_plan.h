@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_BINARY_BINARY_WRITE_PLAN
+#define _IGNITE_IMPL_BINARY_BINARY_WRITE_PLAN
+
+#include <stdint.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ignite/impl/binary/binary_type_snapshot.h"
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            /**
+             * Write plan of the type. Contains IDs of the fields in the order
+             * they are written, so the writes following the plan neither
+             * resolve field IDs nor track type metadata.
+             */
+            class BinaryWritePlan
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param snap Snapshot of the type.
+                 */
+                explicit BinaryWritePlan(SPSnap snap);
+
+                /**
+                 * Add the next written field.
+                 *
+                 * @param fieldId Field ID.
+                 * @param fieldName Field name.
+                 */
+                void AddField(int32_t fieldId, const char* fieldName);
+
+                /**
+                 * Check whether all fields of the plan are known to the
+                 * snapshot.
+                 *
+                 * @param snap Snapshot.
+                 * @return True if all fields are known.
+                 */
+                bool IsCoveredBy(const Snap& snap) const;
+
+                /**
+                 * Get ID of the field written at the given position.
+                 *
+                 * @param idx Position of the field.
+                 * @param fieldName Field name.
+                 * @param fieldId Field ID.
+                 * @return True if the field matches the plan and false
+                 *     otherwise.
+                 */
+                bool GetFieldId(int32_t idx, const char* fieldName, int32_t& fieldId) const
+                {
+                    if (idx >= static_cast<int32_t>(fields.size()) || !fieldName)
+                        return false;
+
+                    const Field& field = fields[idx];
+
+                    if (std::strcmp(field.name.c_str(), fieldName) != 0)
+                        return false;
+
+                    fieldId = field.id;
+
+                    return true;
+                }
+
+                /**
+                 * Check whether the field written at the given position
+                 * matches the plan.
+                 *
+                 * @param idx Position of the field.
+                 * @param fieldId Field ID.
+                 * @return True if matches.
+                 */
+                bool Matches(int32_t idx, int32_t fieldId) const
+                {
+                    return idx < static_cast<int32_t>(fields.size()) && fields[idx].id == fieldId;
+                }
+
+                /**
+                 * Get type ID.
+                 *
+                 * @return Type ID.
+                 */
+                int32_t GetTypeId() const
+                {
+                    return snap.Get()->GetTypeId();
+                }
+
+                /**
+                 * Get snapshot of the type.
+                 *
+                 * @return Snapshot.
+                 */
+                const Snap& GetSnapshot() const
+                {
+                    return *snap.Get();
+                }
+
+            private:
+                /**
+                 * Written field.
+                 */
+                struct Field
+                {
+                    /** Field name. */
+                    std::string name;
+
+                    /** Field ID. */
+                    int32_t id;
+                };
+
+                /** Snapshot of the type. */
+                SPSnap snap;
+
+                /** Fields in the write order. */
+                std::vector<Field> fields;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_BINARY_BINARY_WRITE_PLAN
@@ -20,6 +20,7 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 #include <stdint.h>
 
 #include <ignite/common/common.h>
@@ -31,6 +32,7 @@
 #include "ignite/impl/binary/binary_type_manager.h"
 #include "ignite/impl/binary/binary_utils.h"
 #include "ignite/impl/binary/binary_schema.h"
+#include "ignite/impl/binary/binary_handle_table.h"
 #include "ignite/impl/binary/binary_object_impl.h"
 #include "ignite/binary/binary_consts.h"
 #include "ignite/binary/binary_type.h"
@@ -65,9 +67,16 @@ namespace ignite
                  * @param idRslvr Binary ID resolver.
                  * @param metaMgr Type manager.
                  * @param metaHnd Type handler.
+                 * @param start Object start position.
+                 * @param plan Write plan. When set, fields written according
+                 *     to the plan are not tracked by the type handler.
+                 * @param parent Writer of the enclosing object. Handle table
+                 *     and schema storage of the top-level object are shared
+                 *     with it. Null if the object is top-level.
                  */
                 BinaryWriterImpl(interop::InteropOutputStream* stream, BinaryIdResolver* idRslvr, 
-                    BinaryTypeManager* metaMgr, BinaryTypeHandler* metaHnd, int32_t start);
+                    BinaryTypeManager* metaMgr, BinaryTypeHandler* metaHnd, int32_t start,
+                    const BinaryWritePlan* plan = 0, BinaryWriterImpl* parent = 0);
 
                 /**
                  * Constructor used to construct light-weight writer allowing only raw operations 
@@ -709,6 +718,95 @@ namespace ignite
                     WriteTopObject(val);
                 }
 
+                /**
+                 * Write 8-byte signed integer. Maps to "byte" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteInt8(const ignite::binary::BinaryFieldId& field, const int8_t val);
+
+                /**
+                 * Write bool. Maps to "bool" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteBool(const ignite::binary::BinaryFieldId& field, const bool val);
+
+                /**
+                 * Write 16-byte signed integer. Maps to "short" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteInt16(const ignite::binary::BinaryFieldId& field, const int16_t val);
+
+                /**
+                 * Write 16-byte unsigned integer. Maps to "char" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteUInt16(const ignite::binary::BinaryFieldId& field, const uint16_t val);
+
+                /**
+                 * Write 32-byte signed integer. Maps to "int" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteInt32(const ignite::binary::BinaryFieldId& field, const int32_t val);
+
+                /**
+                 * Write 64-byte signed integer. Maps to "long" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteInt64(const ignite::binary::BinaryFieldId& field, const int64_t val);
+
+                /**
+                 * Write float. Maps to "float" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteFloat(const ignite::binary::BinaryFieldId& field, const float val);
+
+                /**
+                 * Write double. Maps to "double" type in Java.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 */
+                void WriteDouble(const ignite::binary::BinaryFieldId& field, const double val);
+
+                /**
+                 * Write string.
+                 *
+                 * @param field Field.
+                 * @param val String.
+                 * @param len String length (characters).
+                 */
+                void WriteString(const ignite::binary::BinaryFieldId& field, const char* val, const int32_t len);
+
+                /**
+                 * Write object.
+                 *
+                 * @param field Field.
+                 * @param val Object.
+                 */
+                template<typename T>
+                void WriteObject(const ignite::binary::BinaryFieldId& field, const T& val)
+                {
+                    CheckRawMode(false);
+
+                    WriteFieldId(field.GetId(), field.GetName(), IGNITE_TYPE_OBJECT);
+
+                    WriteTopObject(val);
+                }
+
                 /**
                  * Write enum entry.
                  *
@@ -768,6 +866,15 @@ namespace ignite
                  */
                 int32_t GetRawPosition() const;
 
+                /**
+                 * Write field with already serialized value.
+                 *
+                 * @param fieldId Field ID.
+                 * @param val Serialized value including the type header.
+                 * @param len Value length.
+                 */
+                void WriteFieldValue(int32_t fieldId, const int8_t* val, int32_t len);
+
                 /**
                  * Write object.
                  *
@@ -796,25 +903,38 @@ namespace ignite
                     {
                         TemplatedBinaryIdResolver<T> idRslvr;
                         common::concurrent::SharedPointer<BinaryTypeHandler> metaHnd;
+                        const BinaryWritePlan* plan = 0;
 
-                        std::string typeName;
-                        BType::GetTypeName(typeName);
-
-                        std::string affField;
-                        GetAffinityFieldName<T>(affField);
+                        int32_t typeId = idRslvr.GetTypeId();
 
                         if (metaMgr)
-                            metaHnd = metaMgr->GetHandler(typeName, affField, idRslvr.GetTypeId());
+                        {
+                            // Registered type is written according to its plan
+                            // without tracking metadata.
+                            plan = metaMgr->GetWritePlan(typeId);
+
+                            if (!plan)
+                            {
+                                std::string typeName;
+                                BType::GetTypeName(typeName);
+
+                                std::string affField;
+                                GetAffinityFieldName<T>(affField);
+
+                                metaHnd = metaMgr->GetHandler(typeName, affField, typeId);
+                            }
+                        }
 
                         int32_t pos = stream->Position();
+                        int32_t handleCnt = handles ? handles->GetHandleCount() : 0;
 
-                        BinaryWriterImpl writerImpl(stream, &idRslvr, metaMgr, metaHnd.Get(), pos);
+                        BinaryWriterImpl writerImpl(stream, &idRslvr, metaMgr, metaHnd.Get(), pos, plan, this);
                         W writer(&writerImpl);
 
                         stream->WriteInt8(IGNITE_HDR_FULL);
                         stream->WriteInt8(IGNITE_PROTO_VER);
                         stream->WriteInt16(IGNITE_BINARY_FLAG_USER_TYPE);
-                        stream->WriteInt32(idRslvr.GetTypeId());
+                        stream->WriteInt32(typeId);
 
                         int32_t hashPos = stream->Reserve(4);
 
@@ -827,8 +947,8 @@ namespace ignite
 
                         stream->Synchronize();
 
-                        if (metaMgr)
-                            metaMgr->SubmitHandler(*metaHnd.Get());
+                        if (metaMgr && writerImpl.GetTypeHandler())
+                            metaMgr->SubmitHandler(*writerImpl.GetTypeHandler());
 
                         // We are using direct constructor here to avoid check-overhead, as we know
                         // at this point that underlying memory contains valid binary object.
@@ -837,6 +957,10 @@ namespace ignite
                         int32_t hash = BinaryUtils::GetDataHashCode(binObj.GetData(), binObj.GetLength());
 
                         stream->WriteInt32(hashPos, hash);
+
+                        // Handles are only valid within the top-level object.
+                        if (handles && IsDeduplicated<T>())
+                            handles->Deduplicate(*stream, pos, hash, handleCnt);
                     }
                 }
 
@@ -868,6 +992,17 @@ namespace ignite
                  * @return Stream.
                  */
                 interop::InteropOutputStream* GetStream();
+
+                /**
+                 * Get type handler tracking the type updates.
+                 *
+                 * @return Type handler or null if all fields have been written
+                 *     according to the write plan.
+                 */
+                BinaryTypeHandler* GetTypeHandler()
+                {
+                    return metaHnd;
+                }
             private:
                 /** Underlying stream. */
                 interop::InteropOutputStream* stream; 
@@ -881,6 +1016,15 @@ namespace ignite
                 /** Type handler. */
                 BinaryTypeHandler* metaHnd;
 
+                /** Type handler created when the fields do not match the write plan. */
+                common::concurrent::SharedPointer<BinaryTypeHandler> planMissHnd;
+
+                /** Write plan. */
+                const BinaryWritePlan* plan;
+
+                /** Number of fields written according to the write plan. */
+                int32_t planPos;
+
                 /** Type ID. */
                 int32_t typeId;
 
@@ -905,6 +1049,12 @@ namespace ignite
                 /** Writing start position. */
                 int32_t start;
 
+                /** Objects written within the object. Not used by nested writers. */
+                BinaryHandleTable handleTable;
+
+                /** Handle table of the top-level object. Null for the raw writer. */
+                BinaryHandleTable* handles;
+
                 IGNITE_NO_COPY_ASSIGNMENT(BinaryWriterImpl);
 
                 /**
@@ -953,6 +1103,22 @@ namespace ignite
                     const int32_t len
                 );
 
+                /**
+                 * Write a primitive value to stream.
+                 *
+                 * @param field Field.
+                 * @param val Value.
+                 * @param func Stream function.
+                 * @param typ Field type ID.
+                 */
+                template<typename T>
+                void WritePrimitive(
+                    const ignite::binary::BinaryFieldId& field,
+                    const T val,
+                    void(*func)(interop::InteropOutputStream*, T),
+                    const int8_t typ
+                );
+
                 /**
                  * Write a primitive array to stream.
                  *
@@ -1030,6 +1196,15 @@ namespace ignite
                  */
                 void WriteFieldId(const char* fieldName, int32_t fieldTypeId);
 
+                /**
+                 * Write field ID.
+                 *
+                 * @param fieldId Field ID.
+                 * @param fieldName Field name.
+                 * @param fieldTypeId Field type ID.
+                 */
+                void WriteFieldId(int32_t fieldId, const char* fieldName, int32_t fieldTypeId);
+
                 /**
                  * Write primitive value.
                  *
@@ -1043,6 +1218,26 @@ namespace ignite
                     stream->WriteInt8(hdr);
                     func(stream, obj);
                 }
+
+                /**
+                 * Write vector as primitive array.
+                 *
+                 * @param obj Vector.
+                 * @param func Stream function.
+                 * @param hdr Header.
+                 */
+                template<typename T>
+                void WriteVectorToArrayInternal(const std::vector<T>& obj,
+                    void(*func)(impl::interop::InteropOutputStream*, const T*, int32_t), const int8_t hdr)
+                {
+                    int32_t len = static_cast<int32_t>(obj.size());
+
+                    stream->WriteInt8(hdr);
+                    stream->WriteInt32(len);
+
+                    if (len > 0)
+                        func(stream, &obj[0], len);
+                }
             };
 
             template<>
@@ -1096,6 +1291,46 @@ namespace ignite
             template<>
             void IGNITE_IMPORT_EXPORT
             BinaryWriterImpl::WriteTopObject0<ignite::binary::BinaryWriter, std::string>(const std::string& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<int8_t> >(const std::vector<int8_t>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<bool> >(const std::vector<bool>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<int16_t> >(const std::vector<int16_t>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<uint16_t> >(const std::vector<uint16_t>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<int32_t> >(const std::vector<int32_t>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<int64_t> >(const std::vector<int64_t>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<float> >(const std::vector<float>& obj);
+
+            template<>
+            void IGNITE_IMPORT_EXPORT
+            BinaryWriterImpl::WriteTopObject0<
+                ignite::binary::BinaryWriter, std::vector<double> >(const std::vector<double>& obj);
         }
     }
 }
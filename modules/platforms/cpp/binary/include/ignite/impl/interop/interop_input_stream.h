@@ -69,6 +69,15 @@ namespace ignite
                  */
                 void ReadInt8Array(int8_t* res, int32_t len);
 
+                /**
+                 * Skip signed 8-byte int array returning pointer to it.
+                 * Pointer is valid while the memory is not modified.
+                 *
+                 * @param len Length.
+                 * @return Pointer to the array within the memory.
+                 */
+                const int8_t* ReadInt8ArrayView(int32_t len);
+
                 /**
                  * Read bool.
                  *
@@ -38,7 +38,12 @@ namespace ignite
         {
             return impl->ReadInt8Array(res, len);
         }
-        
+
+        BinaryInt8ArrayView BinaryRawReader::ReadInt8ArrayView()
+        {
+            return impl->ReadInt8ArrayView();
+        }
+
         bool BinaryRawReader::ReadBool()
         {
             return impl->ReadBool();
@@ -154,6 +159,11 @@ namespace ignite
             return impl->ReadString(res, len);
         }
 
+        BinaryStringView BinaryRawReader::ReadStringView()
+        {
+            return impl->ReadStringView();
+        }
+
         BinaryStringArrayReader BinaryRawReader::ReadStringArray()
         {
             int32_t size;
@@ -34,16 +34,36 @@ namespace ignite
             return impl->ReadInt8(fieldName);
         }
 
+        int8_t BinaryReader::ReadInt8(const BinaryFieldId& field)
+        {
+            return impl->ReadInt8(field);
+        }
+
         int32_t BinaryReader::ReadInt8Array(const char* fieldName, int8_t* res, int32_t len)
         {
             return impl->ReadInt8Array(fieldName, res, len);
         }
 
+        BinaryInt8ArrayView BinaryReader::ReadInt8ArrayView(const char* fieldName)
+        {
+            return impl->ReadInt8ArrayView(fieldName);
+        }
+
+        BinaryInt8ArrayView BinaryReader::ReadInt8ArrayView(const BinaryFieldId& field)
+        {
+            return impl->ReadInt8ArrayView(field);
+        }
+
         bool BinaryReader::ReadBool(const char* fieldName)
         {
             return impl->ReadBool(fieldName);
         }
 
+        bool BinaryReader::ReadBool(const BinaryFieldId& field)
+        {
+            return impl->ReadBool(field);
+        }
+
         int32_t BinaryReader::ReadBoolArray(const char* fieldName, bool* res, int32_t len)
         {
             return impl->ReadBoolArray(fieldName, res, len);
@@ -54,6 +74,11 @@ namespace ignite
             return impl->ReadInt16(fieldName);
         }
 
+        int16_t BinaryReader::ReadInt16(const BinaryFieldId& field)
+        {
+            return impl->ReadInt16(field);
+        }
+
         int32_t BinaryReader::ReadInt16Array(const char* fieldName, int16_t* res, int32_t len)
         {
             return impl->ReadInt16Array(fieldName, res, len);
@@ -64,6 +89,11 @@ namespace ignite
             return impl->ReadUInt16(fieldName);
         }
 
+        uint16_t BinaryReader::ReadUInt16(const BinaryFieldId& field)
+        {
+            return impl->ReadUInt16(field);
+        }
+
         int32_t BinaryReader::ReadUInt16Array(const char* fieldName, uint16_t* res, int32_t len)
         {
             return impl->ReadUInt16Array(fieldName, res, len);
@@ -74,6 +104,11 @@ namespace ignite
             return impl->ReadInt32(fieldName);
         }
 
+        int32_t BinaryReader::ReadInt32(const BinaryFieldId& field)
+        {
+            return impl->ReadInt32(field);
+        }
+
         int32_t BinaryReader::ReadInt32Array(const char* fieldName, int32_t* res, int32_t len)
         {
             return impl->ReadInt32Array(fieldName, res, len);
@@ -84,6 +119,11 @@ namespace ignite
             return impl->ReadInt64(fieldName);
         }
 
+        int64_t BinaryReader::ReadInt64(const BinaryFieldId& field)
+        {
+            return impl->ReadInt64(field);
+        }
+
         int32_t BinaryReader::ReadInt64Array(const char* fieldName, int64_t* res, int32_t len)
         {
             return impl->ReadInt64Array(fieldName, res, len);
@@ -94,6 +134,11 @@ namespace ignite
             return impl->ReadFloat(fieldName);
         }
 
+        float BinaryReader::ReadFloat(const BinaryFieldId& field)
+        {
+            return impl->ReadFloat(field);
+        }
+
         int32_t BinaryReader::ReadFloatArray(const char* fieldName, float* res, int32_t len)
         {
             return impl->ReadFloatArray(fieldName, res, len);
@@ -104,6 +149,11 @@ namespace ignite
             return impl->ReadDouble(fieldName);
         }
 
+        double BinaryReader::ReadDouble(const BinaryFieldId& field)
+        {
+            return impl->ReadDouble(field);
+        }
+
         int32_t BinaryReader::ReadDoubleArray(const char* fieldName, double* res, int32_t len)
         {
             return impl->ReadDoubleArray(fieldName, res, len);
@@ -154,6 +204,16 @@ namespace ignite
             return impl->ReadString(fieldName, res, len);
         }
 
+        BinaryStringView BinaryReader::ReadStringView(const char* fieldName)
+        {
+            return impl->ReadStringView(fieldName);
+        }
+
+        BinaryStringView BinaryReader::ReadStringView(const BinaryFieldId& field)
+        {
+            return impl->ReadStringView(field);
+        }
+
         BinaryStringArrayReader BinaryReader::ReadStringArray(const char* fieldName)
         {
             int32_t size;
@@ -34,6 +34,11 @@ namespace ignite
             impl->WriteInt8(fieldName, val);
         }
 
+        void BinaryWriter::WriteInt8(const BinaryFieldId& field, int8_t val)
+        {
+            impl->WriteInt8(field, val);
+        }
+
         void BinaryWriter::WriteInt8Array(const char* fieldName, const int8_t* val, int32_t len)
         {
             impl->WriteInt8Array(fieldName, val, len);
@@ -44,6 +49,11 @@ namespace ignite
             impl->WriteBool(fieldName, val);
         }
 
+        void BinaryWriter::WriteBool(const BinaryFieldId& field, bool val)
+        {
+            impl->WriteBool(field, val);
+        }
+
         void BinaryWriter::WriteBoolArray(const char* fieldName, const bool* val, int32_t len)
         {
             impl->WriteBoolArray(fieldName, val, len);
@@ -54,6 +64,11 @@ namespace ignite
             impl->WriteInt16(fieldName, val);
         }
 
+        void BinaryWriter::WriteInt16(const BinaryFieldId& field, int16_t val)
+        {
+            impl->WriteInt16(field, val);
+        }
+
         void BinaryWriter::WriteInt16Array(const char* fieldName, const int16_t* val, int32_t len)
         {
             impl->WriteInt16Array(fieldName, val, len);
@@ -64,6 +79,11 @@ namespace ignite
             impl->WriteUInt16(fieldName, val);
         }
 
+        void BinaryWriter::WriteUInt16(const BinaryFieldId& field, uint16_t val)
+        {
+            impl->WriteUInt16(field, val);
+        }
+
         void BinaryWriter::WriteUInt16Array(const char* fieldName, const uint16_t* val, int32_t len)
         {
             impl->WriteUInt16Array(fieldName, val, len);
@@ -74,6 +94,11 @@ namespace ignite
             impl->WriteInt32(fieldName, val);
         }
 
+        void BinaryWriter::WriteInt32(const BinaryFieldId& field, int32_t val)
+        {
+            impl->WriteInt32(field, val);
+        }
+
         void BinaryWriter::WriteInt32Array(const char* fieldName, const int32_t* val, int32_t len)
         {
             impl->WriteInt32Array(fieldName, val, len);
@@ -84,6 +109,11 @@ namespace ignite
             impl->WriteInt64(fieldName, val);
         }
 
+        void BinaryWriter::WriteInt64(const BinaryFieldId& field, int64_t val)
+        {
+            impl->WriteInt64(field, val);
+        }
+
         void BinaryWriter::WriteInt64Array(const char* fieldName, const int64_t* val, int32_t len)
         {
             impl->WriteInt64Array(fieldName, val, len);
@@ -94,6 +124,11 @@ namespace ignite
             impl->WriteFloat(fieldName, val);
         }
 
+        void BinaryWriter::WriteFloat(const BinaryFieldId& field, float val)
+        {
+            impl->WriteFloat(field, val);
+        }
+
         void BinaryWriter::WriteFloatArray(const char* fieldName, const float* val, int32_t len)
         {
             impl->WriteFloatArray(fieldName, val, len);
@@ -104,6 +139,11 @@ namespace ignite
             impl->WriteDouble(fieldName, val);
         }
 
+        void BinaryWriter::WriteDouble(const BinaryFieldId& field, double val)
+        {
+            impl->WriteDouble(field, val);
+        }
+
         void BinaryWriter::WriteDoubleArray(const char* fieldName, const double* val, int32_t len)
         {
             impl->WriteDoubleArray(fieldName, val, len);
@@ -162,6 +202,11 @@ namespace ignite
             impl->WriteString(fieldName, val, len);
         }
 
+        void BinaryWriter::WriteString(const BinaryFieldId& field, const char* val, int32_t len)
+        {
+            impl->WriteString(field, val, len);
+        }
+
         BinaryStringArrayWriter BinaryWriter::WriteStringArray(const char* fieldName)
         {
             int32_t id = impl->WriteStringArray(fieldName);
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "ignite/impl/binary/binary_common.h"
+#include "ignite/impl/binary/binary_handle_table.h"
+
+using namespace ignite::impl::interop;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            BinaryHandleTable::BinaryHandleTable() :
+                objects(),
+                handleCnt(0)
+            {
+                // No-op.
+            }
+
+            void BinaryHandleTable::Deduplicate(InteropOutputStream& stream, int32_t pos, int32_t hash,
+                int32_t handleCnt)
+            {
+                if (handleCnt != this->handleCnt)
+                    return;
+
+                int32_t len = stream.Position() - pos;
+                int64_t key = (static_cast<int64_t>(len) << 32) | static_cast<uint32_t>(hash);
+
+                const int8_t* data = stream.GetMemory()->Data();
+
+                std::pair<ObjectMap::iterator, ObjectMap::iterator> range = objects.equal_range(key);
+
+                for (ObjectMap::iterator it = range.first; it != range.second; ++it)
+                {
+                    int32_t prevPos = it->second;
+
+                    if (memcmp(data + prevPos, data + pos, len) != 0)
+                        continue;
+
+                    stream.Position(pos);
+
+                    stream.WriteInt8(IGNITE_HDR_HND);
+                    stream.WriteInt32(pos - prevPos);
+
+                    stream.Synchronize();
+
+                    ++this->handleCnt;
+
+                    return;
+                }
+
+                objects.insert(std::make_pair(key, pos));
+            }
+        }
+    }
+}
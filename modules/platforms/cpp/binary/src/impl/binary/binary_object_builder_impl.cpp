@@ -0,0 +1,498 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/impl/binary/binary_object_header.h>
+#include <ignite/impl/binary/binary_object_builder_impl.h>
+#include <ignite/impl/binary/binary_utils.h>
+
+using namespace ignite::impl::interop;
+using namespace ignite::impl::binary;
+
+namespace
+{
+    /**
+     * Initial capacity of the memory for the changed values.
+     */
+    const int32_t VALUES_INITIAL_CAP = 256;
+
+    /**
+     * Find handles within the serialized value.
+     *
+     * @param mem Memory.
+     * @param pos Value position.
+     * @param handles Positions of the found handles.
+     * @return Position right after the value.
+     */
+    int32_t FindHandles(InteropMemory& mem, int32_t pos, std::vector<int32_t>& handles)
+    {
+        int8_t hdr = BinaryUtils::ReadInt8(mem, pos);
+
+        switch (hdr)
+        {
+            case IGNITE_HDR_HND:
+            {
+                handles.push_back(pos);
+
+                return pos + 5;
+            }
+
+            case IGNITE_HDR_NULL:
+                return pos + 1;
+
+            case IGNITE_TYPE_BYTE:
+            case IGNITE_TYPE_BOOL:
+                return pos + 2;
+
+            case IGNITE_TYPE_SHORT:
+            case IGNITE_TYPE_CHAR:
+                return pos + 3;
+
+            case IGNITE_TYPE_INT:
+            case IGNITE_TYPE_FLOAT:
+                return pos + 5;
+
+            case IGNITE_TYPE_LONG:
+            case IGNITE_TYPE_DOUBLE:
+            case IGNITE_TYPE_DATE:
+            case IGNITE_TYPE_TIME:
+            case IGNITE_TYPE_ENUM:
+            case IGNITE_TYPE_BINARY_ENUM:
+                return pos + 9;
+
+            case IGNITE_TYPE_TIMESTAMP:
+                return pos + 13;
+
+            case IGNITE_TYPE_UUID:
+                return pos + 17;
+
+            case IGNITE_TYPE_STRING:
+            case IGNITE_TYPE_ARRAY_BYTE:
+            case IGNITE_TYPE_ARRAY_BOOL:
+            case IGNITE_TYPE_OPTM_MARSH:
+                return pos + 5 + std::max(BinaryUtils::ReadInt32(mem, pos + 1), 0);
+
+            case IGNITE_TYPE_ARRAY_SHORT:
+            case IGNITE_TYPE_ARRAY_CHAR:
+                return pos + 5 + std::max(BinaryUtils::ReadInt32(mem, pos + 1), 0) * 2;
+
+            case IGNITE_TYPE_ARRAY_INT:
+            case IGNITE_TYPE_ARRAY_FLOAT:
+                return pos + 5 + std::max(BinaryUtils::ReadInt32(mem, pos + 1), 0) * 4;
+
+            case IGNITE_TYPE_ARRAY_LONG:
+            case IGNITE_TYPE_ARRAY_DOUBLE:
+                return pos + 5 + std::max(BinaryUtils::ReadInt32(mem, pos + 1), 0) * 8;
+
+            case IGNITE_TYPE_DECIMAL:
+                return pos + 9 + BinaryUtils::ReadInt32(mem, pos + 5);
+
+            case IGNITE_TYPE_BINARY:
+            {
+                // Handles of the wrapped object are relative to its own array.
+                return pos + 9 + BinaryUtils::ReadInt32(mem, pos + 1);
+            }
+
+            case IGNITE_TYPE_ARRAY_STRING:
+            case IGNITE_TYPE_ARRAY_UUID:
+            case IGNITE_TYPE_ARRAY_DATE:
+            case IGNITE_TYPE_ARRAY_TIMESTAMP:
+            case IGNITE_TYPE_ARRAY_TIME:
+            case IGNITE_TYPE_ARRAY_DECIMAL:
+            case IGNITE_TYPE_ARRAY:
+            {
+                int32_t cnt = BinaryUtils::ReadInt32(mem, pos + 1);
+
+                pos += 5;
+
+                for (int32_t i = 0; i < cnt; ++i)
+                    pos = FindHandles(mem, pos, handles);
+
+                return pos;
+            }
+
+            case IGNITE_TYPE_COLLECTION:
+            case IGNITE_TYPE_MAP:
+            {
+                int32_t cnt = BinaryUtils::ReadInt32(mem, pos + 1);
+
+                if (hdr == IGNITE_TYPE_MAP)
+                    cnt *= 2;
+
+                // Skipping header, size and collection type.
+                pos += 6;
+
+                for (int32_t i = 0; i < cnt; ++i)
+                    pos = FindHandles(mem, pos, handles);
+
+                return pos;
+            }
+
+            case IGNITE_HDR_FULL:
+            {
+                BinaryObjectHeader header(mem.Data() + pos);
+
+                int32_t dataEnd = IGNITE_DFLT_HDR_LEN;
+
+                if (header.HasSchema())
+                {
+                    dataEnd = header.GetFlags() & IGNITE_BINARY_FLAG_HAS_RAW ?
+                        BinaryUtils::ReadInt32(mem, pos + header.GetLength() - 4) :
+                        header.GetFooterOffset();
+                }
+
+                // Field values are written one after another. Raw data is not inspected.
+                for (int32_t valPos = pos + IGNITE_DFLT_HDR_LEN; valPos < pos + dataEnd; )
+                    valPos = FindHandles(mem, valPos, handles);
+
+                return pos + header.GetLength();
+            }
+
+            default:
+            {
+                IGNITE_ERROR_FORMATTED_2(ignite::IgniteError::IGNITE_ERR_BINARY, "Invalid header", "position", pos,
+                    "unsupported type", static_cast<int>(hdr));
+            }
+        }
+    }
+
+    /**
+     * Compare fields by the value position.
+     */
+    template<typename F>
+    bool FieldPosLess(const F& one, const F& two)
+    {
+        return one.pos < two.pos;
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            BinaryObjectBuilderImpl::BinaryObjectBuilderImpl(const BinaryObjectImpl& obj) :
+                obj(obj),
+                values(VALUES_INITIAL_CAP),
+                changes()
+            {
+                BinaryObjectHeader header(obj.mem->Data() + obj.start);
+
+                if (header.GetFlags() & IGNITE_BINARY_FLAG_COMPACT_FOOTER)
+                {
+                    IGNITE_ERROR_2(ignite::IgniteError::IGNITE_ERR_BINARY,
+                        "Unsupported binary protocol flag: IGNITE_BINARY_FLAG_COMPACT_FOOTER: ",
+                        IGNITE_BINARY_FLAG_COMPACT_FOOTER);
+                }
+            }
+
+            void BinaryObjectBuilderImpl::RemoveField(const char* name)
+            {
+                SetField(GetFieldId(name), name, 0, -1);
+            }
+
+            BinaryObjectImpl BinaryObjectBuilderImpl::Build(InteropMemory& mem)
+            {
+                if (&mem == obj.mem)
+                {
+                    IGNITE_ERROR_1(ignite::IgniteError::IGNITE_ERR_BINARY,
+                        "Object can not be built in the memory of the original object.");
+                }
+
+                obj.CheckIdResolver();
+
+                BinaryObjectHeader header(obj.mem->Data() + obj.start);
+
+                std::vector<Field> fields;
+
+                GetFields(fields);
+
+                std::vector<CopiedValue> copied;
+
+                InteropOutputStream out(&mem);
+                BinaryWriterImpl writer(&out, obj.idRslvr, 0, 0, 0);
+
+                out.WriteInt8(IGNITE_HDR_FULL);
+                out.WriteInt8(IGNITE_PROTO_VER);
+                out.WriteInt16(IGNITE_BINARY_FLAG_USER_TYPE);
+                out.WriteInt32(header.GetTypeId());
+
+                int32_t hashPos = out.Reserve(4);
+
+                // Reserve space for the Object Length, Schema ID and Schema or Raw Offset.
+                out.Reserve(12);
+
+                for (size_t i = 0; i < fields.size(); ++i)
+                {
+                    const Change* change = FindChange(fields[i].id);
+
+                    if (!change)
+                        WriteOriginalField(writer, fields[i], copied);
+                    else if (change->len >= 0)
+                        writer.WriteFieldValue(change->id, values.Data() + change->pos, change->len);
+                }
+
+                for (size_t i = 0; i < changes.size(); ++i)
+                {
+                    const Change& change = changes[i];
+
+                    if (change.len < 0)
+                        continue;
+
+                    bool added = true;
+
+                    for (size_t j = 0; j < fields.size() && added; ++j)
+                        added = fields[j].id != change.id;
+
+                    if (added)
+                        writer.WriteFieldValue(change.id, values.Data() + change.pos, change.len);
+                }
+
+                if (header.GetFlags() & IGNITE_BINARY_FLAG_HAS_RAW)
+                {
+                    int32_t rawOff = header.HasSchema() ?
+                        BinaryUtils::ReadInt32(*obj.mem, obj.start + header.GetLength() - 4) :
+                        header.GetSchemaOffset();
+
+                    writer.SetRawMode();
+
+                    out.WriteInt8Array(obj.mem->Data() + obj.start + rawOff, header.GetFooterOffset() - rawOff);
+                }
+
+                writer.PostWrite();
+
+                out.Synchronize();
+
+                if (!header.IsUserType())
+                {
+                    int16_t flags = BinaryUtils::ReadInt16(mem, IGNITE_OFFSET_FLAGS);
+
+                    out.WriteInt16(IGNITE_OFFSET_FLAGS, flags & ~IGNITE_BINARY_FLAG_USER_TYPE);
+                }
+
+                BinaryObjectImpl res(mem, 0, obj.idRslvr, obj.metaMgr);
+
+                out.WriteInt32(hashPos, BinaryUtils::GetDataHashCode(res.GetData(), res.GetLength()));
+
+                SubmitMeta();
+
+                return res;
+            }
+
+            int32_t BinaryObjectBuilderImpl::GetFieldId(const char* name)
+            {
+                obj.CheckIdResolver();
+
+                return obj.idRslvr->GetFieldId(obj.GetTypeId(), name);
+            }
+
+            void BinaryObjectBuilderImpl::SetField(int32_t fieldId, const char* name, int32_t pos, int32_t len)
+            {
+                for (size_t i = 0; i < changes.size(); ++i)
+                {
+                    Change& change = changes[i];
+
+                    if (change.id == fieldId)
+                    {
+                        change.pos = pos;
+                        change.len = len;
+
+                        return;
+                    }
+                }
+
+                Change change;
+
+                change.id = fieldId;
+                change.name = name;
+                change.pos = pos;
+                change.len = len;
+
+                changes.push_back(change);
+            }
+
+            const BinaryObjectBuilderImpl::Change* BinaryObjectBuilderImpl::FindChange(int32_t fieldId) const
+            {
+                for (size_t i = 0; i < changes.size(); ++i)
+                {
+                    if (changes[i].id == fieldId)
+                        return &changes[i];
+                }
+
+                return 0;
+            }
+
+            void BinaryObjectBuilderImpl::GetFields(std::vector<Field>& fields) const
+            {
+                BinaryObjectHeader header(obj.mem->Data() + obj.start);
+
+                if (!header.HasSchema())
+                    return;
+
+                int16_t flags = header.GetFlags();
+
+                int32_t footerBegin = obj.start + header.GetFooterOffset();
+                int32_t footerEnd = obj.start + header.GetLength();
+
+                int32_t dataEnd = header.GetFooterOffset();
+
+                if (flags & IGNITE_BINARY_FLAG_HAS_RAW)
+                {
+                    footerEnd -= 4;
+
+                    dataEnd = BinaryUtils::ReadInt32(*obj.mem, footerEnd);
+                }
+
+                int32_t entrySize;
+
+                if (flags & IGNITE_BINARY_FLAG_OFFSET_ONE_BYTE)
+                    entrySize = 5;
+                else if (flags & IGNITE_BINARY_FLAG_OFFSET_TWO_BYTES)
+                    entrySize = 6;
+                else
+                    entrySize = 8;
+
+                for (int32_t schemaPos = footerBegin; schemaPos + entrySize <= footerEnd; schemaPos += entrySize)
+                {
+                    Field field;
+
+                    field.id = BinaryUtils::ReadInt32(*obj.mem, schemaPos);
+
+                    if (entrySize == 5)
+                        field.pos = BinaryUtils::ReadInt8(*obj.mem, schemaPos + 4) & 0xFF;
+                    else if (entrySize == 6)
+                        field.pos = BinaryUtils::ReadInt16(*obj.mem, schemaPos + 4) & 0xFFFF;
+                    else
+                        field.pos = BinaryUtils::ReadInt32(*obj.mem, schemaPos + 4);
+
+                    fields.push_back(field);
+                }
+
+                std::sort(fields.begin(), fields.end(), FieldPosLess<Field>);
+
+                // Value ends where the next one begins.
+                for (size_t i = 0; i < fields.size(); ++i)
+                {
+                    int32_t end = i + 1 < fields.size() ? fields[i + 1].pos : dataEnd;
+
+                    fields[i].len = end - fields[i].pos;
+                }
+            }
+
+            void BinaryObjectBuilderImpl::WriteOriginalField(BinaryWriterImpl& writer, const Field& field,
+                std::vector<CopiedValue>& copied) const
+            {
+                const int8_t* data = obj.mem->Data();
+
+                int32_t pos = obj.start + field.pos;
+                int32_t len = field.len;
+
+                // Handle is relative to its position, so the referred object is copied instead.
+                if (data[pos] == IGNITE_HDR_HND)
+                {
+                    int32_t objPos = pos - BinaryUtils::ReadInt32(*obj.mem, pos + 1);
+
+                    if (objPos >= 0 && objPos < pos && data[objPos] == IGNITE_HDR_FULL)
+                    {
+                        pos = objPos;
+                        len = BinaryUtils::ReadInt32(*obj.mem, objPos + IGNITE_OFFSET_LEN);
+                    }
+                }
+
+                InteropOutputStream& out = *writer.GetStream();
+
+                int32_t newPos = out.Position();
+
+                writer.WriteFieldValue(field.id, data + pos, len);
+
+                std::vector<int32_t> handles;
+
+                FindHandles(*obj.mem, pos, handles);
+
+                // Nested handle referring outside of the value is re-pointed to the copy of the referred object.
+                for (size_t i = 0; i < handles.size(); ++i)
+                {
+                    int32_t hndPos = handles[i];
+                    int32_t objPos = hndPos - BinaryUtils::ReadInt32(*obj.mem, hndPos + 1);
+
+                    if (objPos >= pos)
+                        continue;
+
+                    const CopiedValue* val = 0;
+
+                    for (size_t j = 0; j < copied.size() && !val; ++j)
+                    {
+                        if (objPos >= copied[j].pos && objPos < copied[j].pos + copied[j].len)
+                            val = &copied[j];
+                    }
+
+                    if (!val)
+                    {
+                        IGNITE_ERROR_2(ignite::IgniteError::IGNITE_ERR_BINARY,
+                            "Unchanged field refers to the value which is not copied to the built object: ", field.id);
+                    }
+
+                    int32_t newHndPos = newPos + (hndPos - pos);
+                    int32_t newObjPos = val->newPos + (objPos - val->pos);
+
+                    out.WriteInt32(newHndPos + 1, newHndPos - newObjPos);
+                }
+
+                CopiedValue val;
+
+                val.pos = pos;
+                val.len = len;
+                val.newPos = newPos;
+
+                copied.push_back(val);
+            }
+
+            void BinaryObjectBuilderImpl::SubmitMeta()
+            {
+                BinaryTypeManager* metaMgr = obj.metaMgr;
+
+                if (!metaMgr)
+                    return;
+
+                SPSnap snap = metaMgr->GetMeta(obj.GetTypeId());
+
+                if (!snap.Get())
+                    return;
+
+                common::concurrent::SharedPointer<BinaryTypeHandler> metaHnd =
+                    metaMgr->GetHandler(snap.Get()->GetTypeName(), snap.Get()->GetAffinityFieldName(), obj.GetTypeId());
+
+                for (size_t i = 0; i < changes.size(); ++i)
+                {
+                    const Change& change = changes[i];
+
+                    if (change.len < 0)
+                        continue;
+
+                    int8_t typeId = values.Data()[change.pos];
+
+                    if (typeId != IGNITE_HDR_NULL)
+                        metaHnd.Get()->OnFieldWritten(change.id, change.name.c_str(), typeId);
+                }
+
+                metaMgr->SubmitHandler(*metaHnd.Get());
+            }
+        }
+    }
+}
@@ -42,15 +42,15 @@ namespace ignite
                 int32_t footerBegin, int32_t footerEnd, BinaryOffsetType::Type schemaType) :
                 stream(stream), idRslvr(idRslvr), pos(pos), usrType(usrType), typeId(typeId),
                 hashCode(hashCode), len(len), rawOff(rawOff), rawMode(false), elemIdGen(0), elemId(0),
-                elemCnt(-1), elemRead(0), footerBegin(footerBegin), footerEnd(footerEnd), schemaType(schemaType)
+                elemCnt(-1), elemRead(0), elemRetPos(-1), footerBegin(footerBegin), footerEnd(footerEnd), schemaType(schemaType)
             {
                 // No-op.
             }
 
             BinaryReaderImpl::BinaryReaderImpl(InteropInputStream* stream) :
                 stream(stream), idRslvr(NULL), pos(0), usrType(false), typeId(0), hashCode(0), len(0),
-                rawOff(0), rawMode(true), elemIdGen(0), elemId(0), elemCnt(-1), elemRead(0), footerBegin(-1),
-                footerEnd(-1), schemaType(BinaryOffsetType::FOUR_BYTES)
+                rawOff(0), rawMode(true), elemIdGen(0), elemId(0), elemCnt(-1), elemRead(0), elemRetPos(-1),
+                footerBegin(-1), footerEnd(-1), schemaType(BinaryOffsetType::FOUR_BYTES)
             {
                 // No-op.
             }
@@ -70,11 +70,73 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadInt8, IGNITE_TYPE_BYTE, static_cast<int8_t>(0));
             }
 
+            int8_t BinaryReaderImpl::ReadInt8(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadInt8, IGNITE_TYPE_BYTE, static_cast<int8_t>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadInt8Array(const char* fieldName, int8_t* res, const int32_t len)
             {
                 return ReadArray<int8_t>(fieldName, res, len,BinaryUtils::ReadInt8Array, IGNITE_TYPE_ARRAY_BYTE);
             }
 
+            template<typename T>
+            BinaryView<T> BinaryReaderImpl::ReadViewInternal(const int8_t expHdr)
+            {
+                int8_t hdr = stream->ReadInt8();
+
+                if (hdr == expHdr)
+                {
+                    int32_t realLen = stream->ReadInt32();
+
+                    const int8_t* data = stream->ReadInt8ArrayView(realLen);
+
+                    return BinaryView<T>(reinterpret_cast<const T*>(data), realLen);
+                }
+
+                if (hdr != IGNITE_HDR_NULL)
+                    ThrowOnInvalidHeader(expHdr, hdr);
+
+                return BinaryView<T>();
+            }
+
+            template<typename T>
+            BinaryView<T> BinaryReaderImpl::ReadViewInternal(int32_t fieldPos, const int8_t expHdr)
+            {
+                if (fieldPos <= 0)
+                    return BinaryView<T>();
+
+                stream->Position(fieldPos);
+
+                return ReadViewInternal<T>(expHdr);
+            }
+
+            BinaryInt8ArrayView BinaryReaderImpl::ReadInt8ArrayView()
+            {
+                CheckRawMode(true);
+                CheckSingleMode(true);
+
+                return ReadViewInternal<int8_t>(IGNITE_TYPE_ARRAY_BYTE);
+            }
+
+            BinaryInt8ArrayView BinaryReaderImpl::ReadInt8ArrayView(const char* fieldName)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                int32_t fieldId = idRslvr->GetFieldId(typeId, fieldName);
+
+                return ReadViewInternal<int8_t>(FindField(fieldId), IGNITE_TYPE_ARRAY_BYTE);
+            }
+
+            BinaryInt8ArrayView BinaryReaderImpl::ReadInt8ArrayView(const BinaryFieldId& field)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                return ReadViewInternal<int8_t>(FindField(field.GetId()), IGNITE_TYPE_ARRAY_BYTE);
+            }
+
             bool BinaryReaderImpl::ReadBool()
             {
                 return ReadRaw<bool>(BinaryUtils::ReadBool);
@@ -90,6 +152,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadBool, IGNITE_TYPE_BOOL, static_cast<bool>(0));
             }
 
+            bool BinaryReaderImpl::ReadBool(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadBool, IGNITE_TYPE_BOOL, static_cast<bool>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadBoolArray(const char* fieldName, bool* res, const int32_t len)
             {
                 return ReadArray<bool>(fieldName, res, len,BinaryUtils::ReadBoolArray, IGNITE_TYPE_ARRAY_BOOL);
@@ -110,6 +177,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadInt16, IGNITE_TYPE_SHORT, static_cast<int16_t>(0));
             }
 
+            int16_t BinaryReaderImpl::ReadInt16(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadInt16, IGNITE_TYPE_SHORT, static_cast<int16_t>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadInt16Array(const char* fieldName, int16_t* res, const int32_t len)
             {
                 return ReadArray<int16_t>(fieldName, res, len, BinaryUtils::ReadInt16Array, IGNITE_TYPE_ARRAY_SHORT);
@@ -130,6 +202,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadUInt16, IGNITE_TYPE_CHAR, static_cast<uint16_t>(0));
             }
 
+            uint16_t BinaryReaderImpl::ReadUInt16(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadUInt16, IGNITE_TYPE_CHAR, static_cast<uint16_t>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadUInt16Array(const char* fieldName, uint16_t* res, const int32_t len)
             {
                 return ReadArray<uint16_t>(fieldName, res, len,BinaryUtils::ReadUInt16Array, IGNITE_TYPE_ARRAY_CHAR);
@@ -150,6 +227,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadInt32, IGNITE_TYPE_INT, static_cast<int32_t>(0));
             }
 
+            int32_t BinaryReaderImpl::ReadInt32(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadInt32, IGNITE_TYPE_INT, static_cast<int32_t>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadInt32Array(const char* fieldName, int32_t* res, const int32_t len)
             {
                 return ReadArray<int32_t>(fieldName, res, len,BinaryUtils::ReadInt32Array, IGNITE_TYPE_ARRAY_INT);
@@ -170,6 +252,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadInt64, IGNITE_TYPE_LONG, static_cast<int64_t>(0));
             }
 
+            int64_t BinaryReaderImpl::ReadInt64(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadInt64, IGNITE_TYPE_LONG, static_cast<int64_t>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadInt64Array(const char* fieldName, int64_t* res, const int32_t len)
             {
                 return ReadArray<int64_t>(fieldName, res, len,BinaryUtils::ReadInt64Array, IGNITE_TYPE_ARRAY_LONG);
@@ -190,6 +277,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadFloat, IGNITE_TYPE_FLOAT, static_cast<float>(0));
             }
 
+            float BinaryReaderImpl::ReadFloat(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadFloat, IGNITE_TYPE_FLOAT, static_cast<float>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadFloatArray(const char* fieldName, float* res, const int32_t len)
             {
                 return ReadArray<float>(fieldName, res, len,BinaryUtils::ReadFloatArray, IGNITE_TYPE_ARRAY_FLOAT);
@@ -210,6 +302,11 @@ namespace ignite
                 return Read(fieldName, BinaryUtils::ReadDouble, IGNITE_TYPE_DOUBLE, static_cast<double>(0));
             }
 
+            double BinaryReaderImpl::ReadDouble(const BinaryFieldId& field)
+            {
+                return Read(field, BinaryUtils::ReadDouble, IGNITE_TYPE_DOUBLE, static_cast<double>(0));
+            }
+
             int32_t BinaryReaderImpl::ReadDoubleArray(const char* fieldName, double* res, const int32_t len)
             {
                 return ReadArray<double>(fieldName, res, len,BinaryUtils::ReadDoubleArray, IGNITE_TYPE_ARRAY_DOUBLE);
@@ -489,6 +586,11 @@ namespace ignite
                 CheckRawMode(true);
                 CheckSingleMode(true);
 
+                ReadStringInternal(res);
+            }
+
+            void BinaryReaderImpl::ReadStringInternal(std::string& res)
+            {
                 int8_t hdr = stream->ReadInt8();
 
                 if (hdr == IGNITE_HDR_NULL)
@@ -526,6 +628,51 @@ namespace ignite
                 return realLen;
             }
 
+            void BinaryReaderImpl::ReadString(const BinaryFieldId& field, std::string& res)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                int32_t fieldPos = FindField(field.GetId());
+
+                if (fieldPos <= 0)
+                {
+                    res.clear();
+
+                    return;
+                }
+
+                stream->Position(fieldPos);
+
+                ReadStringInternal(res);
+            }
+
+            BinaryStringView BinaryReaderImpl::ReadStringView()
+            {
+                CheckRawMode(true);
+                CheckSingleMode(true);
+
+                return ReadViewInternal<char>(IGNITE_TYPE_STRING);
+            }
+
+            BinaryStringView BinaryReaderImpl::ReadStringView(const char* fieldName)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                int32_t fieldId = idRslvr->GetFieldId(typeId, fieldName);
+
+                return ReadViewInternal<char>(FindField(fieldId), IGNITE_TYPE_STRING);
+            }
+
+            BinaryStringView BinaryReaderImpl::ReadStringView(const BinaryFieldId& field)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                return ReadViewInternal<char>(FindField(field.GetId()), IGNITE_TYPE_STRING);
+            }
+
             int32_t BinaryReaderImpl::ReadStringArray(int32_t* size)
             {
                 return StartContainerSession(true, IGNITE_TYPE_ARRAY_STRING, size);
@@ -561,10 +708,12 @@ namespace ignite
 
                 int32_t posAfter = stream->Position();
 
-                if (posAfter > posBefore && ++elemRead == elemCnt) {
-                    elemId = 0;
-                    elemCnt = -1;
-                    elemRead = 0;
+                if (posAfter > posBefore)
+                {
+                    int32_t retPos = OnElementRead();
+
+                    if (retPos >= 0)
+                        stream->Position(retPos);
                 }
 
                 return realLen;
@@ -622,12 +771,13 @@ namespace ignite
 
             int32_t BinaryReaderImpl::ReadCollection(CollectionType::Type* typ, int32_t* size)
             {
-                int32_t id = StartContainerSession(true, IGNITE_TYPE_COLLECTION, size);
+                int8_t typ0;
+                int32_t id = StartContainerSession(true, IGNITE_TYPE_COLLECTION, size, &typ0);
 
                 if (*size == -1)
                     *typ = CollectionType::UNDEFINED;
                 else
-                    *typ = static_cast<CollectionType::Type>(stream->ReadInt8());
+                    *typ = static_cast<CollectionType::Type>(typ0);
 
                 return id;
             }
@@ -650,24 +800,26 @@ namespace ignite
 
                 stream->Position(fieldPos);
 
-                int32_t id = StartContainerSession(false, IGNITE_TYPE_COLLECTION, size);
+                int8_t typ0;
+                int32_t id = StartContainerSession(false, IGNITE_TYPE_COLLECTION, size, &typ0);
 
                 if (*size == -1)
                     *typ = CollectionType::UNDEFINED;
                 else
-                    *typ = static_cast<CollectionType::Type>(stream->ReadInt8());
+                    *typ = static_cast<CollectionType::Type>(typ0);
 
                 return id;
             }
 
             int32_t BinaryReaderImpl::ReadMap(MapType::Type* typ, int32_t* size)
             {
-                int32_t id = StartContainerSession(true, IGNITE_TYPE_MAP, size);
+                int8_t typ0;
+                int32_t id = StartContainerSession(true, IGNITE_TYPE_MAP, size, &typ0);
 
                 if (*size == -1)
                     *typ = MapType::UNDEFINED;
                 else
-                    *typ = static_cast<MapType::Type>(stream->ReadInt8());
+                    *typ = static_cast<MapType::Type>(typ0);
 
                 return id;
             }
@@ -690,12 +842,13 @@ namespace ignite
 
                 stream->Position(fieldPos);
 
-                int32_t id = StartContainerSession(false, IGNITE_TYPE_MAP, size);
+                int8_t typ0;
+                int32_t id = StartContainerSession(false, IGNITE_TYPE_MAP, size, &typ0);
 
                 if (*size == -1)
                     *typ = MapType::UNDEFINED;
                 else
-                    *typ = static_cast<MapType::Type>(stream->ReadInt8());
+                    *typ = static_cast<MapType::Type>(typ0);
 
                 return id;
             }
@@ -738,8 +891,16 @@ namespace ignite
 
             int32_t BinaryReaderImpl::ReadCollectionSizeUnprotected()
             {
+                int32_t pos = stream->Position();
                 int8_t hdr = stream->ReadInt8();
 
+                if (hdr == IGNITE_HDR_HND)
+                {
+                    FollowHandle(pos);
+
+                    hdr = stream->ReadInt8();
+                }
+
                 if (hdr != IGNITE_TYPE_COLLECTION)
                 {
                     if (hdr != IGNITE_HDR_NULL)
@@ -802,6 +963,12 @@ namespace ignite
                 int8_t hdr = stream->ReadInt8();
                 switch (hdr)
                 {
+                    case IGNITE_HDR_HND:
+                    {
+                        stream->Ignore(4); // Handle offset.
+                        return;
+                    }
+
                     case IGNITE_TYPE_BINARY:
                     {
                         int32_t portLen = stream->ReadInt32(); // Total length of binary object.
@@ -1095,6 +1262,18 @@ namespace ignite
                 }
             }
 
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<BinaryReader, BinaryStringView>(BinaryStringView& res)
+            {
+                res = ReadViewInternal<char>(IGNITE_TYPE_STRING);
+            }
+
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<BinaryReader, BinaryInt8ArrayView>(BinaryInt8ArrayView& res)
+            {
+                res = ReadViewInternal<int8_t>(IGNITE_TYPE_ARRAY_BYTE);
+            }
+
             template<>
             void BinaryReaderImpl::ReadTopObject0<
                     ignite::binary::BinaryReader, std::vector<int8_t> >(std::vector<int8_t>& res)
@@ -1123,6 +1302,49 @@ namespace ignite
                 ReadArrayToVectorInternal<int64_t>(res, stream, BinaryUtils::ReadInt64Array, IGNITE_TYPE_ARRAY_LONG);
             }
 
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<
+                    ignite::binary::BinaryReader, std::vector<bool> >(std::vector<bool>& res)
+            {
+                int8_t hdr = stream->ReadInt8();
+
+                if (hdr == IGNITE_TYPE_ARRAY_BOOL)
+                {
+                    // Elements of std::vector<bool> are not stored contiguously.
+                    int32_t realLen = stream->ReadInt32();
+
+                    res.resize(realLen);
+
+                    for (int32_t i = 0; i < realLen; ++i)
+                        res[i] = BinaryUtils::ReadBool(stream);
+                }
+                else if (hdr == IGNITE_HDR_NULL)
+                    res.clear();
+                else
+                    ThrowOnInvalidHeader(stream->Position() - 1, IGNITE_TYPE_ARRAY_BOOL, hdr);
+            }
+
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<
+                    ignite::binary::BinaryReader, std::vector<uint16_t> >(std::vector<uint16_t>& res)
+            {
+                ReadArrayToVectorInternal<uint16_t>(res, stream, BinaryUtils::ReadUInt16Array, IGNITE_TYPE_ARRAY_CHAR);
+            }
+
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<
+                    ignite::binary::BinaryReader, std::vector<float> >(std::vector<float>& res)
+            {
+                ReadArrayToVectorInternal<float>(res, stream, BinaryUtils::ReadFloatArray, IGNITE_TYPE_ARRAY_FLOAT);
+            }
+
+            template<>
+            void BinaryReaderImpl::ReadTopObject0<
+                    ignite::binary::BinaryReader, std::vector<double> >(std::vector<double>& res)
+            {
+                ReadArrayToVectorInternal<double>(res, stream, BinaryUtils::ReadDoubleArray, IGNITE_TYPE_ARRAY_DOUBLE);
+            }
+
             template <typename T>
             T BinaryReaderImpl::ReadTopObject0(const int8_t expHdr, T(*func)(InteropInputStream*))
             {
@@ -1193,6 +1415,46 @@ namespace ignite
                 return -1;
             }
 
+            void BinaryReaderImpl::CheckHandle(int32_t hndPos, int32_t objPos) const
+            {
+                if (objPos < 0 || objPos >= hndPos) {
+                    IGNITE_ERROR_2(IgniteError::IGNITE_ERR_BINARY, "Invalid handle offset: ", hndPos - objPos)
+                }
+
+                // Handle pointing to the enclosing object.
+                if (stream->ReadInt8(objPos) == IGNITE_HDR_FULL &&
+                    objPos + stream->ReadInt32(objPos + IGNITE_OFFSET_LEN) > hndPos) {
+                    IGNITE_ERROR_1(IgniteError::IGNITE_ERR_BINARY, "Circular references are not supported.")
+                }
+            }
+
+            int32_t BinaryReaderImpl::FollowHandle(int32_t hndPos)
+            {
+                int32_t objPos = hndPos - stream->ReadInt32();
+                int32_t retPos = stream->Position();
+
+                CheckHandle(hndPos, objPos);
+
+                stream->Position(objPos);
+
+                return retPos;
+            }
+
+            int32_t BinaryReaderImpl::OnElementRead()
+            {
+                if (++elemRead != elemCnt)
+                    return -1;
+
+                int32_t retPos = elemRetPos;
+
+                elemId = 0;
+                elemCnt = -1;
+                elemRead = 0;
+                elemRetPos = -1;
+
+                return retPos;
+            }
+
             void BinaryReaderImpl::CheckRawMode(bool expected) const
             {
                 if (expected && !rawMode) {
@@ -1215,28 +1477,48 @@ namespace ignite
                 }
             }
 
-            int32_t BinaryReaderImpl::StartContainerSession(bool expRawMode, int8_t expHdr, int32_t* size)
+            int32_t BinaryReaderImpl::StartContainerSession(bool expRawMode, int8_t expHdr, int32_t* size,
+                int8_t* typ)
             {
                 CheckRawMode(expRawMode);
                 CheckSingleMode(true);
 
+                int32_t pos = stream->Position();
                 int8_t hdr = stream->ReadInt8();
 
+                // Container written before is referenced by handle: read it in place
+                // and continue after the handle once the last element is read.
+                int32_t retPos = -1;
+
+                if (hdr == IGNITE_HDR_HND)
+                {
+                    retPos = FollowHandle(pos);
+
+                    hdr = stream->ReadInt8();
+                }
+
                 if (hdr == expHdr)
                 {
                     int32_t cnt = stream->ReadInt32();
 
+                    if (typ)
+                        *typ = stream->ReadInt8();
+
                     if (cnt != 0)
                     {
                         elemId = ++elemIdGen;
                         elemCnt = cnt;
                         elemRead = 0;
+                        elemRetPos = retPos;
 
                         *size = cnt;
 
                         return elemId;
                     }
 
+                    if (retPos >= 0)
+                        stream->Position(retPos);
+
                     *size = 0;
 
                     return ++elemIdGen;
@@ -1245,6 +1527,9 @@ namespace ignite
                 if (hdr != IGNITE_HDR_NULL)
                     ThrowOnInvalidHeader(expHdr, hdr);
 
+                if (retPos >= 0)
+                    stream->Position(retPos);
+
                 *size = -1;
 
                 return ++elemIdGen;
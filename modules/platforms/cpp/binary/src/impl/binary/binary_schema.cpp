@@ -32,14 +32,24 @@ namespace ignite
     {
         namespace binary
         {
-            BinarySchema::BinarySchema(): id(0), fieldsInfo(new FieldContainer())
+            BinarySchema::BinarySchema() :
+                id(0), fieldsNum(0), ownExtraFields(), extraFields(&ownExtraFields), extraBegin(0)
+            {
+                // No-op.
+            }
+
+            BinarySchema::BinarySchema(BinarySchema* parent) :
+                id(0), fieldsNum(0), ownExtraFields(),
+                extraFields(parent ? parent->extraFields : &ownExtraFields),
+                extraBegin(extraFields->size())
             {
                 // No-op.
             }
 
             BinarySchema::~BinarySchema()
             {
-                delete fieldsInfo;
+                // Release the shared storage if the object has not been completed.
+                Clear();
             }
 
             void BinarySchema::AddField(int32_t fieldId, int32_t offset)
@@ -63,16 +73,61 @@ namespace ignite
                 id = idAccumulator;
 
                 BinarySchemaFieldInfo info = { fieldId, offset };
-                fieldsInfo->push_back(info);
+
+                if (fieldsNum < INLINE_FIELDS_NUM)
+                    inlineFields[fieldsNum] = info;
+                else
+                    extraFields->push_back(info);
+
+                ++fieldsNum;
             }
 
             void BinarySchema::Write(interop::InteropOutputStream& out) const
             {
-                switch (GetType())
+                BinaryOffsetType::Type type = GetType();
+
+                int32_t inlineNum = fieldsNum < INLINE_FIELDS_NUM ? fieldsNum : INLINE_FIELDS_NUM;
+
+                WriteFields(out, type, inlineFields, inlineFields + inlineNum);
+
+                if (fieldsNum > INLINE_FIELDS_NUM)
+                {
+                    const BinarySchemaFieldInfo* extra = &(*extraFields)[extraBegin];
+
+                    WriteFields(out, type, extra, extra + (fieldsNum - INLINE_FIELDS_NUM));
+                }
+            }
+
+            void BinarySchema::Clear()
+            {
+                if (fieldsNum > INLINE_FIELDS_NUM)
+                    extraFields->resize(extraBegin);
+
+                id = 0;
+                fieldsNum = 0;
+            }
+
+            BinaryOffsetType::Type BinarySchema::GetType() const
+            {
+                int32_t maxOffset = GetLastField().offset;
+
+                if (maxOffset < 0x100)
+                    return BinaryOffsetType::ONE_BYTE;
+
+                if (maxOffset < 0x10000)
+                    return BinaryOffsetType::TWO_BYTES;
+
+                return BinaryOffsetType::FOUR_BYTES;
+            }
+
+            void BinarySchema::WriteFields(interop::InteropOutputStream& out, BinaryOffsetType::Type type,
+                const BinarySchemaFieldInfo* begin, const BinarySchemaFieldInfo* end)
+            {
+                switch (type)
                 {
                     case BinaryOffsetType::ONE_BYTE:
                     {
-                        for (FieldContainer::const_iterator i = fieldsInfo->begin(); i != fieldsInfo->end(); ++i)
+                        for (const BinarySchemaFieldInfo* i = begin; i != end; ++i)
                         {
                             out.WriteInt32(i->id);
                             out.WriteInt8(static_cast<int8_t>(i->offset));
@@ -82,7 +137,7 @@ namespace ignite
 
                     case BinaryOffsetType::TWO_BYTES:
                     {
-                        for (FieldContainer::const_iterator i = fieldsInfo->begin(); i != fieldsInfo->end(); ++i)
+                        for (const BinarySchemaFieldInfo* i = begin; i != end; ++i)
                         {
                             out.WriteInt32(i->id);
                             out.WriteInt16(static_cast<int16_t>(i->offset));
@@ -92,7 +147,7 @@ namespace ignite
 
                     case BinaryOffsetType::FOUR_BYTES:
                     {
-                        for (FieldContainer::const_iterator i = fieldsInfo->begin(); i != fieldsInfo->end(); ++i)
+                        for (const BinarySchemaFieldInfo* i = begin; i != end; ++i)
                         {
                             out.WriteInt32(i->id);
                             out.WriteInt32(i->offset);
@@ -108,28 +163,12 @@ namespace ignite
                 }
             }
 
-            bool BinarySchema::Empty() const
-            {
-                return fieldsInfo->empty();
-            }
-
-            void BinarySchema::Clear()
-            {
-                id = 0;
-                fieldsInfo->clear();
-            }
-
-            BinaryOffsetType::Type BinarySchema::GetType() const
+            const BinarySchema::BinarySchemaFieldInfo& BinarySchema::GetLastField() const
             {
-                int32_t maxOffset = fieldsInfo->back().offset;
-
-                if (maxOffset < 0x100)
-                    return BinaryOffsetType::ONE_BYTE;
-
-                if (maxOffset < 0x10000)
-                    return BinaryOffsetType::TWO_BYTES;
+                if (fieldsNum > INLINE_FIELDS_NUM)
+                    return extraFields->back();
 
-                return BinaryOffsetType::FOUR_BYTES;
+                return inlineFields[fieldsNum - 1];
             }
         }
     }
@@ -25,15 +25,20 @@ namespace ignite
     {
         namespace binary
         {
-            BinaryTypeHandler::BinaryTypeHandler(SPSnap snap) :
+            BinaryTypeHandler::BinaryTypeHandler(SPSnap snap, bool record) :
                 origin(snap),
-                updated()
+                updated(),
+                record(record),
+                plan(snap)
             {
                 // No-op.
             }
 
-            void BinaryTypeHandler::OnFieldWritten(int32_t fieldId, std::string fieldName, int32_t fieldTypeId)
+            void BinaryTypeHandler::OnFieldWritten(int32_t fieldId, const char* fieldName, int32_t fieldTypeId)
             {
+                if (record)
+                    plan.AddField(fieldId, fieldName);
+
                 if (!origin.Get() || !origin.Get()->ContainsFieldId(fieldId))
                 {
                     if (!updated.Get())
@@ -16,8 +16,6 @@
  */
 
 #include <vector>
-#include <map>
-#include <algorithm>
 
 #include <ignite/common/concurrent.h>
 
@@ -32,8 +30,9 @@ namespace ignite
         namespace binary
         {
             BinaryTypeManager::BinaryTypeManager() :
-                snapshots(new std::map<int32_t, SPSnap>),
+                snapshots(new BinaryTypeTable<SPSnap>),
                 pending(new std::vector<SPSnap>),
+                plans(new BinaryTypeTable<BinaryWritePlan>),
                 cs(),
                 updater(0),
                 pendingVer(0),
@@ -46,30 +45,36 @@ namespace ignite
             {
                 delete snapshots;
                 delete pending;
+                delete plans;
             }
 
             SharedPointer<BinaryTypeHandler> BinaryTypeManager::GetHandler(const std::string& typeName,
                 const std::string& affFieldName, int32_t typeId)
             {
+                // Write plan is recorded until there is one for the type.
+                bool record = !plans->Get(typeId);
+
+                const SPSnap* snap = snapshots->Get(typeId);
+
+                if (snap)
+                    return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(*snap, record));
+
                 { // Locking scope.
                     CsLockGuard guard(cs);
 
-                    std::map<int32_t, SPSnap>::iterator it = snapshots->find(typeId);
-                    if (it != snapshots->end())
-                        return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(it->second));
+                    // Pending snapshot could have been registered in the meantime.
+                    snap = snapshots->Get(typeId);
 
-                    for (size_t i = 0; i < pending->size(); ++i)
-                    {
-                        SPSnap& snap = (*pending)[i];
+                    if (!snap)
+                        snap = FindPending(typeId);
 
-                        if (snap.Get()->GetTypeId() == typeId)
-                            return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(snap));
-                    }
+                    if (snap)
+                        return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(*snap, record));
                 }
 
                 SPSnap snapshot = SPSnap(new Snap(typeName, affFieldName, typeId));
 
-                return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(snapshot));
+                return SharedPointer<BinaryTypeHandler>(new BinaryTypeHandler(snapshot, record));
             }
 
             void BinaryTypeManager::SubmitHandler(BinaryTypeHandler& hnd)
@@ -84,6 +89,41 @@ namespace ignite
 
                     ++pendingVer;
                 }
+                else if (hnd.GetWritePlan())
+                    AddWritePlan(*hnd.GetWritePlan());
+            }
+
+            const SPSnap* BinaryTypeManager::FindPending(int32_t typeId) const
+            {
+                for (size_t i = 0; i < pending->size(); ++i)
+                {
+                    const SPSnap& snap = (*pending)[i];
+
+                    if (snap.Get() && snap.Get()->GetTypeId() == typeId)
+                        return &snap;
+                }
+
+                return 0;
+            }
+
+            void BinaryTypeManager::AddWritePlan(const BinaryWritePlan& plan)
+            {
+                int32_t typeId = plan.GetTypeId();
+
+                // Plan is offered on every write until it is added, so checking
+                // without locking first.
+                if (plans->Get(typeId))
+                    return;
+
+                const SPSnap* snap = snapshots->Get(typeId);
+
+                if (!snap || !snap->Get() || !plan.IsCoveredBy(*snap->Get()))
+                    return;
+
+                CsLockGuard guard(cs);
+
+                if (!plans->Get(typeId))
+                    plans->Put(typeId, plan);
             }
 
             int32_t BinaryTypeManager::GetVersion() const
@@ -125,24 +165,26 @@ namespace ignite
                         return false; // Stop as we cannot move further.
                     }
 
-                    std::map<int32_t, SPSnap>::iterator elem = snapshots->lower_bound(pendingSnap->GetTypeId());
+                    int32_t typeId = pendingSnap->GetTypeId();
+
+                    const SPSnap* snap = snapshots->Get(typeId);
 
-                    if (elem == snapshots->end() || elem->first != pendingSnap->GetTypeId())
-                        snapshots->insert(elem, std::make_pair(pendingSnap->GetTypeId(), *it));
+                    if (!snap || !snap->Get())
+                        snapshots->Put(typeId, *it);
                     else
                     {
-                        // Temporary snapshot.
-                        SPSnap tmp;
-
-                        // Move all values from pending update.
-                        tmp.Swap(*it);
+                        // Registered snapshot is read without locking, so the
+                        // fields are merged into a new one.
+                        SPSnap merged(new Snap(*pendingSnap));
 
                         // Add old fields. Only non-existing values added.
-                        tmp.Get()->CopyFieldsFrom(elem->second.Get());
+                        merged.Get()->CopyFieldsFrom(snap->Get());
 
-                        // Move to snapshots storage.
-                        tmp.Swap(elem->second);
+                        snapshots->Put(typeId, merged);
                     }
+
+                    // Mark as processed.
+                    *it = SPSnap();
                 }
 
                 pending->clear();
@@ -161,34 +203,38 @@ namespace ignite
 
             SPSnap BinaryTypeManager::GetMeta(int32_t typeId)
             {
+                const SPSnap* snap = snapshots->Get(typeId);
+
+                if (snap && snap->Get())
+                    return *snap;
+
                 CsLockGuard guard(cs);
 
-                std::map<int32_t, SPSnap>::iterator it = snapshots->find(typeId);
+                snap = snapshots->Get(typeId);
 
-                if (it != snapshots->end() && it->second.Get())
-                    return it->second;
+                if (snap && snap->Get())
+                    return *snap;
 
-                for (size_t i = 0; i < pending->size(); ++i)
-                {
-                    SPSnap& snap = (*pending)[i];
+                snap = FindPending(typeId);
 
-                    if (snap.Get()->GetTypeId() == typeId)
-                        return snap;
-                }
+                if (snap)
+                    return *snap;
 
                 if (!updater)
                     throw IgniteError(IgniteError::IGNITE_ERR_BINARY, "Metadata updater is not available.");
 
                 IgniteError err;
 
-                SPSnap snap = updater->GetMeta(typeId, err);
+                SPSnap res = updater->GetMeta(typeId, err);
 
                 IgniteError::ThrowIfNeeded(err);
 
-                // Caching meta snapshot for faster access in future.
-                snapshots->insert(std::make_pair(typeId, snap));
+                // Caching meta snapshot for faster access in future. Unknown
+                // types are not cached, as each Put() retires the old entry.
+                if (res.Get())
+                    snapshots->Put(typeId, res);
 
-                return snap;
+                return res;
             }
         }
     }
@@ -17,6 +17,25 @@
 
 #include <time.h>
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define IGNITE_DATA_HASH_SSE2
+#       include <emmintrin.h>
+#   endif
+#   if defined(IGNITE_DATA_HASH_SSE2) && ((defined(_MSC_VER) && _MSC_VER >= 1700) || defined(__clang__) || \
+        (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#       define IGNITE_DATA_HASH_AVX2
+#       include <immintrin.h>
+#       ifdef _MSC_VER
+#           include <intrin.h>
+#           define IGNITE_TARGET_AVX2
+#       else
+#           include <cpuid.h>
+#           define IGNITE_TARGET_AVX2 __attribute__((target("avx2")))
+#       endif
+#   endif
+#endif
+
 #include "ignite/ignite_error.h"
 
 #include "ignite/impl/interop/interop.h"
@@ -28,6 +47,303 @@ using namespace ignite::binary;
 
 namespace
 {
+    /** Powers of 31 modulo 2^32. */
+    const uint32_t POW31[] = {
+        0x00000001, 0x0000001f, 0x000003c1, 0x0000745f, 0x000e1781, 0x01b4d89f, 0x34e63b41, 0x67e12cdf,
+        0x94446f01, 0xf449711f, 0x94e4b2c1, 0x07b1a55f, 0xee830681, 0xe1ddc99f, 0x59db6a41, 0xe191dddf,
+        0x50a9de01, 0xc491e21f, 0xcdaa61c1, 0xe7a1d65f, 0x0c98f581, 0x8685ba9f, 0x4a319941, 0xfc018edf,
+        0x84304d01, 0x01d9531f, 0x395110c1, 0xf0d1075f, 0x294fe481, 0x00acab9f, 0x14e8c841, 0x88303fdf,
+        0x7dd7bc01
+    };
+
+    /** Minimal data size hashed with vector instructions. */
+    const size_t MIN_VECTOR_HASH_SIZE = 64;
+
+    /**
+     * Data hash function. Continues Java-compatible hash code computation.
+     *
+     * @param bytes Data.
+     * @param size Data size.
+     * @param hash Hash code of the preceding data.
+     * @return Hash code.
+     */
+    typedef uint32_t (*DataHashFunc)(const int8_t* bytes, size_t size, uint32_t hash);
+
+    /**
+     * Scalar implementation of the data hash function.
+     *
+     * Several bytes are added at once using the powers of 31, so the
+     * multiplications do not depend on each other.
+     */
+    uint32_t DataHashScalar(const int8_t* bytes, size_t size, uint32_t hash)
+    {
+        size_t i = 0;
+
+        for (; i + 4 <= size; i += 4)
+        {
+            hash = hash * POW31[4] +
+                static_cast<uint32_t>(bytes[i]) * POW31[3] +
+                static_cast<uint32_t>(bytes[i + 1]) * POW31[2] +
+                static_cast<uint32_t>(bytes[i + 2]) * POW31[1] +
+                static_cast<uint32_t>(bytes[i + 3]);
+        }
+
+        for (; i < size; ++i)
+            hash = hash * 31 + static_cast<uint32_t>(bytes[i]);
+
+        return hash;
+    }
+
+#ifdef IGNITE_DATA_HASH_SSE2
+    /**
+     * Multiply 32-bit integers keeping the low 32 bits of the results.
+     * SSE2 only has unsigned 32 to 64 bit multiplication of the even lanes.
+     *
+     * @param a First operand.
+     * @param b Second operand.
+     * @return Result.
+     */
+    inline __m128i MulLo32(__m128i a, __m128i b)
+    {
+        __m128i even = _mm_mul_epu32(a, b);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+
+    /**
+     * SSE2 implementation of the data hash function.
+     *
+     * Byte j of every 16-byte block goes to the lane j, and every lane
+     * accumulates its bytes multiplied by 31^16 per block. Lanes are combined
+     * in the end with the weights 31^(15 - j). Preceding hash is put to the
+     * last lane, so it is multiplied by 31^16 per block too.
+     */
+    uint32_t DataHashSse2(const int8_t* bytes, size_t size, uint32_t hash)
+    {
+        const size_t blockSize = 16;
+        const size_t blocks = size / blockSize;
+
+        if (blocks == 0)
+            return DataHashScalar(bytes, size, hash);
+
+        const __m128i mul = _mm_set1_epi32(static_cast<int>(POW31[16]));
+
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        __m128i acc2 = _mm_setzero_si128();
+        __m128i acc3 = _mm_setr_epi32(0, 0, 0, static_cast<int>(hash));
+
+        for (size_t i = 0; i < blocks; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i * blockSize));
+
+            // Sign extension: byte is duplicated to the high half and shifted back.
+            __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+            __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8);
+
+            acc0 = _mm_add_epi32(MulLo32(acc0, mul), _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16));
+            acc1 = _mm_add_epi32(MulLo32(acc1, mul), _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16));
+            acc2 = _mm_add_epi32(MulLo32(acc2, mul), _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16));
+            acc3 = _mm_add_epi32(MulLo32(acc3, mul), _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16));
+        }
+
+        __m128i sum = MulLo32(acc0, _mm_setr_epi32(static_cast<int>(POW31[15]), static_cast<int>(POW31[14]),
+            static_cast<int>(POW31[13]), static_cast<int>(POW31[12])));
+
+        sum = _mm_add_epi32(sum, MulLo32(acc1, _mm_setr_epi32(static_cast<int>(POW31[11]),
+            static_cast<int>(POW31[10]), static_cast<int>(POW31[9]), static_cast<int>(POW31[8]))));
+
+        sum = _mm_add_epi32(sum, MulLo32(acc2, _mm_setr_epi32(static_cast<int>(POW31[7]),
+            static_cast<int>(POW31[6]), static_cast<int>(POW31[5]), static_cast<int>(POW31[4]))));
+
+        sum = _mm_add_epi32(sum, MulLo32(acc3, _mm_setr_epi32(static_cast<int>(POW31[3]),
+            static_cast<int>(POW31[2]), static_cast<int>(POW31[1]), static_cast<int>(POW31[0]))));
+
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        hash = static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+
+        return DataHashScalar(bytes + blocks * blockSize, size - blocks * blockSize, hash);
+    }
+#endif
+
+#ifdef IGNITE_DATA_HASH_AVX2
+    /**
+     * AVX2 implementation of the data hash function. Same as the SSE2 one
+     * with 32-byte blocks.
+     */
+    IGNITE_TARGET_AVX2 uint32_t DataHashAvx2(const int8_t* bytes, size_t size, uint32_t hash)
+    {
+        const size_t blockSize = 32;
+        const size_t blocks = size / blockSize;
+
+        if (blocks == 0)
+            return DataHashScalar(bytes, size, hash);
+
+        const __m256i mul = _mm256_set1_epi32(static_cast<int>(POW31[32]));
+
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256();
+        __m256i acc3 = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 0, static_cast<int>(hash));
+
+        for (size_t i = 0; i < blocks; ++i)
+        {
+            const int8_t* block = bytes + i * blockSize;
+
+            __m256i v0 = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(block)));
+            __m256i v1 = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(block + 8)));
+            __m256i v2 = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(block + 16)));
+            __m256i v3 = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(block + 24)));
+
+            acc0 = _mm256_add_epi32(_mm256_mullo_epi32(acc0, mul), v0);
+            acc1 = _mm256_add_epi32(_mm256_mullo_epi32(acc1, mul), v1);
+            acc2 = _mm256_add_epi32(_mm256_mullo_epi32(acc2, mul), v2);
+            acc3 = _mm256_add_epi32(_mm256_mullo_epi32(acc3, mul), v3);
+        }
+
+        __m256i weights[4];
+
+        for (int k = 0; k < 4; ++k)
+        {
+            const uint32_t* w = POW31 + 24 - 8 * k;
+
+            weights[k] = _mm256_setr_epi32(static_cast<int>(w[7]), static_cast<int>(w[6]),
+                static_cast<int>(w[5]), static_cast<int>(w[4]), static_cast<int>(w[3]),
+                static_cast<int>(w[2]), static_cast<int>(w[1]), static_cast<int>(w[0]));
+        }
+
+        __m256i sum = _mm256_mullo_epi32(acc0, weights[0]);
+
+        sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(acc1, weights[1]));
+        sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(acc2, weights[2]));
+        sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(acc3, weights[3]));
+
+        __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+
+        sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        hash = static_cast<uint32_t>(_mm_cvtsi128_si32(sum128));
+
+        return DataHashScalar(bytes + blocks * blockSize, size - blocks * blockSize, hash);
+    }
+
+    /**
+     * Check whether the processor and the OS support AVX2.
+     *
+     * @return True if AVX2 is supported.
+     */
+    bool IsAvx2Supported()
+    {
+        const uint32_t osxsaveBit = 1 << 27;
+        const uint32_t avxBit = 1 << 28;
+        const uint32_t avx2Bit = 1 << 5;
+
+        // XMM and YMM state should be enabled by the OS.
+        const uint64_t ymmState = 6;
+
+#ifdef _MSC_VER
+        int info[4];
+
+        __cpuid(info, 0);
+
+        if (info[0] < 7)
+            return false;
+
+        __cpuid(info, 1);
+
+        if ((info[2] & osxsaveBit) == 0 || (info[2] & avxBit) == 0)
+            return false;
+
+        if ((_xgetbv(0) & ymmState) != ymmState)
+            return false;
+
+        __cpuidex(info, 7, 0);
+
+        return (info[1] & avx2Bit) != 0;
+#else
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+
+        if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx) || eax < 7)
+            return false;
+
+        __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+
+        if ((ecx & osxsaveBit) == 0 || (ecx & avxBit) == 0)
+            return false;
+
+        uint32_t xcr0Lo = 0;
+        uint32_t xcr0Hi = 0;
+
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+
+        if ((xcr0Lo & ymmState) != ymmState)
+            return false;
+
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+        return (ebx & avx2Bit) != 0;
+#endif
+    }
+#endif
+
+    /**
+     * Select the fastest data hash function supported by the processor.
+     *
+     * @return Data hash function.
+     */
+    DataHashFunc SelectDataHashFunc()
+    {
+#ifdef IGNITE_DATA_HASH_AVX2
+        if (IsAvx2Supported())
+            return DataHashAvx2;
+#endif
+
+#ifdef IGNITE_DATA_HASH_SSE2
+        return DataHashSse2;
+#else
+        return DataHashScalar;
+#endif
+    }
+
+    /** Data hash function. Null until this translation unit is initialized. */
+    DataHashFunc dataHashFunc = SelectDataHashFunc();
+
+    /**
+     * Get data hash function of the specified implementation.
+     *
+     * @param impl Implementation.
+     * @return Data hash function or null if the implementation is not supported.
+     */
+    DataHashFunc GetDataHashFunc(DataHashImpl::Type impl)
+    {
+        switch (impl)
+        {
+            case DataHashImpl::SCALAR:
+                return DataHashScalar;
+
+#ifdef IGNITE_DATA_HASH_SSE2
+            case DataHashImpl::SSE2:
+                return DataHashSse2;
+#endif
+
+#ifdef IGNITE_DATA_HASH_AVX2
+            case DataHashImpl::AVX2:
+                return IsAvx2Supported() ? DataHashAvx2 : 0;
+#endif
+
+            default:
+                return 0;
+        }
+    }
+
     /**
      * Check if there is enough data in memory.
      * @throw IgniteError if there is not enough memory.
@@ -87,18 +403,40 @@ namespace ignite
             {
                 if (data)
                 {
-                    int32_t hash = 1;
-                    const int8_t* bytes = static_cast<const int8_t*>(data);
+                    DataHashFunc func = dataHashFunc;
 
-                    for (size_t i = 0; i < size; ++i)
-                        hash = 31 * hash + bytes[i];
+                    // Vector state setup does not pay off for short data. Function
+                    // may also be called during initialization of another translation unit.
+                    if (size < MIN_VECTOR_HASH_SIZE || !func)
+                        func = DataHashScalar;
 
-                    return hash;
+                    return static_cast<int32_t>(func(static_cast<const int8_t*>(data), size, 1));
                 }
 
                 return 0;
             }
 
+            int32_t BinaryUtils::GetDataHashCode(const void* data, size_t size, DataHashImpl::Type impl)
+            {
+                DataHashFunc func = GetDataHashFunc(impl);
+
+                if (!func)
+                {
+                    IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_UNSUPPORTED_OPERATION,
+                        "Data hash implementation is not supported", "impl", impl);
+                }
+
+                if (data)
+                    return static_cast<int32_t>(func(static_cast<const int8_t*>(data), size, 1));
+
+                return 0;
+            }
+
+            bool BinaryUtils::IsDataHashSupported(DataHashImpl::Type impl)
+            {
+                return GetDataHashFunc(impl) != 0;
+            }
+
             int8_t BinaryUtils::ReadInt8(InteropInputStream* stream)
             {
                 return stream->ReadInt8();
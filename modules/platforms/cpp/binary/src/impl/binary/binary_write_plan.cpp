@@ -0,0 +1,55 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/impl/binary/binary_write_plan.h"
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace binary
+        {
+            BinaryWritePlan::BinaryWritePlan(SPSnap snap) :
+                snap(snap),
+                fields()
+            {
+                // No-op.
+            }
+
+            void BinaryWritePlan::AddField(int32_t fieldId, const char* fieldName)
+            {
+                Field field;
+
+                field.name = fieldName;
+                field.id = fieldId;
+
+                fields.push_back(field);
+            }
+
+            bool BinaryWritePlan::IsCoveredBy(const Snap& snap) const
+            {
+                for (std::vector<Field>::const_iterator it = fields.begin(); it != fields.end(); ++it)
+                {
+                    if (!snap.ContainsFieldId(it->id))
+                        return false;
+                }
+
+                return true;
+            }
+        }
+    }
+}
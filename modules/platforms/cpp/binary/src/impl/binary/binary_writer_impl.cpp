@@ -31,16 +31,20 @@ namespace ignite
         namespace binary
         {
             BinaryWriterImpl::BinaryWriterImpl(InteropOutputStream* stream, BinaryIdResolver* idRslvr, 
-                BinaryTypeManager* metaMgr, BinaryTypeHandler* metaHnd, int32_t start) :
-                stream(stream), idRslvr(idRslvr), metaMgr(metaMgr), metaHnd(metaHnd), typeId(idRslvr->GetTypeId()),
-                elemIdGen(0), elemId(0), elemCnt(0), elemPos(-1), rawPos(-1), start(start)
+                BinaryTypeManager* metaMgr, BinaryTypeHandler* metaHnd, int32_t start, const BinaryWritePlan* plan,
+                BinaryWriterImpl* parent) :
+                stream(stream), idRslvr(idRslvr), metaMgr(metaMgr), metaHnd(metaHnd), planMissHnd(), plan(plan),
+                planPos(0), typeId(idRslvr->GetTypeId()), elemIdGen(0), elemId(0), elemCnt(0), elemPos(-1),
+                rawPos(-1), schema(parent ? &parent->schema : 0), start(start), handleTable(),
+                handles(parent && parent->handles ? parent->handles : &handleTable)
             {
                 // No-op.
             }
             
             BinaryWriterImpl::BinaryWriterImpl(InteropOutputStream* stream, BinaryTypeManager* metaMgr) :
-                stream(stream), idRslvr(NULL), metaMgr(metaMgr), metaHnd(NULL), typeId(0), 
-                elemIdGen(0), elemId(0), elemCnt(0), elemPos(-1), rawPos(0), start(stream->Position())
+                stream(stream), idRslvr(NULL), metaMgr(metaMgr), metaHnd(NULL), planMissHnd(), plan(NULL),
+                planPos(0), typeId(0), elemIdGen(0), elemId(0), elemCnt(0), elemPos(-1), rawPos(0),
+                start(stream->Position()), handleTable(), handles(NULL)
             {
                 // No-op.
             }
@@ -60,6 +64,11 @@ namespace ignite
                 WritePrimitive<int8_t>(fieldName, val, BinaryUtils::WriteInt8, IGNITE_TYPE_BYTE, 1);
             }
 
+            void BinaryWriterImpl::WriteInt8(const BinaryFieldId& field, const int8_t val)
+            {
+                WritePrimitive<int8_t>(field, val, BinaryUtils::WriteInt8, IGNITE_TYPE_BYTE);
+            }
+
             void BinaryWriterImpl::WriteInt8Array(const char* fieldName, const int8_t* val, const int32_t len)
             {
                 WritePrimitiveArray<int8_t>(fieldName, val, len, BinaryUtils::WriteInt8Array, IGNITE_TYPE_ARRAY_BYTE, 0);
@@ -80,6 +89,11 @@ namespace ignite
                 WritePrimitive<bool>(fieldName, val, BinaryUtils::WriteBool, IGNITE_TYPE_BOOL, 1);
             }
 
+            void BinaryWriterImpl::WriteBool(const BinaryFieldId& field, const bool val)
+            {
+                WritePrimitive<bool>(field, val, BinaryUtils::WriteBool, IGNITE_TYPE_BOOL);
+            }
+
             void BinaryWriterImpl::WriteBoolArray(const char* fieldName, const bool* val, const int32_t len)
             {
                 WritePrimitiveArray<bool>(fieldName, val, len, BinaryUtils::WriteBoolArray, IGNITE_TYPE_ARRAY_BOOL, 0);
@@ -100,6 +114,11 @@ namespace ignite
                 WritePrimitive<int16_t>(fieldName, val, BinaryUtils::WriteInt16, IGNITE_TYPE_SHORT, 2);
             }
 
+            void BinaryWriterImpl::WriteInt16(const BinaryFieldId& field, const int16_t val)
+            {
+                WritePrimitive<int16_t>(field, val, BinaryUtils::WriteInt16, IGNITE_TYPE_SHORT);
+            }
+
             void BinaryWriterImpl::WriteInt16Array(const char* fieldName, const int16_t* val, const int32_t len)
             {
                 WritePrimitiveArray<int16_t>(fieldName, val, len, BinaryUtils::WriteInt16Array, IGNITE_TYPE_ARRAY_SHORT, 1);
@@ -120,6 +139,11 @@ namespace ignite
                 WritePrimitive<uint16_t>(fieldName, val, BinaryUtils::WriteUInt16, IGNITE_TYPE_CHAR, 2);
             }
 
+            void BinaryWriterImpl::WriteUInt16(const BinaryFieldId& field, const uint16_t val)
+            {
+                WritePrimitive<uint16_t>(field, val, BinaryUtils::WriteUInt16, IGNITE_TYPE_CHAR);
+            }
+
             void BinaryWriterImpl::WriteUInt16Array(const char* fieldName, const uint16_t* val, const int32_t len)
             {
                 WritePrimitiveArray<uint16_t>(fieldName, val, len, BinaryUtils::WriteUInt16Array, IGNITE_TYPE_ARRAY_CHAR, 1);
@@ -140,6 +164,11 @@ namespace ignite
                 WritePrimitive<int32_t>(fieldName, val, BinaryUtils::WriteInt32, IGNITE_TYPE_INT, 4);
             }
 
+            void BinaryWriterImpl::WriteInt32(const BinaryFieldId& field, const int32_t val)
+            {
+                WritePrimitive<int32_t>(field, val, BinaryUtils::WriteInt32, IGNITE_TYPE_INT);
+            }
+
             void BinaryWriterImpl::WriteInt32Array(const char* fieldName, const int32_t* val, const int32_t len)
             {
                 WritePrimitiveArray<int32_t>(fieldName, val, len, BinaryUtils::WriteInt32Array, IGNITE_TYPE_ARRAY_INT, 2);
@@ -160,6 +189,11 @@ namespace ignite
                 WritePrimitive<int64_t>(fieldName, val, BinaryUtils::WriteInt64, IGNITE_TYPE_LONG, 8);
             }
 
+            void BinaryWriterImpl::WriteInt64(const BinaryFieldId& field, const int64_t val)
+            {
+                WritePrimitive<int64_t>(field, val, BinaryUtils::WriteInt64, IGNITE_TYPE_LONG);
+            }
+
             void BinaryWriterImpl::WriteInt64Array(const char* fieldName, const int64_t* val, const int32_t len)
             {
                 WritePrimitiveArray<int64_t>(fieldName, val, len, BinaryUtils::WriteInt64Array, IGNITE_TYPE_ARRAY_LONG, 3);
@@ -180,6 +214,11 @@ namespace ignite
                 WritePrimitive<float>(fieldName, val, BinaryUtils::WriteFloat, IGNITE_TYPE_FLOAT, 4);
             }
 
+            void BinaryWriterImpl::WriteFloat(const BinaryFieldId& field, const float val)
+            {
+                WritePrimitive<float>(field, val, BinaryUtils::WriteFloat, IGNITE_TYPE_FLOAT);
+            }
+
             void BinaryWriterImpl::WriteFloatArray(const char* fieldName, const float* val, const int32_t len)
             {
                 WritePrimitiveArray<float>(fieldName, val, len, BinaryUtils::WriteFloatArray, IGNITE_TYPE_ARRAY_FLOAT, 2);
@@ -200,6 +239,11 @@ namespace ignite
                 WritePrimitive<double>(fieldName, val, BinaryUtils::WriteDouble, IGNITE_TYPE_DOUBLE, 8);
             }
 
+            void BinaryWriterImpl::WriteDouble(const BinaryFieldId& field, const double val)
+            {
+                WritePrimitive<double>(field, val, BinaryUtils::WriteDouble, IGNITE_TYPE_DOUBLE);
+            }
+
             void BinaryWriterImpl::WriteDoubleArray(const char* fieldName, const double* val, const int32_t len)
             {
                 WritePrimitiveArray<double>(fieldName, val, len, BinaryUtils::WriteDoubleArray, IGNITE_TYPE_ARRAY_DOUBLE, 3);
@@ -483,6 +527,23 @@ namespace ignite
                     stream->WriteInt8(IGNITE_HDR_NULL);
             }
 
+            void BinaryWriterImpl::WriteString(const BinaryFieldId& field, const char* val, const int32_t len)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                WriteFieldId(field.GetId(), field.GetName(), IGNITE_TYPE_STRING);
+
+                if (val)
+                {
+                    stream->WriteInt8(IGNITE_TYPE_STRING);
+
+                    BinaryUtils::WriteString(stream, val, len);
+                }
+                else
+                    stream->WriteInt8(IGNITE_HDR_NULL);
+            }
+
             int32_t BinaryWriterImpl::WriteStringArray()
             {
                 StartContainerSession(true);
@@ -658,6 +719,16 @@ namespace ignite
                 return rawPos == -1 ? stream->Position() : rawPos;
             }
 
+            void BinaryWriterImpl::WriteFieldValue(int32_t fieldId, const int8_t* val, int32_t len)
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                schema.AddField(fieldId, stream->Position() - start);
+
+                stream->WriteInt8Array(val, len);
+            }
+
             template<typename T>
             void BinaryWriterImpl::WritePrimitiveRaw(
                 const T val,
@@ -710,6 +781,24 @@ namespace ignite
                 func(stream, val);
             }
 
+            template<typename T>
+            void BinaryWriterImpl::WritePrimitive(
+                const BinaryFieldId& field,
+                const T val,
+                void(*func)(interop::InteropOutputStream*, T),
+                const int8_t typ
+            )
+            {
+                CheckRawMode(false);
+                CheckSingleMode(true);
+
+                WriteFieldId(field.GetId(), field.GetName(), typ);
+
+                stream->WriteInt8(typ);
+
+                func(stream, val);
+            }
+
             template<typename T>
             void BinaryWriterImpl::WritePrimitiveArray(
                 const char* fieldName,
@@ -778,7 +867,34 @@ namespace ignite
 
             void BinaryWriterImpl::WriteFieldId(const char* fieldName, int32_t fieldTypeId)
             {
-                int32_t fieldId = idRslvr->GetFieldId(typeId, fieldName);
+                if (!fieldName)
+                    IGNITE_ERROR_1(IgniteError::IGNITE_ERR_BINARY, "Field name cannot be NULL.");
+
+                int32_t fieldId;
+
+                if (!plan || !plan->GetFieldId(planPos, fieldName, fieldId))
+                    fieldId = idRslvr->GetFieldId(typeId, fieldName);
+
+                WriteFieldId(fieldId, fieldName, fieldTypeId);
+            }
+
+            void BinaryWriterImpl::WriteFieldId(int32_t fieldId, const char* fieldName, int32_t fieldTypeId)
+            {
+                if (!fieldName)
+                    IGNITE_ERROR_1(IgniteError::IGNITE_ERR_BINARY, "Field name cannot be NULL.");
+
+                if (plan && !plan->Matches(planPos++, fieldId))
+                {
+                    // Fields written so far are registered, so the updates
+                    // are only tracked from now on.
+                    const Snap& snap = plan->GetSnapshot();
+
+                    planMissHnd = metaMgr->GetHandler(snap.GetTypeName(), snap.GetAffinityFieldName(), typeId);
+                    metaHnd = planMissHnd.Get();
+
+                    plan = 0;
+                }
+
                 int32_t fieldOff = stream->Position() - start;
 
                 schema.AddField(fieldId, fieldOff);
@@ -871,6 +987,69 @@ namespace ignite
                 BinaryUtils::WriteString(stream, obj0, len);
             }
 
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<int8_t> >(const std::vector<int8_t>& obj)
+            {
+                WriteVectorToArrayInternal<int8_t>(obj, BinaryUtils::WriteInt8Array, IGNITE_TYPE_ARRAY_BYTE);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<bool> >(const std::vector<bool>& obj)
+            {
+                // Elements of std::vector<bool> are not stored contiguously.
+                int32_t len = static_cast<int32_t>(obj.size());
+
+                stream->WriteInt8(IGNITE_TYPE_ARRAY_BOOL);
+                stream->WriteInt32(len);
+
+                for (int32_t i = 0; i < len; ++i)
+                    BinaryUtils::WriteBool(stream, obj[i]);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<int16_t> >(const std::vector<int16_t>& obj)
+            {
+                WriteVectorToArrayInternal<int16_t>(obj, BinaryUtils::WriteInt16Array, IGNITE_TYPE_ARRAY_SHORT);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<uint16_t> >(const std::vector<uint16_t>& obj)
+            {
+                WriteVectorToArrayInternal<uint16_t>(obj, BinaryUtils::WriteUInt16Array, IGNITE_TYPE_ARRAY_CHAR);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<int32_t> >(const std::vector<int32_t>& obj)
+            {
+                WriteVectorToArrayInternal<int32_t>(obj, BinaryUtils::WriteInt32Array, IGNITE_TYPE_ARRAY_INT);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<int64_t> >(const std::vector<int64_t>& obj)
+            {
+                WriteVectorToArrayInternal<int64_t>(obj, BinaryUtils::WriteInt64Array, IGNITE_TYPE_ARRAY_LONG);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<float> >(const std::vector<float>& obj)
+            {
+                WriteVectorToArrayInternal<float>(obj, BinaryUtils::WriteFloatArray, IGNITE_TYPE_ARRAY_FLOAT);
+            }
+
+            template<>
+            void BinaryWriterImpl::WriteTopObject0<
+                    ignite::binary::BinaryWriter, std::vector<double> >(const std::vector<double>& obj)
+            {
+                WriteVectorToArrayInternal<double>(obj, BinaryUtils::WriteDoubleArray, IGNITE_TYPE_ARRAY_DOUBLE);
+            }
+
             void BinaryWriterImpl::PostWrite()
             {
                 int32_t lenWithoutSchema = stream->Position() - start;
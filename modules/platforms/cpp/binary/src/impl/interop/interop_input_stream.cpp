@@ -85,6 +85,17 @@ namespace ignite
                 IGNITE_INTEROP_IN_READ_ARRAY(len, 0);
             }
 
+            const int8_t* InteropInputStream::ReadInt8ArrayView(const int32_t len)
+            {
+                EnsureEnoughData(len);
+
+                const int8_t* res = data + pos;
+
+                Shift(len);
+
+                return res;
+            }
+
             bool InteropInputStream::ReadBool()
             {
                 return ReadInt8() == 1;
@@ -152,8 +152,7 @@ namespace ignite
 
             void InteropOutputStream::WriteFloatArray(const float* val, const int32_t len)
             {
-                for (int i = 0; i < len; i++)
-                    WriteFloat(*(val + i));
+                IGNITE_INTEROP_OUT_WRITE_ARRAY(val, len << 2);
             }
 
             void InteropOutputStream::WriteDouble(const double val)
@@ -167,8 +166,7 @@ namespace ignite
 
             void InteropOutputStream::WriteDoubleArray(const double* val, const int32_t len)
             {
-                for (int i = 0; i < len; i++)
-                    WriteDouble(*(val + i));
+                IGNITE_INTEROP_OUT_WRITE_ARRAY(val, len << 3);
             }
 
             int32_t InteropOutputStream::Position() const
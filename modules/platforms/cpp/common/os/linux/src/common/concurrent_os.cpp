@@ -236,6 +236,16 @@ namespace ignite
             {
                 pthread_join(thread, 0);
             }
+
+            void Thread::Detach()
+            {
+                pthread_detach(thread);
+            }
+
+            bool Thread::IsCurrent() const
+            {
+                return pthread_equal(thread, pthread_self()) != 0;
+            }
         }
     }
 }
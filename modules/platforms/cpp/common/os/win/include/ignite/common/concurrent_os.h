@@ -632,6 +632,18 @@ namespace ignite
                  */
                 virtual void Join();
 
+                /**
+                 * Detach thread. Thread can not be joined after that.
+                 */
+                void Detach();
+
+                /**
+                 * Check whether the thread is the calling one.
+                 *
+                 * @return True if called from the thread.
+                 */
+                bool IsCurrent() const;
+
             private:
                 /**
                  * Routine.
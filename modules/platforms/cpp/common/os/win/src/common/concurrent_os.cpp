@@ -239,6 +239,18 @@ namespace ignite
             {
                 WaitForSingleObject(handle, INFINITE);
             }
+
+            void Thread::Detach()
+            {
+                CloseHandle(handle);
+
+                handle = NULL;
+            }
+
+            bool Thread::IsCurrent() const
+            {
+                return handle != NULL && GetThreadId(handle) == GetCurrentThreadId();
+            }
         }
     }
 }
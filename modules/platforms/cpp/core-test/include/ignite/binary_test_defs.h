@@ -18,6 +18,8 @@
 #ifndef _IGNITE_BINARY_TEST_DEFS
 #define _IGNITE_BINARY_TEST_DEFS
 
+#include <algorithm>
+#include <sstream>
 #include <stdexcept>
 #include <stdint.h>
 
@@ -86,6 +88,27 @@ namespace ignite_test
                 }
             };
 
+            struct OptionalField
+            {
+                int32_t val;
+                int32_t extra;
+
+                OptionalField() : val(0), extra(0)
+                {
+                    // No-op.
+                }
+
+                OptionalField(int32_t val, int32_t extra) : val(val), extra(extra)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const OptionalField& one, const OptionalField& two)
+                {
+                    return one.val == two.val && one.extra == two.extra;
+                }
+            };
+
             struct PureRaw
             {
                 std::string val1;
@@ -151,6 +174,166 @@ namespace ignite_test
                 TestEnum::Type enumField;
                 std::string strField;
             };
+
+            struct BinaryAddress
+            {
+                std::string street;
+                int32_t house;
+
+                BinaryAddress() : street(), house(0)
+                {
+                    // No-op.
+                }
+
+                BinaryAddress(const std::string& street, int32_t house) : street(street), house(house)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const BinaryAddress& one, const BinaryAddress& two)
+                {
+                    return one.street == two.street && one.house == two.house;
+                }
+            };
+
+            struct BinaryPerson
+            {
+                std::string name;
+                BinaryAddress home;
+                BinaryAddress work;
+
+                BinaryPerson() : name(), home(), work()
+                {
+                    // No-op.
+                }
+
+                BinaryPerson(const std::string& name, const BinaryAddress& home, const BinaryAddress& work) :
+                    name(name), home(home), work(work)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const BinaryPerson& one, const BinaryPerson& two)
+                {
+                    return one.name == two.name && one.home == two.home && one.work == two.work;
+                }
+            };
+
+            struct BinaryCompany
+            {
+                std::string name;
+                BinaryAddress address;
+
+                BinaryCompany() : name(), address()
+                {
+                    // No-op.
+                }
+
+                BinaryCompany(const std::string& name, const BinaryAddress& address) :
+                    name(name), address(address)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const BinaryCompany& one, const BinaryCompany& two)
+                {
+                    return one.name == two.name && one.address == two.address;
+                }
+            };
+
+            struct BinaryEmployee
+            {
+                BinaryAddress home;
+                std::string name;
+                BinaryCompany company;
+
+                BinaryEmployee() : home(), name(), company()
+                {
+                    // No-op.
+                }
+
+                BinaryEmployee(const BinaryAddress& home, const std::string& name, const BinaryCompany& company) :
+                    home(home), name(name), company(company)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const BinaryEmployee& one, const BinaryEmployee& two)
+                {
+                    return one.home == two.home && one.name == two.name && one.company == two.company;
+                }
+            };
+
+            struct DeclaredFields
+            {
+                int32_t id;
+                std::string name;
+                double weight;
+                ignite::Guid guid;
+                BinaryAddress address;
+
+                DeclaredFields() : id(0), name(), weight(0), guid(), address()
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const DeclaredFields& one, const DeclaredFields& two)
+                {
+                    return one.id == two.id && one.name == two.name && one.weight == two.weight &&
+                        one.guid == two.guid && one.address == two.address;
+                }
+            };
+
+            struct DeclaredRawFields
+            {
+                int32_t id;
+                std::string name;
+                BinaryAddress address;
+
+                DeclaredRawFields() : id(0), name(), address()
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const DeclaredRawFields& one, const DeclaredRawFields& two)
+                {
+                    return one.id == two.id && one.name == two.name && one.address == two.address;
+                }
+            };
+
+            struct BinaryWide
+            {
+                enum { FIELDS_NUM = 20 };
+
+                int32_t vals[FIELDS_NUM];
+
+                BinaryWide()
+                {
+                    std::fill(vals, vals + FIELDS_NUM, 0);
+                }
+
+                friend bool operator==(const BinaryWide& one, const BinaryWide& two)
+                {
+                    return std::equal(one.vals, one.vals + FIELDS_NUM, two.vals);
+                }
+            };
+
+            struct BinaryWideOuter
+            {
+                BinaryWide head;
+                BinaryWide inner;
+                int32_t tail;
+
+                BinaryWideOuter() : head(), inner(), tail(0)
+                {
+                    // No-op.
+                }
+
+                friend bool operator==(const BinaryWideOuter& one, const BinaryWideOuter& two)
+                {
+                    return one.head == two.head && one.inner == two.inner && one.tail == two.tail;
+                }
+            };
         }
     }
 }
@@ -287,6 +470,42 @@ namespace ignite
             }
         };
 
+        template<>
+        struct BinaryType<gt::OptionalField> : BinaryTypeDefaultHashing<gt::OptionalField>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "OptionalField";
+            }
+
+            static bool IsNull(const gt::OptionalField&)
+            {
+                return false;
+            }
+
+            static void GetNull(gt::OptionalField&)
+            {
+                throw std::runtime_error("Must not be called.");
+            }
+
+            static void Write(BinaryWriter& writer, const gt::OptionalField& obj)
+            {
+                // Field set and order depend on the value.
+                if (obj.extra)
+                    writer.WriteInt32("extra", obj.extra);
+
+                writer.WriteInt32("val", obj.val);
+            }
+
+            static void Read(BinaryReader& reader, gt::OptionalField& dst)
+            {
+                int32_t val = reader.ReadInt32("val");
+                int32_t extra = reader.ReadInt32("extra");
+
+                dst = gt::OptionalField(val, extra);
+            }
+        };
+
         template<>
         struct BinaryType<gt::PureRaw> : BinaryTypeDefaultHashing<gt::PureRaw>
         {
@@ -358,6 +577,189 @@ namespace ignite
                 dst.strField = reader.ReadString("strField");
             }
         };
+
+        template<>
+        struct BinaryType<gt::BinaryAddress> : BinaryTypeDefaultAll<gt::BinaryAddress>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryAddress";
+            }
+
+            static bool IsDeduplicated()
+            {
+                return true;
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryAddress& obj)
+            {
+                writer.WriteString("street", obj.street);
+                writer.WriteInt32("house", obj.house);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryAddress& dst)
+            {
+                dst.street = reader.ReadString("street");
+                dst.house = reader.ReadInt32("house");
+            }
+        };
+
+        template<>
+        struct BinaryType<gt::BinaryPerson> : BinaryTypeDefaultAll<gt::BinaryPerson>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryPerson";
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryPerson& obj)
+            {
+                writer.WriteString("name", obj.name);
+                writer.WriteObject("home", obj.home);
+                writer.WriteObject("work", obj.work);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryPerson& dst)
+            {
+                dst.name = reader.ReadString("name");
+                dst.home = reader.ReadObject<gt::BinaryAddress>("home");
+                dst.work = reader.ReadObject<gt::BinaryAddress>("work");
+            }
+        };
+
+        template<>
+        struct BinaryType<gt::BinaryCompany> : BinaryTypeDefaultAll<gt::BinaryCompany>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryCompany";
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryCompany& obj)
+            {
+                writer.WriteString("name", obj.name);
+                writer.WriteObject("address", obj.address);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryCompany& dst)
+            {
+                dst.name = reader.ReadString("name");
+                dst.address = reader.ReadObject<gt::BinaryAddress>("address");
+            }
+        };
+
+        template<>
+        struct BinaryType<gt::BinaryEmployee> : BinaryTypeDefaultAll<gt::BinaryEmployee>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryEmployee";
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryEmployee& obj)
+            {
+                writer.WriteObject("home", obj.home);
+                writer.WriteString("name", obj.name);
+                writer.WriteObject("company", obj.company);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryEmployee& dst)
+            {
+                dst.home = reader.ReadObject<gt::BinaryAddress>("home");
+                dst.name = reader.ReadString("name");
+                dst.company = reader.ReadObject<gt::BinaryCompany>("company");
+            }
+        };
+
+        template<>
+        struct BinaryType<gt::DeclaredFields> : BinaryTypeDefaultAll<gt::DeclaredFields>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "DeclaredFields";
+            }
+
+            IGNITE_BINARY_FIELDS_START(gt::DeclaredFields)
+                IGNITE_BINARY_FIELD(id)
+                IGNITE_BINARY_FIELD_AS(name, "title")
+                IGNITE_BINARY_FIELD(weight)
+                IGNITE_BINARY_FIELD(guid)
+                IGNITE_BINARY_FIELD(address)
+            IGNITE_BINARY_FIELDS_END
+        };
+
+        template<>
+        struct BinaryType<gt::DeclaredRawFields> : BinaryTypeDefaultAll<gt::DeclaredRawFields>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "DeclaredRawFields";
+            }
+
+            IGNITE_BINARY_RAW_FIELDS_START(gt::DeclaredRawFields)
+                IGNITE_BINARY_FIELD(id)
+                IGNITE_BINARY_FIELD(name)
+                IGNITE_BINARY_FIELD(address)
+            IGNITE_BINARY_FIELDS_END
+        };
+
+        template<>
+        struct BinaryType<gt::BinaryWide> : BinaryTypeDefaultAll<gt::BinaryWide>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryWide";
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryWide& obj)
+            {
+                for (int32_t i = 0; i < gt::BinaryWide::FIELDS_NUM; ++i)
+                    writer.WriteInt32(GetName(i).c_str(), obj.vals[i]);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryWide& dst)
+            {
+                for (int32_t i = 0; i < gt::BinaryWide::FIELDS_NUM; ++i)
+                    dst.vals[i] = reader.ReadInt32(GetName(i).c_str());
+            }
+
+            static std::string GetName(int32_t i)
+            {
+                std::stringstream name;
+
+                name << "val" << i;
+
+                return name.str();
+            }
+        };
+
+        template<>
+        struct BinaryType<gt::BinaryWideOuter> : BinaryTypeDefaultAll<gt::BinaryWideOuter>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "BinaryWideOuter";
+            }
+
+            static void Write(BinaryWriter& writer, const gt::BinaryWideOuter& obj)
+            {
+                writer.WriteInt32("tail", obj.tail);
+
+                // Enough fields for the inner object schema to be stored after these.
+                BinaryType<gt::BinaryWide>::Write(writer, obj.head);
+
+                writer.WriteObject("inner", obj.inner);
+            }
+
+            static void Read(BinaryReader& reader, gt::BinaryWideOuter& dst)
+            {
+                dst.tail = reader.ReadInt32("tail");
+
+                BinaryType<gt::BinaryWide>::Read(reader, dst.head);
+
+                dst.inner = reader.ReadObject<gt::BinaryWide>("inner");
+            }
+        };
     }
 }
 
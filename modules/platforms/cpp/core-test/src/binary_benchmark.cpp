@@ -0,0 +1,368 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Binary marshaller benchmark.
+ *
+ * Does not need a running node: only the binary library is measured.
+ *
+ * Every result is printed to stdout as a single-line JSON object.
+ *
+ * Usage: ignite-binary-benchmark [FILTER [ITERATIONS]]
+ *
+ * Only benchmarks with names starting with FILTER are run.
+ */
+
+#include <stdint.h>
+#include <cstdlib>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <ignite/impl/binary/binary_utils.h>
+#include <ignite/impl/binary/binary_writer_impl.h>
+#include <ignite/impl/binary/binary_reader_impl.h>
+#include <ignite/impl/interop/interop_memory.h>
+
+using namespace ignite::impl::binary;
+using namespace ignite::impl::interop;
+
+namespace
+{
+    /** Minimal number of bytes processed by a single iteration. */
+    const size_t BYTES_PER_ITERATION = 1024 * 1024;
+
+    /**
+     * Benchmark. Implementations check in constructor that the measured code
+     * produces correct results and throw std::runtime_error otherwise.
+     */
+    class Benchmark
+    {
+    public:
+        /**
+         * Destructor.
+         */
+        virtual ~Benchmark()
+        {
+            // No-op.
+        }
+
+        /**
+         * Run single iteration.
+         *
+         * @return Processed bytes.
+         */
+        virtual int64_t Iteration() = 0;
+    };
+
+    /**
+     * Run benchmark and print its result to stdout as JSON object.
+     * Tenth of the iterations is run for warm-up first.
+     *
+     * @param bench Benchmark.
+     * @param name Benchmark name.
+     * @param size Size of the benchmark data.
+     * @param iterations Measured iterations.
+     */
+    void Measure(Benchmark& bench, const std::string& name, size_t size, int32_t iterations)
+    {
+        for (int32_t i = 0; i < iterations / 10; ++i)
+            bench.Iteration();
+
+        std::vector<double> latencies;
+        int64_t bytes = 0;
+
+        latencies.reserve(iterations);
+
+        for (int32_t i = 0; i < iterations; ++i)
+        {
+            boost::chrono::steady_clock::time_point begin = boost::chrono::steady_clock::now();
+
+            bytes += bench.Iteration();
+
+            boost::chrono::duration<double, boost::micro> latency = boost::chrono::steady_clock::now() - begin;
+
+            latencies.push_back(latency.count());
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        double total = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+
+        std::cout << "{\"benchmark\":\"" << name << "\",\"size\":" << size
+                  << ",\"iterations\":" << iterations
+                  << ",\"bytes\":" << bytes
+                  << ",\"total_us\":" << total
+                  << ",\"mb_per_sec\":" << (total > 0 ? bytes / total : 0)
+                  << ",\"latency_avg_us\":" << total / iterations
+                  << ",\"latency_p50_us\":" << latencies[latencies.size() / 2]
+                  << ",\"latency_max_us\":" << latencies.back()
+                  << "}" << std::endl;
+    }
+
+    /**
+     * Java-compatible hash code of the serialized object data.
+     */
+    class DataHashBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param size Data size.
+         * @param reference Measure the plain byte loop instead of the
+         *     BinaryUtils::GetDataHashCode().
+         */
+        DataHashBenchmark(size_t size, bool reference) :
+            data(size),
+            reference(reference),
+            repeats(std::max<size_t>(1, BYTES_PER_ITERATION / std::max<size_t>(1, size))),
+            sink(0)
+        {
+            for (size_t i = 0; i < data.size(); ++i)
+                data[i] = static_cast<int8_t>(std::rand());
+
+            if (Hash() != ReferenceHash())
+                throw std::runtime_error("Hash code does not match the reference one.");
+        }
+
+        virtual int64_t Iteration()
+        {
+            for (size_t i = 0; i < repeats; ++i)
+            {
+                // Dependency on the previous result prevents hoisting out of the loop.
+                data[0] = static_cast<int8_t>(sink);
+
+                sink += reference ? ReferenceHash() : Hash();
+            }
+
+            return static_cast<int64_t>(repeats * data.size());
+        }
+
+    private:
+        /**
+         * Get hash code with BinaryUtils.
+         *
+         * @return Hash code.
+         */
+        int32_t Hash() const
+        {
+            return BinaryUtils::GetDataHashCode(&data[0], data.size());
+        }
+
+        /**
+         * Get hash code the way Java does.
+         *
+         * @return Hash code.
+         */
+        int32_t ReferenceHash() const
+        {
+            uint32_t hash = 1;
+
+            for (size_t i = 0; i < data.size(); ++i)
+                hash = 31 * hash + static_cast<uint32_t>(data[i]);
+
+            return static_cast<int32_t>(hash);
+        }
+
+        /** Data. */
+        std::vector<int8_t> data;
+
+        /** Reference flag. */
+        bool reference;
+
+        /** Hash computations per iteration. */
+        size_t repeats;
+
+        /** Sum of the hash codes. */
+        int32_t sink;
+    };
+
+    /**
+     * Serialization of the vector of doubles.
+     */
+    class VectorBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param size Number of elements.
+         * @param collection Write vector as collection instead of array.
+         * @param read Measure reading instead of writing.
+         */
+        VectorBenchmark(size_t size, bool collection, bool read) :
+            data(size),
+            collection(collection),
+            read(read),
+            mem(1024)
+        {
+            for (size_t i = 0; i < data.size(); ++i)
+                data[i] = std::rand() / 7.0;
+
+            Write();
+
+            if (Read() != data)
+                throw std::runtime_error("Read vector does not match the written one.");
+        }
+
+        virtual int64_t Iteration()
+        {
+            if (read)
+                Read();
+            else
+                Write();
+
+            return static_cast<int64_t>(data.size() * sizeof(double));
+        }
+
+    private:
+        /**
+         * Write data to memory.
+         */
+        void Write()
+        {
+            InteropOutputStream out(&mem);
+            BinaryWriterImpl writer(&out, 0);
+
+            if (collection)
+                writer.WriteCollection(data.begin(), data.end(), ignite::binary::CollectionType::ARRAY_LIST);
+            else
+                writer.WriteTopObject(data);
+
+            out.Synchronize();
+        }
+
+        /**
+         * Read data from memory.
+         *
+         * @return Read vector.
+         */
+        std::vector<double> Read()
+        {
+            InteropInputStream in(&mem);
+            BinaryReaderImpl reader(&in);
+
+            std::vector<double> res;
+
+            if (collection)
+            {
+                res.reserve(data.size());
+
+                reader.ReadCollection<double>(std::back_inserter(res));
+            }
+            else
+                res = reader.ReadTopObject<std::vector<double> >();
+
+            return res;
+        }
+
+        /** Data. */
+        std::vector<double> data;
+
+        /** Collection flag. */
+        bool collection;
+
+        /** Read flag. */
+        bool read;
+
+        /** Memory. */
+        InteropUnpooledMemory mem;
+    };
+}
+
+int main(int argc, char** argv)
+{
+    std::string filter(argc > 1 ? argv[1] : "");
+    int32_t iterations = argc > 2 ? std::atoi(argv[2]) : 100;
+
+    if (argc > 3 || iterations <= 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [FILTER [ITERATIONS]]" << std::endl;
+
+        return 1;
+    }
+
+    bool success = true;
+
+    const size_t hashSizes[] = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+
+    for (size_t s = 0; s < sizeof(hashSizes) / sizeof(hashSizes[0]); ++s)
+    {
+        for (int reference = 0; reference < 2; ++reference)
+        {
+            std::string name(reference ? "data_hash_reference" : "data_hash");
+
+            if (name.compare(0, filter.size(), filter) != 0)
+                continue;
+
+            try
+            {
+                DataHashBenchmark bench(hashSizes[s], reference != 0);
+
+                Measure(bench, name, hashSizes[s], iterations);
+            }
+            catch (const std::exception& err)
+            {
+                std::cerr << name << ": " << err.what() << std::endl;
+
+                success = false;
+            }
+        }
+    }
+
+    const size_t vectorSizes[] = { 100, 100000 };
+
+    for (size_t s = 0; s < sizeof(vectorSizes) / sizeof(vectorSizes[0]); ++s)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            bool collection = (i & 1) != 0;
+            bool read = (i & 2) != 0;
+
+            std::string name(read ? "vector_read" : "vector_write");
+
+            if (collection)
+                name += "_collection";
+
+            if (name.compare(0, filter.size(), filter) != 0)
+                continue;
+
+            try
+            {
+                VectorBenchmark bench(vectorSizes[s], collection, read);
+
+                Measure(bench, name, vectorSizes[s], iterations);
+            }
+            catch (const std::exception& err)
+            {
+                std::cerr << name << ": " << err.what() << std::endl;
+
+                success = false;
+            }
+        }
+    }
+
+    return success ? 0 : 1;
+}
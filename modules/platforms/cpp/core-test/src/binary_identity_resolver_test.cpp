@@ -255,6 +255,43 @@ int32_t RetrieveHashCode(const T& value)
     return obj.GetHashCode();
 }
 
+/**
+ * Reference Java-compatible data hash code.
+ *
+ * @param data Data.
+ * @param size Data size.
+ * @return Hash code.
+ */
+int32_t ReferenceDataHashCode(const int8_t* data, size_t size)
+{
+    uint32_t hash = 1;
+
+    for (size_t i = 0; i < size; ++i)
+        hash = 31 * hash + static_cast<uint32_t>(data[i]);
+
+    return static_cast<int32_t>(hash);
+}
+
+/**
+ * Check data hash code of the data prefixes of all sizes up to the maximum
+ * and of the whole data against the reference.
+ *
+ * @param data Data.
+ * @param maxSize Maximum prefix size.
+ * @param impl Implementation.
+ */
+void CheckDataHashCode(const std::vector<int8_t>& data, size_t maxSize, DataHashImpl::Type impl)
+{
+    // Odd offset to make vector loads unaligned.
+    const int8_t* begin = &data[1];
+    size_t size = data.size() - 1;
+
+    for (size_t i = 0; i <= maxSize; ++i)
+        BOOST_CHECK_EQUAL(BinaryUtils::GetDataHashCode(begin, i, impl), ReferenceDataHashCode(begin, i));
+
+    BOOST_CHECK_EQUAL(BinaryUtils::GetDataHashCode(begin, size, impl), ReferenceDataHashCode(begin, size));
+}
+
 BOOST_FIXTURE_TEST_SUITE(BinaryIdentityResolverTestSuite, BinaryIdentityResolverTestSuiteFixture)
 
 BOOST_AUTO_TEST_CASE(GetDataHashCode)
@@ -280,6 +317,40 @@ BOOST_AUTO_TEST_CASE(GetDataHashCode)
     BOOST_CHECK_EQUAL(BinaryUtils::GetDataHashCode(data9, sizeof(data9)), 0x000D9F41);
 }
 
+BOOST_AUTO_TEST_CASE(GetDataHashCodeImplementations)
+{
+    std::vector<int8_t> data(5000);
+
+    // Covers negative bytes as well.
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<int8_t>(i * 37 + 11);
+
+    const size_t maxSize = 300;
+
+    DataHashImpl::Type impls[] = { DataHashImpl::SCALAR, DataHashImpl::SSE2, DataHashImpl::AVX2 };
+
+    for (size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); ++i)
+    {
+        if (!BinaryUtils::IsDataHashSupported(impls[i]))
+        {
+            BOOST_TEST_MESSAGE("Data hash implementation is not supported: " << impls[i]);
+
+            continue;
+        }
+
+        CheckDataHashCode(data, maxSize, impls[i]);
+    }
+
+    BOOST_CHECK(BinaryUtils::IsDataHashSupported(DataHashImpl::SCALAR));
+
+    // Default implementation selected for the host.
+    for (size_t i = 0; i <= maxSize; ++i)
+        BOOST_CHECK_EQUAL(BinaryUtils::GetDataHashCode(&data[0], i), ReferenceDataHashCode(&data[0], i));
+
+    BOOST_CHECK_EQUAL(BinaryUtils::GetDataHashCode(&data[0], data.size()),
+        ReferenceDataHashCode(&data[0], data.size()));
+}
+
 BOOST_AUTO_TEST_CASE(IdentityEquilityWithGuid)
 {
 #ifdef IGNITE_TESTS_32
@@ -20,6 +20,7 @@
 #include <ignite/common/utils.h>
 #include <ignite/common/fixed_size_array.h>
 #include <ignite/binary/binary_object.h>
+#include <ignite/binary/binary_object_builder.h>
 #include <ignite/binary/binary_writer.h>
 #include <ignite/binary/binary_enum.h>
 #include <ignite/binary/binary_enum_entry.h>
@@ -153,6 +154,24 @@ void CheckNoField(const T& obj, const char* field)
     BOOST_REQUIRE(!binObj.HasField(field));
 }
 
+template<typename T>
+void CheckBuiltData(InteropMemory& builtMem, const T& expected)
+{
+    InteropUnpooledMemory mem(1024);
+    FillMem<T>(mem, expected);
+
+    BinaryObjectImpl expectedObj(BinaryObjectImpl::FromMemory(mem, 0, 0));
+    BinaryObjectImpl builtObj(BinaryObjectImpl::FromMemory(builtMem, 0, 0));
+
+    BOOST_REQUIRE(builtObj.Deserialize<T>() == expected);
+
+    BOOST_REQUIRE_EQUAL(builtObj.GetLength(), expectedObj.GetLength());
+    BOOST_CHECK_EQUAL(builtObj.GetHashCode(), expectedObj.GetHashCode());
+
+    for (int32_t i = 0; i < expectedObj.GetLength(); ++i)
+        BOOST_CHECK_EQUAL(builtObj.GetData()[i], expectedObj.GetData()[i]);
+}
+
 BOOST_AUTO_TEST_SUITE(BinaryObjectTestSuite)
 
 BOOST_AUTO_TEST_CASE(UserTestType)
@@ -241,6 +260,23 @@ BOOST_AUTO_TEST_CASE(UserBinaryFieldsGetField)
     CheckNoField(some, "");
 }
 
+BOOST_AUTO_TEST_CASE(UserBinaryPersonGetFieldView)
+{
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, BinaryPerson("John", BinaryAddress(), BinaryAddress()));
+
+    TemplatedBinaryIdResolver<BinaryPerson> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    BinaryStringView name = obj.GetField<BinaryStringView>("name");
+
+    BOOST_REQUIRE_EQUAL(name.GetLength(), 4);
+    BOOST_CHECK_EQUAL(std::string(name.GetData(), name.GetLength()), "John");
+    BOOST_CHECK(name.GetData() > reinterpret_cast<const char*>(mem.Data()));
+
+    BOOST_CHECK(obj.GetField<BinaryStringView>("unknown").IsNull());
+}
+
 BOOST_AUTO_TEST_CASE(UserTestTypeGetField)
 {
     TestType dflt;
@@ -379,6 +415,135 @@ BOOST_AUTO_TEST_CASE(RemoteSchemaRetrieval)
     Ignition::StopAll(true);
 }
 
+BOOST_AUTO_TEST_CASE(BuilderSetField)
+{
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, BinaryFields(1, 2, 3, 4));
+
+    TemplatedBinaryIdResolver<BinaryFields> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    InteropUnpooledMemory builtMem(1024);
+
+    BinaryObject built = BinaryObjectBuilder(obj)
+        .SetField<int32_t>("val2", 20)
+        .Build(builtMem);
+
+    BOOST_CHECK_EQUAL(built.GetField<int32_t>("val2"), 20);
+
+    CheckBuiltData(builtMem, BinaryFields(1, 20, 3, 4));
+}
+
+BOOST_AUTO_TEST_CASE(BuilderAddRemoveField)
+{
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, BinaryFields(1, 2, 3, 4));
+
+    TemplatedBinaryIdResolver<BinaryFields> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    InteropUnpooledMemory builtMem(1024);
+
+    BinaryObject built = BinaryObjectBuilder(obj)
+        .RemoveField("val1")
+        .SetField<std::string>("comment", "Added field")
+        .Build(builtMem);
+
+    BOOST_CHECK(!built.HasField("val1"));
+    BOOST_CHECK_EQUAL(built.GetField<int32_t>("val2"), 2);
+    BOOST_CHECK_EQUAL(built.GetField<std::string>("comment"), "Added field");
+
+    BinaryFields actual = built.Deserialize<BinaryFields>();
+
+    BOOST_CHECK_EQUAL(actual.val1, 0);
+    BOOST_CHECK_EQUAL(actual.val2, 2);
+    BOOST_CHECK_EQUAL(actual.rawVal1, 3);
+    BOOST_CHECK_EQUAL(actual.rawVal2, 4);
+}
+
+BOOST_AUTO_TEST_CASE(BuilderHandles)
+{
+    BinaryAddress addr("Main street", 1);
+
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, BinaryPerson("John", addr, addr));
+
+    TemplatedBinaryIdResolver<BinaryPerson> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    InteropUnpooledMemory builtMem(1024);
+
+    BinaryAddress newAddr("Second street", 2);
+
+    BinaryObject built = BinaryObjectBuilder(obj)
+        .SetField("home", newAddr)
+        .Build(builtMem);
+
+    BinaryPerson expected("John", newAddr, addr);
+
+    BOOST_CHECK(built.Deserialize<BinaryPerson>() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(BuilderNestedHandles)
+{
+    BinaryAddress addr("Main street", 1);
+
+    // Address of the company is written as the handle to the home address.
+    BinaryEmployee employee(addr, "John", BinaryCompany("Acme", addr));
+
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, employee);
+
+    TemplatedBinaryIdResolver<BinaryEmployee> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    InteropUnpooledMemory builtMem(1024);
+
+    BinaryObject built = BinaryObjectBuilder(obj)
+        .SetField<std::string>("name", "John Smith")
+        .Build(builtMem);
+
+    BinaryEmployee expected(addr, "John Smith", BinaryCompany("Acme", addr));
+
+    BOOST_CHECK(built.Deserialize<BinaryEmployee>() == expected);
+
+    InteropUnpooledMemory removedMem(1024);
+
+    BinaryObject removed = BinaryObjectBuilder(obj)
+        .RemoveField("name")
+        .Build(removedMem);
+
+    expected.name.clear();
+
+    BOOST_CHECK(removed.Deserialize<BinaryEmployee>() == expected);
+
+    // Referred object is replaced, so the handle can not be kept.
+    InteropUnpooledMemory changedMem(1024);
+
+    BinaryObjectBuilder builder(obj);
+
+    builder.SetField("home", BinaryAddress("Second street", 2));
+
+    BOOST_CHECK_THROW(builder.Build(changedMem), IgniteError);
+}
+
+BOOST_AUTO_TEST_CASE(BuilderUnchanged)
+{
+    BinaryPerson person("John", BinaryAddress("Main street", 1), BinaryAddress("Second street", 2));
+
+    InteropUnpooledMemory mem(1024);
+    FillMem(mem, person);
+
+    TemplatedBinaryIdResolver<BinaryPerson> resolver;
+    BinaryObject obj(mem, 0, &resolver, 0);
+
+    InteropUnpooledMemory builtMem(1024);
+
+    BinaryObjectBuilder(obj).Build(builtMem);
+
+    CheckBuiltData(builtMem, person);
+}
+
 BOOST_AUTO_TEST_CASE(GetEnumValueInvalid)
 {
     BinaryFields some(43956293, 567894632, 253945, 107576622);
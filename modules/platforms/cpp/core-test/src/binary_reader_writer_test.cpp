@@ -15,12 +15,14 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <memory>
 
 #include <boost/test/unit_test.hpp>
 
 #include "ignite/impl/interop/interop.h"
 #include "ignite/binary/binary.h"
+#include "ignite/impl/binary/binary_object_header.h"
 
 #include "ignite/binary_test_defs.h"
 #include "ignite/binary_test_utils.h"
@@ -2022,4 +2024,676 @@ BOOST_AUTO_TEST_CASE(TestPrimitivePointers)
     BOOST_CHECK_EQUAL(*field2Res, field2);
 }
 
+BOOST_AUTO_TEST_CASE(TestFieldIds)
+{
+    const BinaryFieldId field1("field1");
+    const BinaryFieldId field2("field2");
+    const BinaryFieldId field3("field3");
+    const BinaryFieldId missing("missing");
+
+    BOOST_CHECK_EQUAL(field1.GetId(), GetBinaryStringHashCode("field1"));
+
+    TemplatedBinaryIdResolver<BinaryDummy> idRslvr;
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writerImpl(&out, &idRslvr, 0, 0, 0);
+    BinaryWriter writer(&writerImpl);
+
+    out.Position(IGNITE_DFLT_HDR_LEN);
+
+    writer.WriteInt32(field1, 42);
+    writer.WriteString(field2, std::string("Lorem ipsum"));
+    writer.WriteDouble("field3", 1.5);
+
+    writerImpl.PostWrite();
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+
+    int32_t footerBegin = in.ReadInt32(IGNITE_OFFSET_SCHEMA_OR_RAW_OFF);
+    int32_t footerEnd = footerBegin + 5 * 3;
+
+    BinaryReaderImpl readerImpl(&in, &idRslvr, 0, true, idRslvr.GetTypeId(), 0, 100, 100,
+        footerBegin, footerEnd, BinaryOffsetType::ONE_BYTE);
+    BinaryReader reader(&readerImpl);
+
+    in.Position(IGNITE_DFLT_HDR_LEN);
+
+    BOOST_CHECK_EQUAL(reader.ReadInt32("field1"), 42);
+    BOOST_CHECK_EQUAL(reader.ReadString(field2), "Lorem ipsum");
+    BOOST_CHECK_EQUAL(reader.ReadDouble(field3), 1.5);
+    BOOST_CHECK_EQUAL(reader.ReadInt32(missing), 0);
+    BOOST_CHECK_EQUAL(reader.ReadString(missing), "");
+}
+
+/**
+ * Type updater which accepts all updates.
+ */
+class AcceptingTypeUpdater : public BinaryTypeUpdater
+{
+public:
+    virtual bool Update(const Snap&, IgniteError&)
+    {
+        return true;
+    }
+
+    virtual SPSnap GetMeta(int32_t, IgniteError&)
+    {
+        return SPSnap();
+    }
+};
+
+/**
+ * Write object to the new memory.
+ *
+ * @param mgr Type manager.
+ * @param obj Object.
+ * @return Written bytes.
+ */
+template<typename T>
+std::vector<int8_t> WriteWithManager(BinaryTypeManager& mgr, const T& obj)
+{
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, &mgr);
+
+    writer.WriteTopObject(obj);
+
+    out.Synchronize();
+
+    return std::vector<int8_t>(mem.Data(), mem.Data() + out.Position());
+}
+
+BOOST_AUTO_TEST_CASE(TestWritePlan)
+{
+    BinaryTypeManager mgr;
+    AcceptingTypeUpdater updater;
+
+    mgr.SetUpdater(&updater);
+
+    int32_t typeId = BinaryType<BinaryFields>::GetTypeId();
+
+    BinaryFields obj(1, 2, 3, 4);
+
+    std::vector<int8_t> bytes = WriteWithManager(mgr, obj);
+
+    BOOST_REQUIRE(mgr.IsUpdatedSince(0));
+    BOOST_REQUIRE(mgr.GetWritePlan(typeId) == 0);
+
+    IgniteError err;
+
+    BOOST_REQUIRE(mgr.ProcessPendingUpdates(err));
+
+    int32_t ver = mgr.GetVersion();
+
+    // Plan is created by the first write after the type is registered.
+    BOOST_CHECK(WriteWithManager(mgr, obj) == bytes);
+    BOOST_REQUIRE(mgr.GetWritePlan(typeId) != 0);
+
+    BOOST_CHECK(WriteWithManager(mgr, obj) == bytes);
+    BOOST_CHECK(!mgr.IsUpdatedSince(ver));
+}
+
+BOOST_AUTO_TEST_CASE(TestWritePlanMiss)
+{
+    BinaryTypeManager mgr;
+    AcceptingTypeUpdater updater;
+
+    mgr.SetUpdater(&updater);
+
+    int32_t typeId = BinaryType<OptionalField>::GetTypeId();
+    int32_t valId = BinaryType<OptionalField>::GetFieldId("val");
+    int32_t extraId = BinaryType<OptionalField>::GetFieldId("extra");
+
+    IgniteError err;
+
+    WriteWithManager(mgr, OptionalField(1, 0));
+
+    BOOST_REQUIRE(mgr.ProcessPendingUpdates(err));
+
+    WriteWithManager(mgr, OptionalField(1, 0));
+
+    BOOST_REQUIRE(mgr.GetWritePlan(typeId) != 0);
+    BOOST_CHECK(!mgr.GetMeta(typeId).Get()->ContainsFieldId(extraId));
+
+    int32_t ver = mgr.GetVersion();
+
+    // New field is written before the planned one.
+    OptionalField obj(2, 3);
+
+    std::vector<int8_t> bytes = WriteWithManager(mgr, obj);
+
+    BOOST_REQUIRE(mgr.IsUpdatedSince(ver));
+    BOOST_REQUIRE(mgr.ProcessPendingUpdates(err));
+
+    SPSnap snap = mgr.GetMeta(typeId);
+
+    BOOST_REQUIRE(snap.Get());
+    BOOST_CHECK(snap.Get()->ContainsFieldId(valId));
+    BOOST_CHECK(snap.Get()->ContainsFieldId(extraId));
+
+    InteropUnpooledMemory mem(static_cast<int32_t>(bytes.size()));
+
+    memcpy(mem.Data(), &bytes[0], bytes.size());
+    mem.Length(static_cast<int32_t>(bytes.size()));
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    BOOST_CHECK(reader.ReadTopObject<OptionalField>() == obj);
+}
+
+/**
+ * Register field of the type.
+ *
+ * @param mgr Type manager.
+ * @param typeId Type ID.
+ * @param fieldId Field ID.
+ * @param fieldName Field name.
+ */
+void RegisterField(BinaryTypeManager& mgr, int32_t typeId, int32_t fieldId, const char* fieldName)
+{
+    common::concurrent::SharedPointer<BinaryTypeHandler> hnd = mgr.GetHandler("Type", "", typeId);
+
+    hnd.Get()->OnFieldWritten(fieldId, fieldName, IGNITE_TYPE_INT);
+
+    mgr.SubmitHandler(*hnd.Get());
+}
+
+BOOST_AUTO_TEST_CASE(TestTypeManagerSnapshots)
+{
+    BinaryTypeManager mgr;
+    AcceptingTypeUpdater updater;
+
+    mgr.SetUpdater(&updater);
+
+    IgniteError err;
+
+    // Enough types for the snapshot table to grow.
+    for (int32_t typeId = 1; typeId <= 100; ++typeId)
+        RegisterField(mgr, typeId, 1, "field1");
+
+    BOOST_REQUIRE(mgr.ProcessPendingUpdates(err));
+
+    SPSnap snap = mgr.GetMeta(42);
+
+    BOOST_REQUIRE(snap.Get());
+    BOOST_CHECK(snap.Get()->ContainsFieldId(1));
+
+    RegisterField(mgr, 42, 2, "field2");
+
+    BOOST_REQUIRE(mgr.ProcessPendingUpdates(err));
+
+    // Registered snapshot is not changed, the new one has all the fields.
+    BOOST_CHECK(!snap.Get()->ContainsFieldId(2));
+
+    SPSnap updated = mgr.GetMeta(42);
+
+    BOOST_CHECK(updated.Get()->ContainsFieldId(1));
+    BOOST_CHECK(updated.Get()->ContainsFieldId(2));
+
+    for (int32_t typeId = 1; typeId <= 100; ++typeId)
+        BOOST_CHECK_EQUAL(mgr.GetMeta(typeId).Get()->GetTypeId(), typeId);
+
+    // Unknown type is requested from the updater every time.
+    BOOST_CHECK(!mgr.GetMeta(1000).Get());
+    BOOST_CHECK(!mgr.GetMeta(1000).Get());
+}
+
+/**
+ * Write person as the top-level object.
+ *
+ * @param person Person.
+ * @return Written bytes.
+ */
+std::vector<int8_t> WritePerson(const BinaryPerson& person)
+{
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(person);
+
+    out.Synchronize();
+
+    return std::vector<int8_t>(mem.Data(), mem.Data() + out.Position());
+}
+
+/**
+ * Read person written as the top-level object.
+ *
+ * @param bytes Bytes.
+ * @return Person.
+ */
+BinaryPerson ReadPerson(const std::vector<int8_t>& bytes)
+{
+    InteropUnpooledMemory mem(static_cast<int32_t>(bytes.size()));
+
+    memcpy(mem.Data(), &bytes[0], bytes.size());
+    mem.Length(static_cast<int32_t>(bytes.size()));
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    return reader.ReadTopObject<BinaryPerson>();
+}
+
+BOOST_AUTO_TEST_CASE(TestHandles)
+{
+    BinaryAddress addr1("Main street", 1);
+    BinaryAddress addr2("Main street", 2);
+
+    BinaryPerson distinct("John", addr1, addr2);
+    BinaryPerson same("John", addr1, addr1);
+
+    std::vector<int8_t> distinctBytes = WritePerson(distinct);
+    std::vector<int8_t> sameBytes = WritePerson(same);
+
+    // Second address is replaced with the handle.
+    BOOST_CHECK_LT(sameBytes.size(), distinctBytes.size());
+    BOOST_CHECK(std::find(sameBytes.begin(), sameBytes.end(), IGNITE_HDR_HND) != sameBytes.end());
+
+    BOOST_CHECK(ReadPerson(distinctBytes) == distinct);
+    BOOST_CHECK(ReadPerson(sameBytes) == same);
+
+    // Handles are not shared between the top-level objects.
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(same);
+    writer.WriteTopObject(same);
+
+    out.Synchronize();
+
+    BOOST_REQUIRE_EQUAL(out.Position(), static_cast<int32_t>(sameBytes.size() * 2));
+    BOOST_CHECK(std::equal(sameBytes.begin(), sameBytes.end(), mem.Data() + sameBytes.size()));
+}
+
+/**
+ * Write handle to the object written at the specified position.
+ *
+ * @param out Stream.
+ * @param objPos Object position.
+ */
+void WriteHandle(InteropOutputStream& out, int32_t objPos)
+{
+    int32_t hndPos = out.Position();
+
+    out.WriteInt8(IGNITE_HDR_HND);
+    out.WriteInt32(hndPos - objPos);
+}
+
+BOOST_AUTO_TEST_CASE(TestContainerHandles)
+{
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    // Containers are written once and then referenced by handles, the way Java does it.
+    int32_t collPos = out.Position();
+
+    int32_t collId = writer.WriteCollection(CollectionType::ARRAY_LIST);
+    writer.WriteElement(collId, 1);
+    writer.WriteElement(collId, 2);
+    writer.CommitContainer(collId);
+
+    int32_t mapPos = out.Position();
+
+    int32_t mapId = writer.WriteMap(MapType::HASH_MAP);
+    writer.WriteElement(mapId, 3, std::string("three"));
+    writer.CommitContainer(mapId);
+
+    int32_t arrPos = out.Position();
+
+    int32_t arrId = writer.WriteArray();
+    writer.WriteElement(arrId, std::string("four"));
+    writer.WriteElement(arrId, std::string("five"));
+    writer.CommitContainer(arrId);
+
+    out.Synchronize();
+
+    int32_t dataLen = out.Position();
+
+    WriteHandle(out, collPos);
+    writer.WriteInt32(10);
+
+    WriteHandle(out, collPos);
+    writer.WriteInt32(11);
+
+    WriteHandle(out, collPos);
+    writer.WriteInt32(12);
+
+    WriteHandle(out, mapPos);
+    writer.WriteInt32(13);
+
+    WriteHandle(out, arrPos);
+    writer.WriteInt32(14);
+
+    WriteHandle(out, arrPos);
+    writer.WriteInt32(15);
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    in.Position(dataLen);
+
+    BOOST_CHECK_EQUAL(reader.ReadCollectionSize(), 2);
+    BOOST_CHECK_EQUAL(reader.ReadCollectionType(), CollectionType::ARRAY_LIST);
+
+    std::vector<int32_t> coll;
+
+    BOOST_REQUIRE_EQUAL(reader.ReadCollection<int32_t>(std::back_inserter(coll)), 2);
+    BOOST_CHECK_EQUAL(coll[0], 1);
+    BOOST_CHECK_EQUAL(coll[1], 2);
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 10);
+
+    CollectionType::Type collTyp;
+    int32_t collSize;
+
+    collId = reader.ReadCollection(&collTyp, &collSize);
+
+    BOOST_REQUIRE_EQUAL(collSize, 2);
+    BOOST_CHECK_EQUAL(collTyp, CollectionType::ARRAY_LIST);
+    BOOST_CHECK_EQUAL(reader.ReadElement<int32_t>(collId), 1);
+    BOOST_CHECK_EQUAL(reader.ReadElement<int32_t>(collId), 2);
+    BOOST_CHECK(!reader.HasNextElement(collId));
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 11);
+
+    reader.Skip();
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 12);
+
+    MapType::Type mapTyp;
+    int32_t mapSize;
+
+    mapId = reader.ReadMap(&mapTyp, &mapSize);
+
+    BOOST_REQUIRE_EQUAL(mapSize, 1);
+    BOOST_CHECK_EQUAL(mapTyp, MapType::HASH_MAP);
+
+    int32_t key;
+    std::string val;
+
+    reader.ReadElement(mapId, key, val);
+
+    BOOST_CHECK_EQUAL(key, 3);
+    BOOST_CHECK_EQUAL(val, "three");
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 13);
+
+    std::vector<std::string> arr;
+
+    reader.ReadTopObject0<BinaryReader, std::string>(arr);
+
+    BOOST_REQUIRE_EQUAL(arr.size(), 2);
+    BOOST_CHECK_EQUAL(arr[0], "four");
+    BOOST_CHECK_EQUAL(arr[1], "five");
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 14);
+
+    int32_t arrSize;
+
+    arrId = reader.ReadArray(&arrSize);
+
+    BOOST_REQUIRE_EQUAL(arrSize, 2);
+    BOOST_CHECK_EQUAL(reader.ReadElement<std::string>(arrId), "four");
+    BOOST_CHECK_EQUAL(reader.ReadElement<std::string>(arrId), "five");
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 15);
+}
+
+/**
+ * Check that vector is written as primitive array and read back.
+ *
+ * @param val Vector.
+ * @param hdr Expected array header.
+ */
+template<typename T>
+void CheckPrimitiveVector(const std::vector<T>& val, int8_t hdr)
+{
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(val);
+
+    out.Synchronize();
+
+    BOOST_REQUIRE_EQUAL(mem.Data()[0], hdr);
+    BOOST_REQUIRE_EQUAL(out.Position(), static_cast<int32_t>(5 + val.size() * sizeof(T)));
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    std::vector<T> res = reader.ReadTopObject<std::vector<T> >();
+
+    BOOST_CHECK(res == val);
+}
+
+/**
+ * Make vector of the specified length.
+ *
+ * @param len Length.
+ * @return Vector.
+ */
+template<typename T>
+std::vector<T> MakeVector(int32_t len)
+{
+    std::vector<T> res;
+
+    for (int32_t i = 0; i < len; ++i)
+        res.push_back(static_cast<T>(i * 3 % 7));
+
+    return res;
+}
+
+BOOST_AUTO_TEST_CASE(TestPrimitiveVectors)
+{
+    for (int32_t len = 0; len < 20; len += 19)
+    {
+        CheckPrimitiveVector(MakeVector<int8_t>(len), IGNITE_TYPE_ARRAY_BYTE);
+        CheckPrimitiveVector(MakeVector<bool>(len), IGNITE_TYPE_ARRAY_BOOL);
+        CheckPrimitiveVector(MakeVector<int16_t>(len), IGNITE_TYPE_ARRAY_SHORT);
+        CheckPrimitiveVector(MakeVector<uint16_t>(len), IGNITE_TYPE_ARRAY_CHAR);
+        CheckPrimitiveVector(MakeVector<int32_t>(len), IGNITE_TYPE_ARRAY_INT);
+        CheckPrimitiveVector(MakeVector<int64_t>(len), IGNITE_TYPE_ARRAY_LONG);
+        CheckPrimitiveVector(MakeVector<float>(len), IGNITE_TYPE_ARRAY_FLOAT);
+        CheckPrimitiveVector(MakeVector<double>(len), IGNITE_TYPE_ARRAY_DOUBLE);
+    }
+
+    // Vector is readable as array.
+    std::vector<double> val = MakeVector<double>(10);
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(val);
+    writer.WriteInt32(42);
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    double arr[10];
+
+    BOOST_REQUIRE_EQUAL(reader.ReadDoubleArray(arr, 10), 10);
+    BOOST_CHECK(std::equal(val.begin(), val.end(), arr));
+    BOOST_CHECK_EQUAL(reader.ReadInt32(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(TestViews)
+{
+    const int8_t bytes[] = { 1, 2, 3, -4 };
+
+    TemplatedBinaryIdResolver<BinaryDummy> idRslvr;
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writerImpl(&out, &idRslvr, 0, 0, 0);
+    BinaryWriter writer(&writerImpl);
+
+    out.Position(IGNITE_DFLT_HDR_LEN);
+
+    writer.WriteString("str", std::string("Lorem ipsum"));
+    writer.WriteInt8Array("bytes", bytes, 4);
+    writer.WriteString("nullStr", 0);
+
+    BinaryRawWriter rawWriter = writer.RawWriter();
+
+    rawWriter.WriteString("raw");
+    rawWriter.WriteInt8Array(bytes, 2);
+
+    writerImpl.PostWrite();
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+
+    int32_t footerBegin = in.ReadInt32(IGNITE_OFFSET_SCHEMA_OR_RAW_OFF);
+    int32_t footerEnd = footerBegin + 5 * 3;
+    int32_t rawOff = in.ReadInt32(footerEnd);
+
+    BinaryReaderImpl readerImpl(&in, &idRslvr, 0, true, idRslvr.GetTypeId(), 0, 100, rawOff,
+        footerBegin, footerEnd, BinaryOffsetType::ONE_BYTE);
+    BinaryReader reader(&readerImpl);
+
+    in.Position(IGNITE_DFLT_HDR_LEN);
+
+    BinaryStringView str = reader.ReadStringView("str");
+
+    BOOST_REQUIRE_EQUAL(str.GetLength(), 11);
+    BOOST_CHECK_EQUAL(std::string(str.GetData(), str.GetLength()), "Lorem ipsum");
+
+    // View points to the memory, the data is not copied.
+    BOOST_CHECK(str.GetData() > reinterpret_cast<const char*>(mem.Data()));
+    BOOST_CHECK(str.GetData() < reinterpret_cast<const char*>(mem.Data() + out.Position()));
+
+    BOOST_CHECK(reader.ReadStringView(BinaryFieldId("str")).GetData() == str.GetData());
+
+    BinaryInt8ArrayView arr = reader.ReadInt8ArrayView("bytes");
+
+    BOOST_REQUIRE_EQUAL(arr.GetLength(), 4);
+    BOOST_CHECK(std::equal(bytes, bytes + 4, arr.GetData()));
+
+    BOOST_CHECK(reader.ReadInt8ArrayView(BinaryFieldId("bytes")).GetData() == arr.GetData());
+
+    BOOST_CHECK(reader.ReadStringView("nullStr").IsNull());
+    BOOST_CHECK(reader.ReadStringView("missing").IsNull());
+    BOOST_CHECK(reader.ReadInt8ArrayView("missing").IsNull());
+
+    BOOST_CHECK_EXCEPTION(reader.ReadStringView("bytes"), IgniteError, IsBinaryError);
+
+    BinaryRawReader rawReader = reader.RawReader();
+
+    BinaryStringView rawStr = rawReader.ReadStringView();
+
+    BOOST_CHECK_EQUAL(std::string(rawStr.GetData(), rawStr.GetLength()), "raw");
+
+    BinaryInt8ArrayView rawArr = rawReader.ReadInt8ArrayView();
+
+    BOOST_REQUIRE_EQUAL(rawArr.GetLength(), 2);
+    BOOST_CHECK(std::equal(bytes, bytes + 2, rawArr.GetData()));
+}
+
+BOOST_AUTO_TEST_CASE(TestDeclaredFields)
+{
+    DeclaredFields val;
+
+    val.id = 42;
+    val.name = "Lorem ipsum";
+    val.weight = 1.5;
+    val.guid = Guid(1, 2);
+    val.address = BinaryAddress("Main st.", 7);
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(val);
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    BOOST_CHECK(reader.ReadTopObject<DeclaredFields>() == val);
+
+    // Fields are accessible by their declared names.
+    TemplatedBinaryIdResolver<DeclaredFields> idRslvr;
+    BinaryObjectImpl obj(mem, 0, &idRslvr, 0);
+
+    BOOST_CHECK_EQUAL(obj.GetField<int32_t>("id"), 42);
+    BOOST_CHECK_EQUAL(obj.GetField<std::string>("title"), val.name);
+    BOOST_CHECK(obj.GetField<BinaryAddress>("address") == val.address);
+}
+
+BOOST_AUTO_TEST_CASE(TestDeclaredRawFields)
+{
+    DeclaredRawFields val;
+
+    val.id = 42;
+    val.name = "Lorem ipsum";
+    val.address = BinaryAddress("Main st.", 7);
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    writer.WriteTopObject(val);
+
+    out.Synchronize();
+
+    BinaryObjectHeader header(mem.Data());
+
+    BOOST_CHECK(!header.HasSchema());
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    BOOST_CHECK(reader.ReadTopObject<DeclaredRawFields>() == val);
+}
+
+BOOST_AUTO_TEST_CASE(TestSchemaExtraFields)
+{
+    BinaryWideOuter val;
+
+    for (int32_t i = 0; i < BinaryWide::FIELDS_NUM; ++i)
+    {
+        val.head.vals[i] = i;
+        val.inner.vals[i] = i * 10;
+    }
+
+    val.tail = 42;
+
+    InteropUnpooledMemory mem(1024);
+
+    InteropOutputStream out(&mem);
+    BinaryWriterImpl writer(&out, 0);
+
+    // Second object reuses the schema storage of the first one.
+    writer.WriteTopObject(val);
+    writer.WriteTopObject(val.inner);
+
+    out.Synchronize();
+
+    InteropInputStream in(&mem);
+    BinaryReaderImpl reader(&in);
+
+    BOOST_CHECK(reader.ReadTopObject<BinaryWideOuter>() == val);
+    BOOST_CHECK(reader.ReadTopObject<BinaryWide>() == val.inner);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
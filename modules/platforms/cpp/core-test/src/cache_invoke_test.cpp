@@ -253,6 +253,53 @@ namespace ignite
     }
 }
 
+/**
+ * Processor throwing for the key equal to the argument.
+ */
+class KeyFailer : public CacheEntryProcessor<int, int, int, int>
+{
+public:
+    /**
+     * Call instance.
+     *
+     * @return Entry value.
+     */
+    virtual int Process(MutableCacheEntry<int, int>& entry, const int& arg)
+    {
+        if (entry.GetKey() == arg)
+            throw IgniteError(IgniteError::IGNITE_ERR_GENERIC, "Key is rejected");
+
+        return entry.IsExists() ? entry.GetValue() : 0;
+    }
+};
+
+namespace ignite
+{
+    namespace binary
+    {
+        /**
+         * Binary type definition for KeyFailer.
+         */
+        IGNITE_BINARY_TYPE_START(KeyFailer)
+            IGNITE_BINARY_GET_TYPE_ID_AS_HASH(KeyFailer)
+            IGNITE_BINARY_GET_TYPE_NAME_AS_IS(KeyFailer)
+            IGNITE_BINARY_GET_FIELD_ID_AS_HASH
+            IGNITE_BINARY_IS_NULL_FALSE(KeyFailer)
+            IGNITE_BINARY_GET_NULL_DEFAULT_CTOR(KeyFailer)
+
+            static void Write(BinaryWriter&, const KeyFailer&)
+            {
+                // No-op.
+            }
+
+            static void Read(BinaryReader&, KeyFailer& dst)
+            {
+                dst = KeyFailer();
+            }
+        IGNITE_BINARY_TYPE_END
+    }
+}
+
 /**
  * Character remover class for invoke tests.
  */
@@ -458,6 +505,7 @@ IGNITE_EXPORTED_CALL void IgniteModuleInit(ignite::IgniteBindingContext& context
 
     binding.RegisterCacheEntryProcessor<CacheEntryModifier>();
     binding.RegisterCacheEntryProcessor<Divisor>();
+    binding.RegisterCacheEntryProcessor<KeyFailer>();
 }
 
 /**
@@ -645,4 +693,155 @@ BOOST_AUTO_TEST_CASE(TestJavaProcessorBinarizable)
     BOOST_CHECK_EQUAL(cache.Get(4), 42);
 }
 
+/**
+ * Test asynchronous cache invoke.
+ */
+BOOST_AUTO_TEST_CASE(TestInvokeAsync)
+{
+    Cache<int, int> cache = node.GetOrCreateCache<int, int>("TestCache");
+
+    cache.Put(7, 20);
+
+    CacheEntryModifier ced(5);
+
+    Future<int> res1 = cache.InvokeAsync<int>(7, ced, 4);
+    Future<int> res2 = cache.InvokeAsync<int>(8, ced, 4);
+
+    BOOST_CHECK_EQUAL(res1.GetValue(), 22);
+    BOOST_CHECK_EQUAL(res2.GetValue(), 84);
+
+    BOOST_CHECK_EQUAL(cache.Get(7), 11);
+    BOOST_CHECK_EQUAL(cache.Get(8), 42);
+}
+
+/**
+ * Test cache invoke on several entries.
+ */
+BOOST_AUTO_TEST_CASE(TestInvokeAll)
+{
+    Cache<int, int> cache = node.GetOrCreateCache<int, int>("TestCache");
+
+    std::set<int> keys;
+
+    for (int i = 200; i < 210; ++i)
+    {
+        cache.Put(i, i);
+
+        keys.insert(i);
+    }
+
+    keys.insert(210);
+
+    CacheEntryModifier ced(1);
+
+    std::map<int, CacheEntryProcessorResult<int> > res = cache.InvokeAll<int>(keys, ced, 2);
+
+    BOOST_REQUIRE_EQUAL(res.size(), 11);
+
+    for (int i = 200; i < 210; ++i)
+    {
+        BOOST_REQUIRE(res[i].IsSuccess());
+
+        BOOST_CHECK_EQUAL(res[i].GetResult(), (i - 3) * 2);
+
+        BOOST_CHECK_EQUAL(cache.Get(i), i - 3);
+    }
+
+    BOOST_CHECK_EQUAL(res[210].GetResult(), 84);
+
+    BOOST_CHECK_EQUAL(cache.Get(210), 42);
+}
+
+/**
+ * Test asynchronous cache invoke on several entries.
+ */
+BOOST_AUTO_TEST_CASE(TestInvokeAllAsync)
+{
+    Cache<int, int> cache = node.GetOrCreateCache<int, int>("TestCache");
+
+    cache.Put(300, 30);
+    cache.Put(301, 60);
+
+    std::set<int> keys;
+
+    keys.insert(300);
+    keys.insert(301);
+
+    Divisor div(2.0);
+
+    Future< std::map<int, CacheEntryProcessorResult<double> > > fut = cache.InvokeAllAsync<double>(keys, div, 3.0);
+
+    std::map<int, CacheEntryProcessorResult<double> > res = fut.GetValue();
+
+    BOOST_REQUIRE_EQUAL(res.size(), 2);
+
+    BOOST_CHECK_CLOSE(res[300].GetResult(), 20.0, 1E-6);
+    BOOST_CHECK_CLOSE(res[301].GetResult(), 40.0, 1E-6);
+
+    BOOST_CHECK_EQUAL(cache.Get(300), 20);
+    BOOST_CHECK_EQUAL(cache.Get(301), 40);
+}
+
+/**
+ * Test cache invoke on several entries with the processor failing for one of them.
+ */
+BOOST_AUTO_TEST_CASE(TestInvokeAllError)
+{
+    Cache<int, int> cache = node.GetOrCreateCache<int, int>("TestCache");
+
+    std::set<int> keys;
+
+    for (int i = 400; i < 405; ++i)
+    {
+        cache.Put(i, i);
+
+        keys.insert(i);
+    }
+
+    std::map<int, CacheEntryProcessorResult<int> > res = cache.InvokeAll<int>(keys, KeyFailer(), 402);
+
+    BOOST_REQUIRE_EQUAL(res.size(), 5);
+
+    for (int i = 400; i < 405; ++i)
+    {
+        if (i == 402)
+            continue;
+
+        BOOST_REQUIRE(res[i].IsSuccess());
+        BOOST_CHECK_EQUAL(res[i].GetResult(), i);
+    }
+
+    BOOST_CHECK(!res[402].IsSuccess());
+    BOOST_CHECK_NE(res[402].GetError().GetCode(), IgniteError::IGNITE_SUCCESS);
+    BOOST_CHECK(std::string(res[402].GetError().GetText()).find("Key is rejected") != std::string::npos);
+    BOOST_CHECK_THROW(res[402].GetResult(), IgniteError);
+}
+
+/**
+ * Test asynchronous cache invoke on several entries with the processor failing for one of them.
+ */
+BOOST_AUTO_TEST_CASE(TestInvokeAllAsyncError)
+{
+    Cache<int, int> cache = node.GetOrCreateCache<int, int>("TestCache");
+
+    cache.Put(500, 5);
+    cache.Put(501, 6);
+
+    std::set<int> keys;
+
+    keys.insert(500);
+    keys.insert(501);
+
+    Future< std::map<int, CacheEntryProcessorResult<int> > > fut = cache.InvokeAllAsync<int>(keys, KeyFailer(), 501);
+
+    std::map<int, CacheEntryProcessorResult<int> > res = fut.GetValue();
+
+    BOOST_REQUIRE_EQUAL(res.size(), 2);
+
+    BOOST_CHECK_EQUAL(res[500].GetResult(), 5);
+
+    BOOST_CHECK(!res[501].IsSuccess());
+    BOOST_CHECK(std::string(res[501].GetError().GetText()).find("Key is rejected") != std::string::npos);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -753,7 +753,8 @@ struct CacheQueryTestSuiteFixture
 #endif
     }
 
-    void CheckFieldsQueryPages(int32_t pageSize, int32_t pagesNum, int32_t additionalNum)
+    void CheckFieldsQueryPages(int32_t pageSize, int32_t pagesNum, int32_t additionalNum,
+        int32_t prefetchDepth = 0, bool reuseRow = false)
     {
         // Test simple query.
         Cache<int, QueryPerson> cache = GetPersonCache();
@@ -779,9 +780,12 @@ struct CacheQueryTestSuiteFixture
         }
 
         cursor = cache.Query(qry);
+        cursor.SetPrefetchDepth(prefetchDepth);
 
         IgniteError error;
 
+        QueryFieldsRow row;
+
         for (int i = 0; i < entryCnt; i++)
         {
             std::stringstream stream;
@@ -794,7 +798,11 @@ struct CacheQueryTestSuiteFixture
             BOOST_REQUIRE(cursor.HasNext(error));
             BOOST_REQUIRE(error.GetCode() == IgniteError::IGNITE_SUCCESS);
 
-            QueryFieldsRow row = cursor.GetNext(error);
+            if (reuseRow)
+                cursor.GetNext(row, error);
+            else
+                row = cursor.GetNext(error);
+
             BOOST_REQUIRE(error.GetCode() == IgniteError::IGNITE_SUCCESS);
 
             BOOST_REQUIRE(row.HasNext(error));
@@ -1915,6 +1923,30 @@ BOOST_AUTO_TEST_CASE(TestFieldsQueryPageSingle)
     CheckFieldsQueryPages(1, 100, 0);
 }
 
+/**
+ * Test fields query with several pages prefetched in background.
+ */
+BOOST_AUTO_TEST_CASE(TestFieldsQueryPagesPrefetch)
+{
+    CheckFieldsQueryPages(32, 8, 1, 2);
+}
+
+/**
+ * Test fields query with page size 1 prefetched in background.
+ */
+BOOST_AUTO_TEST_CASE(TestFieldsQueryPageSinglePrefetch)
+{
+    CheckFieldsQueryPages(1, 100, 0, 4);
+}
+
+/**
+ * Test fields query reusing the row instance.
+ */
+BOOST_AUTO_TEST_CASE(TestFieldsQueryPagesReuseRow)
+{
+    CheckFieldsQueryPages(32, 8, 1, 2, true);
+}
+
 /**
  * Test fields query with page size 0.
  */
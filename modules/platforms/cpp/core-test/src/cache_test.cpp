@@ -15,9 +15,14 @@
  * limitations under the License.
  */
 
+#include <stdexcept>
+
 #include <boost/test/unit_test.hpp>
+#include <boost/chrono.hpp>
+#include <boost/thread.hpp>
 
 #include "ignite/cache/cache_peek_mode.h"
+#include "ignite/common/concurrent.h"
 #include "ignite/ignite.h"
 #include "ignite/ignition.h"
 #include "ignite/test_utils.h"
@@ -307,6 +312,75 @@ BOOST_AUTO_TEST_CASE(TestPutAllIterVector)
         BOOST_REQUIRE(i + 1 == cache.Get(i));
 }
 
+BOOST_AUTO_TEST_CASE(TestExecuteBatch)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    cache.Put(1, 10);
+
+    cache::CacheBatch<int, int> batch;
+
+    for (int i = 0; i < 100; i++)
+        batch.Put(i + 100, i);
+
+    batch.PutIfAbsent(1, 11);
+    batch.PutIfAbsent(2, 20);
+    batch.Get(1);
+    batch.Get(3);
+    batch.ContainsKey(150);
+    batch.Remove(2);
+
+    cache.ExecuteBatch(batch);
+
+    BOOST_CHECK_EQUAL(batch.GetExecuted(), batch.GetSize());
+
+    BOOST_CHECK(!batch.GetFlag(100));
+    BOOST_CHECK(batch.GetFlag(101));
+    BOOST_CHECK_EQUAL(batch.GetValue(102), 10);
+    BOOST_CHECK_EQUAL(batch.GetValue(103), 0);
+    BOOST_CHECK(batch.GetFlag(104));
+    BOOST_CHECK(batch.GetFlag(105));
+
+    for (int i = 0; i < 100; i++)
+        BOOST_CHECK_EQUAL(cache.Get(i + 100), i);
+
+    BOOST_CHECK(!cache.ContainsKey(2));
+}
+
+BOOST_AUTO_TEST_CASE(TestExecuteBatchFailure)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    cache::CacheBatch<int, int> batch;
+
+    batch.Put(1, 1);
+    batch.Get(1);
+
+    cache.ExecuteBatch(batch);
+
+    BOOST_CHECK_EQUAL(batch.GetExecuted(), 2);
+
+    // Operations of the timed out transaction fail.
+    transactions::Transaction tx = grid0.GetTransactions().TxStart(
+        transactions::TransactionConcurrency::PESSIMISTIC, transactions::TransactionIsolation::READ_COMMITTED, 100, 0);
+
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(500));
+
+    IgniteError err;
+
+    cache.ExecuteBatch(batch, err);
+
+    BOOST_CHECK_NE(err.GetCode(), IgniteError::IGNITE_SUCCESS);
+    BOOST_CHECK_EQUAL(batch.GetExecuted(), 0);
+
+    tx.Rollback(err);
+
+    cache.ExecuteBatch(batch);
+
+    BOOST_CHECK_EQUAL(batch.GetExecuted(), 2);
+    BOOST_CHECK_EQUAL(batch.GetValue(1), 1);
+}
+
 BOOST_AUTO_TEST_CASE(TestPutIfAbsent)
 {
     cache::Cache<int, int> cache = Cache();
@@ -660,6 +734,195 @@ BOOST_AUTO_TEST_CASE(TestLocalEvictIterArray)
     BOOST_REQUIRE(5 == cache.LocalPeek(1, cache::CachePeekMode::ONHEAP));
 }
 
+BOOST_AUTO_TEST_CASE(TestLocalEntries)
+{
+    cache::Cache<int, int> cache0 = Cache();
+    cache::Cache<int, int> cache1 = grid1.GetCache<int, int>("partitioned");
+
+    // More than one batch.
+    for (int i = 0; i < 3000; i++)
+        cache0.Put(i, i * 2);
+
+    std::set<int> keys;
+
+    cache::CacheEntryIterator<int, int> iter0 = cache0.LocalEntries(cache::CachePeekMode::PRIMARY);
+    cache::CacheEntryIterator<int, int> iter1 = cache1.LocalEntries(cache::CachePeekMode::PRIMARY);
+
+    while (iter0.HasNext())
+    {
+        cache::CacheEntry<int, int> entry = iter0.GetNext();
+
+        BOOST_CHECK_EQUAL(entry.GetKey() * 2, entry.GetValue());
+        BOOST_CHECK(keys.insert(entry.GetKey()).second);
+    }
+
+    int32_t locCnt0 = static_cast<int32_t>(keys.size());
+
+    BOOST_CHECK_EQUAL(locCnt0, cache0.LocalSize(cache::CachePeekMode::PRIMARY));
+
+    while (iter1.HasNext())
+        BOOST_CHECK(keys.insert(iter1.GetNext().GetKey()).second);
+
+    BOOST_CHECK_EQUAL(3000, static_cast<int32_t>(keys.size()));
+
+    IgniteError err;
+
+    iter0.GetNext(err);
+
+    BOOST_CHECK_EQUAL(IgniteError::IGNITE_ERR_GENERIC, err.GetCode());
+}
+
+/**
+ * Collects visited keys. Safe to use from several threads.
+ */
+struct KeyCollector
+{
+    void operator()(const cache::CacheEntry<int, int>& entry)
+    {
+        common::concurrent::CsLockGuard guard(mux);
+
+        keys.insert(entry.GetKey());
+    }
+
+    common::concurrent::CriticalSection mux;
+
+    std::set<int> keys;
+};
+
+BOOST_AUTO_TEST_CASE(TestLocalPartitionEntries)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    for (int i = 0; i < 3000; i++)
+        cache.Put(i, i);
+
+    cache::CacheAffinity<int> affinity = grid0.GetAffinity<int>("partitioned");
+
+    std::vector<int32_t> parts = affinity.GetPrimaryPartitions(grid0.GetCluster().GetLocalNode());
+
+    BOOST_REQUIRE(!parts.empty());
+
+    std::set<int> keys;
+
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        cache::CacheEntryIterator<int, int> iter = cache.LocalPartitionEntries(parts[i]);
+
+        while (iter.HasNext())
+        {
+            int key = iter.GetNext().GetKey();
+
+            BOOST_CHECK_EQUAL(parts[i], affinity.GetPartition(key));
+
+            keys.insert(key);
+        }
+    }
+
+    BOOST_CHECK_EQUAL(cache.LocalSize(cache::CachePeekMode::PRIMARY), static_cast<int32_t>(keys.size()));
+
+    KeyCollector collector;
+
+    cache.LocalPartitionsForEach(parts, collector, 4);
+
+    BOOST_CHECK(keys == collector.keys);
+}
+
+/**
+ * Visitor which fails on the first entry.
+ */
+struct FailingVisitor
+{
+    void operator()(const cache::CacheEntry<int, int>&)
+    {
+        throw std::runtime_error("Test error");
+    }
+};
+
+/**
+ * Count keys the node is primary or backup for.
+ *
+ * @param affinity Affinity.
+ * @param node Node.
+ * @param keyCnt Number of keys starting from zero.
+ * @return Number of keys.
+ */
+int32_t CountOwnedKeys(cache::CacheAffinity<int>& affinity, cluster::ClusterNode node, int keyCnt)
+{
+    int32_t res = 0;
+
+    for (int i = 0; i < keyCnt; i++)
+    {
+        if (affinity.IsPrimaryOrBackup(node, i))
+            ++res;
+    }
+
+    return res;
+}
+
+BOOST_AUTO_TEST_CASE(TestLocalPartitionEntriesEarlyStop)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    for (int i = 0; i < 3000; i++)
+        cache.Put(i, i);
+
+    cache::CacheAffinity<int> affinity = grid0.GetAffinity<int>("partitioned");
+
+    cluster::ClusterNode node = grid0.GetCluster().GetLocalNode();
+
+    std::vector<int32_t> parts = affinity.GetPrimaryPartitions(node);
+
+    BOOST_REQUIRE(!parts.empty());
+
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        cache::CacheEntryIterator<int, int> iter = cache.LocalPartitionEntries(parts[i]);
+
+        if (iter.HasNext())
+            iter.GetNext();
+
+        // The rest of the iterators are closed on destruction.
+        if (i % 2 == 0)
+        {
+            iter.Close();
+
+            BOOST_CHECK(!iter.HasNext());
+        }
+    }
+
+    FailingVisitor visitor;
+
+    IgniteError err;
+
+    cache.LocalPartitionsForEach(parts, visitor, 4, err);
+
+    BOOST_CHECK_EQUAL(IgniteError::IGNITE_ERR_STD, err.GetCode());
+
+    int32_t ownedBefore = CountOwnedKeys(affinity, node, 3000);
+
+    // Partitions moved to the new node are evicted only if they are not reserved.
+#ifdef IGNITE_TESTS_32
+    Ignite grid2 = ignite_test::StartNode("cache-test-32.xml", "grid-2");
+#else
+    Ignite grid2 = ignite_test::StartNode("cache-test.xml", "grid-2");
+#endif
+
+    int32_t owned = ownedBefore;
+
+    for (int i = 0; i < 300; i++)
+    {
+        owned = CountOwnedKeys(affinity, node, 3000);
+
+        if (owned < ownedBefore && cache.LocalSize(cache::CachePeekMode::ALL) == owned)
+            break;
+
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+    }
+
+    BOOST_CHECK_LT(owned, ownedBefore);
+    BOOST_CHECK_EQUAL(owned, cache.LocalSize(cache::CachePeekMode::ALL));
+}
+
 BOOST_AUTO_TEST_CASE(TestBinary)
 {
     cache::Cache<int, Person> cache = grid0.GetCache<int, Person>("partitioned");
@@ -770,6 +1033,116 @@ BOOST_AUTO_TEST_CASE(TestPutGetStructWithEnumField)
     PutGetStructWithEnumField(1337, TestEnum::TEST_SOME_BIG, "Some test value");
 }
 
+BOOST_AUTO_TEST_CASE(TestPutGetAsync)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    std::vector< ignite::Future<void> > puts;
+
+    for (int i = 0; i < 100; i++)
+        puts.push_back(cache.PutAsync(i, i * 2));
+
+    for (size_t i = 0; i < puts.size(); i++)
+        puts[i].GetValue();
+
+    ignite::Future<int> get = cache.GetAsync(42);
+    ignite::Future<int> getMissing = cache.GetAsync(1000);
+
+    BOOST_CHECK_EQUAL(get.GetValue(), 84);
+    BOOST_CHECK_EQUAL(getMissing.GetValue(), 0);
+
+    BOOST_CHECK(cache.ContainsKeyAsync(1).GetValue());
+    BOOST_CHECK(!cache.ContainsKeyAsync(1000).GetValue());
+}
+
+BOOST_AUTO_TEST_CASE(TestPutAllGetAllAsync)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    std::map<int, int> map;
+    std::set<int> keys;
+
+    for (int i = 0; i < 100; i++)
+    {
+        map[i] = i + 1;
+        keys.insert(i);
+    }
+
+    cache.PutAllAsync(map).GetValue();
+
+    BOOST_CHECK(cache.ContainsKeysAsync(keys).GetValue());
+
+    std::map<int, int> res = cache.GetAllAsync(keys).GetValue();
+
+    BOOST_CHECK_EQUAL(res.size(), 100);
+
+    for (int i = 0; i < 100; i++)
+        BOOST_CHECK_EQUAL(res[i], i + 1);
+
+    cache.RemoveAllAsync(keys).GetValue();
+
+    BOOST_CHECK(!cache.ContainsKeyAsync(1).GetValue());
+}
+
+BOOST_AUTO_TEST_CASE(TestModifyAsync)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    BOOST_CHECK(cache.PutIfAbsentAsync(1, 3).GetValue());
+    BOOST_CHECK(!cache.PutIfAbsentAsync(1, 4).GetValue());
+
+    BOOST_CHECK_EQUAL(cache.GetAndPutAsync(1, 5).GetValue(), 3);
+    BOOST_CHECK_EQUAL(cache.GetAndPutIfAbsentAsync(1, 6).GetValue(), 5);
+    BOOST_CHECK_EQUAL(cache.GetAndReplaceAsync(1, 7).GetValue(), 5);
+
+    BOOST_CHECK(!cache.ReplaceAsync(1, 5, 8).GetValue());
+    BOOST_CHECK(cache.ReplaceAsync(1, 7, 8).GetValue());
+    BOOST_CHECK(cache.ReplaceAsync(1, 9).GetValue());
+    BOOST_CHECK(!cache.ReplaceAsync(2, 9).GetValue());
+
+    BOOST_CHECK(!cache.RemoveAsync(1, 8).GetValue());
+    BOOST_CHECK(cache.RemoveAsync(1, 9).GetValue());
+    BOOST_CHECK(!cache.RemoveAsync(1).GetValue());
+
+    cache.Put(2, 2);
+
+    BOOST_CHECK_EQUAL(cache.GetAndRemoveAsync(2).GetValue(), 2);
+    BOOST_CHECK(!cache.ContainsKey(2));
+}
+
+BOOST_AUTO_TEST_CASE(TestClearAsync)
+{
+    cache::Cache<int, int> cache = Cache();
+
+    for (int i = 0; i < 10; i++)
+        cache.Put(i, i);
+
+    cache.ClearAsync(1).GetValue();
+
+    BOOST_CHECK(!cache.ContainsKey(1));
+
+    std::set<int> keys;
+
+    keys.insert(2);
+    keys.insert(3);
+
+    cache.ClearAllAsync(keys).GetValue();
+
+    BOOST_CHECK(!cache.ContainsKey(2));
+    BOOST_CHECK(!cache.ContainsKey(3));
+    BOOST_CHECK(cache.ContainsKey(4));
+
+    cache.ClearAsync().GetValue();
+
+    BOOST_CHECK(cache.IsEmpty());
+
+    cache.Put(1, 1);
+
+    cache.RemoveAllAsync().GetValue();
+
+    BOOST_CHECK(cache.IsEmpty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_FIXTURE_TEST_SUITE(CacheTestSuiteNativePersistence, CacheNativePersistenceTestSuiteFixture);
@@ -441,10 +441,93 @@ struct FuncAffinityRun : ComputeFunc<void>
     IgniteError err;
 };
 
+struct FuncSquare
+{
+    FuncSquare() :
+        add()
+    {
+        // No-op.
+    }
+
+    FuncSquare(int32_t add) :
+        add(add)
+    {
+        // No-op.
+    }
+
+    int32_t Apply(const int32_t& arg)
+    {
+        return arg * arg + add;
+    }
+
+    int32_t add;
+};
+
+class TaskCount : public ComputeTask<Func1, std::string, int32_t>
+{
+public:
+    TaskCount(int32_t jobs, bool mapErr, bool jobErr) :
+        jobs(jobs), mapErr(mapErr), jobErr(jobErr), cnt(0)
+    {
+        // No-op.
+    }
+
+    virtual void Map(const std::vector<ClusterNode>& subgrid, JobMapping& mapping)
+    {
+        if (mapErr)
+            throw MakeTestError();
+
+        for (int32_t i = 0; i < jobs; ++i)
+        {
+            Func1 job = jobErr ? Func1(MakeTestError()) : Func1(i, i);
+
+            mapping.push_back(std::make_pair(job, subgrid[i % subgrid.size()]));
+        }
+    }
+
+    virtual ComputeJobResultPolicy::Type OnResult(const std::string& res)
+    {
+        if (!res.empty())
+            ++cnt;
+
+        return ComputeJobResultPolicy::WAIT;
+    }
+
+    virtual int32_t Reduce()
+    {
+        return cnt;
+    }
+
+private:
+    int32_t jobs;
+    bool mapErr;
+    bool jobErr;
+    int32_t cnt;
+};
+
 namespace ignite
 {
     namespace binary
     {
+        template<>
+        struct BinaryType<FuncSquare> : BinaryTypeDefaultAll<FuncSquare>
+        {
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "FuncSquare";
+            }
+
+            static void Write(BinaryWriter& writer, const FuncSquare& obj)
+            {
+                writer.WriteInt32("add", obj.add);
+            }
+
+            static void Read(BinaryReader& reader, FuncSquare& dst)
+            {
+                dst.add = reader.ReadInt32("add");
+            }
+        };
+
         template<>
         struct BinaryType<Func1> : BinaryTypeDefaultAll<Func1>
         {
@@ -573,6 +656,7 @@ IGNITE_EXPORTED_CALL void IgniteModuleInit1(IgniteBindingContext& context)
     binding.RegisterComputeFunc<Func3>();
     binding.RegisterComputeFunc<FuncAffinityCall>();
     binding.RegisterComputeFunc<FuncAffinityRun>();
+    binding.RegisterComputeApplyFunc<FuncSquare, int32_t, int32_t>();
 }
 
 template<typename TK>
@@ -1058,6 +1142,98 @@ BOOST_AUTO_TEST_CASE(IgniteBroadcastRemoteError)
     BOOST_CHECK_EXCEPTION(res.GetValue(), IgniteError, IsTestError);
 }
 
+BOOST_AUTO_TEST_CASE(IgniteExecuteTaskLocal)
+{
+    Compute compute = node.GetCompute();
+
+    BOOST_TEST_CHECKPOINT("Executing");
+    int32_t res = compute.Execute(TaskCount(10, false, false));
+
+    BOOST_CHECK_EQUAL(res, 10);
+}
+
+BOOST_AUTO_TEST_CASE(IgniteExecuteTaskRemote)
+{
+    Ignite node2 = MakeNode("ComputeNode2");
+    Compute compute = node.GetCompute();
+
+    BOOST_TEST_CHECKPOINT("Executing");
+    Future<int32_t> res = compute.ExecuteAsync(TaskCount(10, false, false));
+
+    BOOST_CHECK_EQUAL(res.GetValue(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(IgniteExecuteTaskMapError)
+{
+    Compute compute = node.GetCompute();
+
+    BOOST_TEST_CHECKPOINT("Executing");
+
+    BOOST_CHECK_EXCEPTION(compute.Execute(TaskCount(10, true, false)), IgniteError, IsTestError);
+}
+
+BOOST_AUTO_TEST_CASE(IgniteExecuteTaskJobError)
+{
+    Ignite node2 = MakeNode("ComputeNode2");
+    Compute compute = node.GetCompute();
+
+    BOOST_TEST_CHECKPOINT("Executing");
+
+    BOOST_CHECK_EXCEPTION(compute.Execute(TaskCount(10, false, true)), IgniteError, IsTestError);
+}
+
+BOOST_AUTO_TEST_CASE(IgniteApplyLocal)
+{
+    Compute compute = node.GetCompute();
+
+    std::vector<int32_t> args;
+
+    for (int32_t i = 0; i < 100; ++i)
+        args.push_back(i);
+
+    BOOST_TEST_CHECKPOINT("Applying");
+    std::vector<int32_t> res = compute.Apply<int32_t>(FuncSquare(1), args);
+
+    BOOST_REQUIRE_EQUAL(res.size(), args.size());
+
+    for (int32_t i = 0; i < 100; ++i)
+        BOOST_CHECK_EQUAL(res[i], i * i + 1);
+
+    BOOST_CHECK(compute.Apply<int32_t>(FuncSquare(1), std::vector<int32_t>()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(IgniteApplyRemote)
+{
+    Ignite node2 = MakeNode("ComputeNode2");
+    Compute compute = node.GetCompute();
+
+    std::vector<int32_t> args;
+
+    for (int32_t i = 0; i < 101; ++i)
+        args.push_back(i);
+
+    BOOST_TEST_CHECKPOINT("Applying");
+    Future< std::vector<int32_t> > res = compute.ApplyAsync<int32_t>(FuncSquare(0), args);
+
+    std::vector<int32_t> value = res.GetValue();
+
+    BOOST_REQUIRE_EQUAL(value.size(), args.size());
+
+    for (int32_t i = 0; i < 101; ++i)
+        BOOST_CHECK_EQUAL(value[i], i * i);
+}
+
+BOOST_AUTO_TEST_CASE(IgniteApplyJobTypeId)
+{
+    typedef ignite::impl::compute::ComputeApplyJob<FuncSquare, int32_t, int32_t> IntJob;
+    typedef ignite::impl::compute::ComputeApplyJob<FuncSquare, int64_t, int32_t> LongJob;
+
+    int32_t intJobTypeId = ignite::binary::BinaryType<IntJob>::GetTypeId();
+    int32_t longJobTypeId = ignite::binary::BinaryType<LongJob>::GetTypeId();
+
+    BOOST_CHECK_NE(intJobTypeId, longJobTypeId);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_FIXTURE_TEST_SUITE(ComputeTestSuiteClusterGroup, ComputeTestSuiteFixtureClusterGroup)
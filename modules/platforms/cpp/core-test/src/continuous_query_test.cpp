@@ -21,6 +21,7 @@
 #include <boost/optional.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
 
 #include "ignite/ignition.h"
 #include "ignite/cache/cache.h"
@@ -171,6 +172,140 @@ private:
     ConcurrentQueue< CacheEntryEvent<K, V> > eventQueue;
 };
 
+/*
+ * Test listener which records sizes of the event batches.
+ */
+template<typename K, typename V>
+class BatchListener : public CacheEntryEventListener<K, V>
+{
+public:
+    /**
+     * Event callback.
+     *
+     * @param evts Events.
+     * @param num Events number.
+     */
+    virtual void OnEvent(const CacheEntryEvent<K, V>*, uint32_t num)
+    {
+        batches.Push(num);
+    }
+
+    /** Sizes of the received batches. */
+    ConcurrentQueue<uint32_t> batches;
+};
+
+/*
+ * Test listener which takes some time to process every event.
+ */
+template<typename K, typename V>
+class SlowListener : public CacheEntryEventListener<K, V>
+{
+public:
+    /*
+     * Default constructor.
+     */
+    SlowListener() :
+        cnt(0)
+    {
+        // No-op.
+    }
+
+    /**
+     * Event callback.
+     *
+     * @param evts Events.
+     * @param num Events number.
+     */
+    virtual void OnEvent(const CacheEntryEvent<K, V>*, uint32_t num)
+    {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+
+        boost::unique_lock<boost::mutex> guard(mutex);
+
+        cnt += num;
+    }
+
+    /*
+     * Get number of the processed events.
+     *
+     * @return Number of the processed events.
+     */
+    uint32_t GetCount()
+    {
+        boost::unique_lock<boost::mutex> guard(mutex);
+
+        return cnt;
+    }
+
+private:
+    boost::mutex mutex;
+
+    uint32_t cnt;
+};
+
+/*
+ * Test listener which blocks in the event callback until released.
+ */
+template<typename K, typename V>
+class BlockingListener : public CacheEntryEventListener<K, V>
+{
+public:
+    /*
+     * Default constructor.
+     */
+    BlockingListener() :
+        released(false)
+    {
+        // No-op.
+    }
+
+    /**
+     * Event callback.
+     *
+     * @param evts Events.
+     * @param num Events number.
+     */
+    virtual void OnEvent(const CacheEntryEvent<K, V>*, uint32_t)
+    {
+        boost::unique_lock<boost::mutex> guard(mutex);
+
+        while (!released)
+            cv.wait(guard);
+    }
+
+    /**
+     * Error callback.
+     *
+     * @param err Error.
+     */
+    virtual void OnError(const IgniteError& err)
+    {
+        errors.Push(err);
+    }
+
+    /*
+     * Let the event callback return.
+     */
+    void Release()
+    {
+        boost::unique_lock<boost::mutex> guard(mutex);
+
+        released = true;
+
+        cv.notify_all();
+    }
+
+    /** Received errors. */
+    ConcurrentQueue<IgniteError> errors;
+
+private:
+    boost::mutex mutex;
+
+    boost::condition_variable cv;
+
+    bool released;
+};
+
 /**
  * Only lets through keys from the range.
  */
@@ -655,6 +790,88 @@ BOOST_AUTO_TEST_CASE(TestPublicPrivateConstantsConsistence)
 
     BOOST_CHECK_EQUAL(static_cast<int>(QueryImplType::DEFAULT_BUFFER_SIZE),
         static_cast<int>(QueryType::DEFAULT_BUFFER_SIZE));
+
+    BOOST_CHECK_EQUAL(static_cast<int>(QueryImplType::DEFAULT_EVENT_QUEUE_SIZE),
+        static_cast<int>(QueryType::DEFAULT_EVENT_QUEUE_SIZE));
+
+    BOOST_CHECK_EQUAL(static_cast<int>(QueryImplType::DEFAULT_EVENT_BATCH_SIZE),
+        static_cast<int>(QueryType::DEFAULT_EVENT_BATCH_SIZE));
+
+    BOOST_CHECK_EQUAL(static_cast<int>(QueryImplType::DEFAULT_EVENT_BATCH_DELAY),
+        static_cast<int>(QueryType::DEFAULT_EVENT_BATCH_DELAY));
+}
+
+BOOST_AUTO_TEST_CASE(TestGetSetEventQueue)
+{
+    typedef ContinuousQuery<int, TestEntry> QueryType;
+    Listener<int, TestEntry> lsnr;
+
+    ContinuousQuery<int, TestEntry> qry(MakeReference(lsnr));
+
+    BOOST_CHECK_EQUAL(qry.GetEventQueueSize(), static_cast<int>(QueryType::DEFAULT_EVENT_QUEUE_SIZE));
+    BOOST_CHECK_EQUAL(qry.GetEventBatchSize(), static_cast<int>(QueryType::DEFAULT_EVENT_BATCH_SIZE));
+    BOOST_CHECK_EQUAL(qry.GetEventBatchDelay(), static_cast<int>(QueryType::DEFAULT_EVENT_BATCH_DELAY));
+    BOOST_CHECK_EQUAL(qry.GetOverflowPolicy(), ContinuousQueryOverflowPolicy::BLOCK);
+
+    qry.SetEventQueueSize(100);
+    qry.SetEventBatchSize(10);
+    qry.SetEventBatchDelay(50);
+    qry.SetOverflowPolicy(ContinuousQueryOverflowPolicy::DROP_OLDEST);
+
+    BOOST_CHECK_EQUAL(qry.GetEventQueueSize(), 100);
+    BOOST_CHECK_EQUAL(qry.GetEventBatchSize(), 10);
+    BOOST_CHECK_EQUAL(qry.GetEventBatchDelay(), 50);
+    BOOST_CHECK_EQUAL(qry.GetOverflowPolicy(), ContinuousQueryOverflowPolicy::DROP_OLDEST);
+
+    ContinuousQueryHandle<int, TestEntry> handle = cache.QueryContinuous(qry);
+
+    CheckEvents(cache, lsnr);
+}
+
+BOOST_AUTO_TEST_CASE(TestEventQueueBatch)
+{
+    BatchListener<int, TestEntry> lsnr;
+
+    ContinuousQuery<int, TestEntry> qry(MakeReference(lsnr));
+
+    qry.SetEventQueueSize(100);
+    qry.SetEventBatchSize(10);
+    qry.SetEventBatchDelay(5000);
+
+    ContinuousQueryHandle<int, TestEntry> handle = cache.QueryContinuous(qry);
+
+    for (int i = 0; i < 10; ++i)
+        cache.Put(i, TestEntry(i));
+
+    // Full batch is delivered without waiting for the delay.
+    uint32_t num = 0;
+
+    BOOST_REQUIRE(lsnr.batches.Pull(num, boost::chrono::seconds(2)));
+    BOOST_CHECK_EQUAL(num, 10);
+}
+
+BOOST_AUTO_TEST_CASE(TestEventQueueOverflowFail)
+{
+    BlockingListener<int, TestEntry> lsnr;
+
+    ContinuousQuery<int, TestEntry> qry(MakeReference(lsnr));
+
+    qry.SetEventQueueSize(2);
+    qry.SetEventBatchSize(1);
+    qry.SetOverflowPolicy(ContinuousQueryOverflowPolicy::FAIL);
+
+    ContinuousQueryHandle<int, TestEntry> handle = cache.QueryContinuous(qry);
+
+    // First event blocks the listener, next two fill the queue.
+    for (int i = 0; i < 4; ++i)
+        cache.Put(i, TestEntry(i));
+
+    lsnr.Release();
+
+    IgniteError err;
+
+    BOOST_REQUIRE(lsnr.errors.Pull(err, boost::chrono::seconds(2)));
+    BOOST_CHECK_EQUAL(err.GetCode(), IgniteError::IGNITE_ERR_GENERIC);
 }
 
 BOOST_AUTO_TEST_CASE(TestFilterSingleNode)
@@ -744,4 +961,50 @@ BOOST_AUTO_TEST_CASE(TestFilterMultipleNodes)
     lsnr.CheckNextEvent(149, boost::none, TestEntry(1490));
 }
 
+BOOST_AUTO_TEST_CASE(TestNativeThreadPool)
+{
+    Ignition::StopAll(false);
+
+    IgniteConfiguration cfg;
+
+#ifdef IGNITE_TESTS_32
+    ignite_test::InitConfig(cfg, "cache-query-continuous-32.xml");
+#else
+    ignite_test::InitConfig(cfg, "cache-query-continuous.xml");
+#endif
+
+    cfg.nativeThreadPoolSize = 4;
+
+    node = Ignition::Start(cfg, "node-01");
+    cache = node.GetCache<int, TestEntry>("transactional_no_backup");
+
+    Listener<int, TestEntry> lsnr;
+
+    ContinuousQuery<int, TestEntry> qry(MakeReference(lsnr));
+
+    ContinuousQueryHandle<int, TestEntry> handle = cache.QueryContinuous(qry);
+
+    CheckEvents(cache, lsnr);
+
+    handle = ContinuousQueryHandle<int, TestEntry>();
+
+    SlowListener<int, TestEntry> slowLsnr;
+
+    ContinuousQuery<int, TestEntry> slowQry(MakeReference(slowLsnr));
+
+    handle = cache.QueryContinuous(slowQry);
+
+    for (int i = 100; i < 200; ++i)
+        cache.Put(i, TestEntry(i * 10));
+
+    // Closing the query waits for the queued events to be processed.
+    handle = ContinuousQueryHandle<int, TestEntry>();
+
+    uint32_t processed = slowLsnr.GetCount();
+
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(500));
+
+    BOOST_CHECK_EQUAL(slowLsnr.GetCount(), processed);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
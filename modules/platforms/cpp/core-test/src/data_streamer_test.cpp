@@ -0,0 +1,290 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+
+#include <boost/test/unit_test.hpp>
+
+#include "ignite/ignite.h"
+#include "ignite/ignition.h"
+
+#include "ignite/ignite_binding_context.h"
+#include "ignite/datastreamer/data_streamer.h"
+
+#include "ignite/test_utils.h"
+
+using namespace boost::unit_test;
+
+using namespace ignite;
+using namespace ignite::cache;
+using namespace ignite::datastreamer;
+
+/**
+ * Stream receiver which adds a number to every value before putting it.
+ */
+class IncrementingReceiver : public StreamReceiver<int, int>
+{
+public:
+    /**
+     * Constructor.
+     */
+    IncrementingReceiver() : num(0)
+    {
+        // No-op.
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param num Number to add to every value.
+     */
+    IncrementingReceiver(int num) : num(num)
+    {
+        // No-op.
+    }
+
+    /**
+     * Update cache with the entries.
+     *
+     * @param cache Cache.
+     * @param entries Entries.
+     */
+    virtual void Receive(Cache<int, int>& cache, const std::vector< CacheEntry<int, int> >& entries)
+    {
+        std::map<int, int> vals;
+
+        for (std::vector< CacheEntry<int, int> >::const_iterator it = entries.begin(); it != entries.end(); ++it)
+            vals[it->GetKey()] = it->GetValue() + num;
+
+        cache.PutAll(vals);
+    }
+
+    /**
+     * Get number.
+     *
+     * @return Number to add to every value.
+     */
+    int GetNum() const
+    {
+        return num;
+    }
+
+private:
+    /** Number to add. */
+    int num;
+};
+
+namespace ignite
+{
+    namespace binary
+    {
+        /**
+         * Binary type definition for IncrementingReceiver.
+         */
+        IGNITE_BINARY_TYPE_START(IncrementingReceiver)
+            IGNITE_BINARY_GET_TYPE_ID_AS_HASH(IncrementingReceiver)
+            IGNITE_BINARY_GET_TYPE_NAME_AS_IS(IncrementingReceiver)
+            IGNITE_BINARY_GET_FIELD_ID_AS_HASH
+            IGNITE_BINARY_IS_NULL_FALSE(IncrementingReceiver)
+            IGNITE_BINARY_GET_NULL_DEFAULT_CTOR(IncrementingReceiver)
+
+            static void Write(BinaryWriter& writer, const IncrementingReceiver& obj)
+            {
+                writer.WriteInt32("num", obj.GetNum());
+            }
+
+            static void Read(BinaryReader& reader, IncrementingReceiver& dst)
+            {
+                int num = reader.ReadInt32("num");
+
+                dst = IncrementingReceiver(num);
+            }
+        IGNITE_BINARY_TYPE_END
+    }
+}
+
+IGNITE_EXPORTED_CALL void IgniteModuleInit2(ignite::IgniteBindingContext& context)
+{
+    IgniteBinding binding = context.GetBinding();
+
+    binding.RegisterStreamReceiver<IncrementingReceiver>();
+}
+
+/**
+ * Test setup fixture.
+ */
+struct DataStreamerTestSuiteFixture
+{
+    Ignite node;
+
+    /**
+     * Constructor.
+     */
+    DataStreamerTestSuiteFixture() :
+#ifdef IGNITE_TESTS_32
+        node(ignite_test::StartNode("cache-test-32.xml", "DataStreamerTest"))
+#else
+        node(ignite_test::StartNode("cache-test.xml", "DataStreamerTest"))
+#endif
+    {
+        // No-op.
+    }
+
+    /**
+     * Destructor.
+     */
+    ~DataStreamerTestSuiteFixture()
+    {
+        Ignition::StopAll(true);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(DataStreamerTestSuite, DataStreamerTestSuiteFixture)
+
+BOOST_AUTO_TEST_CASE(TestAddFlush)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    BOOST_CHECK_EQUAL(streamer.GetCacheName(), std::string("partitioned"));
+
+    // Small buffer to make sure batches are sent before flush.
+    streamer.SetPerNodeBufferSize(7);
+
+    BOOST_CHECK_EQUAL(streamer.GetPerNodeBufferSize(), 7);
+
+    for (int i = 0; i < 1000; ++i)
+        streamer.AddData(i, i * 10);
+
+    streamer.Flush();
+
+    BOOST_CHECK_EQUAL(cache.Size(), 1000);
+
+    for (int i = 0; i < 1000; i += 99)
+        BOOST_CHECK_EQUAL(cache.Get(i), i * 10);
+
+    streamer.Close();
+}
+
+BOOST_AUTO_TEST_CASE(TestAddMap)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    std::map<int, int> vals;
+
+    for (int i = 0; i < 100; ++i)
+        vals[i] = -i;
+
+    streamer.AddData(vals);
+
+    streamer.Close();
+
+    BOOST_CHECK_EQUAL(cache.Size(), 100);
+    BOOST_CHECK_EQUAL(cache.Get(42), -42);
+}
+
+BOOST_AUTO_TEST_CASE(TestRemove)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    streamer.SetAllowOverwrite(true);
+
+    BOOST_CHECK(streamer.IsAllowOverwrite());
+
+    streamer.RemoveData(1);
+    streamer.AddData(2, 20);
+
+    streamer.Flush();
+
+    BOOST_CHECK(!cache.ContainsKey(1));
+    BOOST_CHECK_EQUAL(cache.Get(2), 20);
+
+    streamer.Close();
+}
+
+BOOST_AUTO_TEST_CASE(TestClose)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    streamer.AddData(1, 1);
+
+    streamer.Close();
+
+    BOOST_CHECK_EQUAL(cache.Get(1), 1);
+
+    // Second close is a no-op.
+    streamer.Close();
+
+    BOOST_CHECK_THROW(streamer.AddData(2, 2), IgniteError);
+    BOOST_CHECK_THROW(streamer.Flush(), IgniteError);
+}
+
+BOOST_AUTO_TEST_CASE(TestCloseCancel)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    streamer.AddData(1, 1);
+
+    streamer.Close(true);
+
+    BOOST_CHECK(!cache.ContainsKey(1));
+}
+
+BOOST_AUTO_TEST_CASE(TestReceiver)
+{
+    Cache<int, int> cache = node.GetCache<int, int>("partitioned");
+
+    cache.Clear();
+
+    DataStreamer<int, int> streamer = node.GetDataStreamer<int, int>("partitioned");
+
+    streamer.SetReceiver(IncrementingReceiver(1000));
+
+    for (int i = 0; i < 100; ++i)
+        streamer.AddData(i, i);
+
+    streamer.Close();
+
+    BOOST_CHECK_EQUAL(cache.Size(), 100);
+
+    for (int i = 0; i < 100; i += 9)
+        BOOST_CHECK_EQUAL(cache.Get(i), i + 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,8 +17,11 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 #include "ignite/ignite.h"
 #include "ignite/ignition.h"
+#include "ignite/impl/interop/interop_memory_pool.h"
 
 using namespace ignite;
 using namespace impl;
@@ -36,7 +39,8 @@ BOOST_AUTO_TEST_CASE(MemoryReallocationTest)
 
     SharedPointer<InteropMemory> mem = env.Get()->AllocateMemory();
 
-    BOOST_CHECK_EQUAL(mem.Get()->Capacity(),
+    // Pooled chunk can be larger if it has been reallocated by previous users.
+    BOOST_CHECK_GE(mem.Get()->Capacity(),
         static_cast<int32_t>(IgniteEnvironment::DEFAULT_ALLOCATION_SIZE));
 
     BOOST_CHECK(mem.Get()->Data() != NULL);
@@ -90,4 +94,57 @@ BOOST_AUTO_TEST_CASE(MemoryReallocationTest)
     memset(mem.Get()->Data(), 0xF0F0F0F0, mem.Get()->Capacity());
 }
 
+BOOST_AUTO_TEST_CASE(MemoryPoolTest)
+{
+    using impl::interop::InteropMemory;
+    using impl::interop::InteropMemoryPool;
+    using common::concurrent::SharedPointer;
+
+    IgniteConfiguration cfg;
+    SP_IgniteEnvironment env = SP_IgniteEnvironment(new IgniteEnvironment(cfg));
+
+    int64_t memPtr = 0;
+
+    {
+        SharedPointer<InteropMemory> mem = env.Get()->AllocateMemory();
+
+        BOOST_CHECK(InteropMemory::IsPooled(mem.Get()->Pointer()));
+        BOOST_CHECK(!InteropMemory::IsExternal(mem.Get()->Pointer()));
+
+        mem.Get()->Length(42);
+
+        memPtr = mem.Get()->PointerLong();
+    }
+
+    // Released chunk is reused and reset.
+    SharedPointer<InteropMemory> mem = env.Get()->AllocateMemory();
+
+    BOOST_CHECK_EQUAL(mem.Get()->PointerLong(), memPtr);
+    BOOST_CHECK_EQUAL(mem.Get()->Length(), 0);
+
+    // Pool falls back to unpooled memory once all the chunks are in use.
+    std::vector< SharedPointer<InteropMemory> > mems;
+
+    for (int32_t i = 0; i < InteropMemoryPool::MAX_CHUNKS; ++i)
+        mems.push_back(env.Get()->AllocateMemory());
+
+    for (size_t i = 0; i < mems.size(); ++i)
+    {
+        BOOST_CHECK_NE(mems[i].Get()->PointerLong(), memPtr);
+        BOOST_CHECK_GE(mems[i].Get()->Capacity(), static_cast<int32_t>(IgniteEnvironment::DEFAULT_ALLOCATION_SIZE));
+    }
+
+    BOOST_CHECK(!InteropMemory::IsPooled(mems.back().Get()->Pointer()));
+
+    // Large chunks are shrunk on release.
+    mem.Get()->Reallocate(InteropMemoryPool::MAX_POOLED_CAPACITY * 2);
+
+    mem = SharedPointer<InteropMemory>();
+    mems.clear();
+
+    mem = env.Get()->AllocateMemory();
+
+    BOOST_CHECK_LE(mem.Get()->Capacity(), static_cast<int32_t>(InteropMemoryPool::MAX_POOLED_CAPACITY));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "ignite/impl/thread_pool.h"
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl;
+
+/**
+ * Task which increments the counter.
+ */
+class CountingTask : public ThreadPoolTask
+{
+public:
+    CountingTask(int32_t* cnt) : cnt(cnt)
+    {
+        // No-op.
+    }
+
+    virtual void Execute()
+    {
+        Atomics::IncrementAndGet32(cnt);
+    }
+
+private:
+    int32_t* cnt;
+};
+
+/**
+ * Task which records its index.
+ */
+class OrderedTask : public ThreadPoolTask
+{
+public:
+    OrderedTask(std::vector<int32_t>* order, int32_t idx) : order(order), idx(idx)
+    {
+        // No-op.
+    }
+
+    virtual void Execute()
+    {
+        order->push_back(idx);
+    }
+
+private:
+    std::vector<int32_t>* order;
+
+    int32_t idx;
+};
+
+/**
+ * Task which waits for the tasks of its own key.
+ */
+class AwaitingTask : public ThreadPoolTask
+{
+public:
+    AwaitingTask(ThreadPool* pool, int64_t key, int32_t* cnt) : pool(pool), key(key), cnt(cnt)
+    {
+        // No-op.
+    }
+
+    virtual void Execute()
+    {
+        pool->Await(key);
+
+        Atomics::IncrementAndGet32(cnt);
+    }
+
+private:
+    ThreadPool* pool;
+
+    int64_t key;
+
+    int32_t* cnt;
+};
+
+/**
+ * Task which throws.
+ */
+class ThrowingTask : public ThreadPoolTask
+{
+public:
+    virtual void Execute()
+    {
+        throw std::exception();
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTestSuite)
+
+BOOST_AUTO_TEST_CASE(TestDispatch)
+{
+    int32_t cnt = 0;
+
+    ThreadPool pool(4);
+
+    BOOST_CHECK_EQUAL(pool.GetSize(), 4);
+
+    for (int32_t i = 0; i < 1000; ++i)
+        pool.Dispatch(i, SP_ThreadPoolTask(new CountingTask(&cnt)));
+
+    pool.Dispatch(0, SP_ThreadPoolTask(new ThrowingTask()));
+
+    pool.Stop();
+
+    BOOST_CHECK_EQUAL(cnt, 1000);
+
+    // Task is executed in place after the stop.
+    pool.Dispatch(0, SP_ThreadPoolTask(new CountingTask(&cnt)));
+
+    BOOST_CHECK_EQUAL(cnt, 1001);
+}
+
+BOOST_AUTO_TEST_CASE(TestDispatchKeyOrder)
+{
+    std::vector<int32_t> order;
+
+    ThreadPool pool(4);
+
+    for (int32_t i = 0; i < 1000; ++i)
+        pool.Dispatch(42, SP_ThreadPoolTask(new OrderedTask(&order, i)));
+
+    pool.Stop();
+
+    BOOST_REQUIRE_EQUAL(order.size(), 1000);
+
+    for (int32_t i = 0; i < 1000; ++i)
+        BOOST_REQUIRE_EQUAL(order[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(TestAwait)
+{
+    int32_t cnt = 0;
+
+    ThreadPool pool(4);
+
+    for (int32_t i = 0; i < 1000; ++i)
+        pool.Dispatch(42, SP_ThreadPoolTask(new CountingTask(&cnt)));
+
+    pool.Await(42);
+
+    BOOST_CHECK_EQUAL(cnt, 1000);
+
+    // Task of the same key does not wait for itself.
+    pool.Dispatch(42, SP_ThreadPoolTask(new AwaitingTask(&pool, 42, &cnt)));
+
+    pool.Await(42);
+
+    BOOST_CHECK_EQUAL(cnt, 1001);
+
+    pool.Stop();
+
+    pool.Await(42);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,9 @@
 #include <ignite/common/concurrent.h>
 #include <ignite/ignite_error.h>
 
+#include <ignite/cache/cache_batch.h>
+#include <ignite/cache/cache_entry_iterator.h>
+#include <ignite/cache/cache_entry_processor_result.h>
 #include <ignite/cache/cache_peek_mode.h>
 #include <ignite/cache/query/query_cursor.h>
 #include <ignite/cache/query/query_fields_cursor.h>
@@ -41,6 +44,9 @@
 #include <ignite/cache/query/continuous/continuous_query.h>
 #include <ignite/impl/cache/cache_impl.h>
 #include <ignite/impl/cache/cache_entry_processor_holder.h>
+#include <ignite/impl/cache/cache_future_holder.h>
+#include <ignite/impl/cache/cache_partition_visitor.h>
+#include <ignite/impl/compute/java_compute_task_holder.h>
 #include <ignite/impl/operations.h>
 #include <ignite/impl/module_manager.h>
 #include <ignite/ignite_error.h>
@@ -487,6 +493,49 @@ namespace ignite
                 IgniteError::ThrowIfNeeded(err);
             }
 
+            /**
+             * Executes operations of the batch in a single call to the Java side,
+             * in the order they were added. Execution stops at the first failed
+             * operation; operations before it keep their results and
+             * CacheBatch::GetExecuted() returns their number.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param batch Batch of operations.
+             * @throw IgniteError with the error of the failed operation.
+             */
+            void ExecuteBatch(CacheBatch<K, V>& batch)
+            {
+                IgniteError err;
+
+                ExecuteBatch(batch, err);
+
+                IgniteError::ThrowIfNeeded(err);
+            }
+
+            /**
+             * Executes operations of the batch in a single call to the Java side,
+             * in the order they were added. Execution stops at the first failed
+             * operation; operations before it keep their results and
+             * CacheBatch::GetExecuted() returns their number.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param batch Batch of operations.
+             * @param err Error of the failed operation.
+             */
+            void ExecuteBatch(CacheBatch<K, V>& batch, IgniteError& err)
+            {
+                impl::InOutCacheBatchOperation<K, V> op(batch);
+
+                impl.Get()->ExecuteBatch(op, op, err);
+
+                if (err.GetCode() == IgniteError::IGNITE_SUCCESS)
+                    err = op.GetError();
+                else
+                    op.SetNull();
+            }
+
             /**
              * Associates the specified value with the specified key in this cache,
              * returning an existing value if one existed.
@@ -1324,6 +1373,127 @@ namespace ignite
                 return impl.Get()->Size(peekModes, true, err);
             }
 
+            /**
+             * Get iterator over the entries cached on this node.
+             *
+             * Entries are fetched in batches, so the iteration is
+             * considerably cheaper than the per-entry peek or local scan query.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param peekModes Peek modes.
+             * @return Iterator.
+             */
+            CacheEntryIterator<K, V> LocalEntries(int32_t peekModes)
+            {
+                IgniteError err;
+
+                CacheEntryIterator<K, V> res = LocalEntries(peekModes, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return res;
+            }
+
+            /**
+             * Get iterator over the entries cached on this node.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param peekModes Peek modes.
+             * @param err Error.
+             * @return Iterator.
+             */
+            CacheEntryIterator<K, V> LocalEntries(int32_t peekModes, IgniteError& err)
+            {
+                return CacheEntryIterator<K, V>(impl.Get()->LocalEntries(peekModes,
+                    impl::cache::CacheEntryIteratorImpl::DEFAULT_BATCH_SIZE, err));
+            }
+
+            /**
+             * Get iterator over the entries of the partition which are stored
+             * on this node. Partitions owned by the local node can be obtained
+             * with CacheAffinity::GetPrimaryPartitions().
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param part Partition.
+             * @return Iterator.
+             */
+            CacheEntryIterator<K, V> LocalPartitionEntries(int32_t part)
+            {
+                IgniteError err;
+
+                CacheEntryIterator<K, V> res = LocalPartitionEntries(part, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return res;
+            }
+
+            /**
+             * Get iterator over the entries of the partition which are stored
+             * on this node.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param part Partition.
+             * @param err Error.
+             * @return Iterator.
+             */
+            CacheEntryIterator<K, V> LocalPartitionEntries(int32_t part, IgniteError& err)
+            {
+                return CacheEntryIterator<K, V>(impl.Get()->LocalPartitionEntries(part,
+                    impl::cache::CacheEntryIteratorImpl::DEFAULT_BATCH_SIZE, err));
+            }
+
+            /**
+             * Visit local entries of the partitions using several threads.
+             * Every partition is visited by a single thread. Visiting stops
+             * on the first error.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param parts Partitions to visit.
+             * @param visitor Visitor. Should implement
+             *  void operator()(const CacheEntry<K, V>&) and be safe to call
+             *  from several threads concurrently.
+             * @param threadNum Number of threads including the current one.
+             */
+            template<typename F>
+            void LocalPartitionsForEach(const std::vector<int32_t>& parts, F& visitor, int32_t threadNum)
+            {
+                IgniteError err;
+
+                LocalPartitionsForEach(parts, visitor, threadNum, err);
+
+                IgniteError::ThrowIfNeeded(err);
+            }
+
+            /**
+             * Visit local entries of the partitions using several threads.
+             * Every partition is visited by a single thread. Visiting stops
+             * on the first error.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param parts Partitions to visit.
+             * @param visitor Visitor. Should implement
+             *  void operator()(const CacheEntry<K, V>&) and be safe to call
+             *  from several threads concurrently.
+             * @param threadNum Number of threads including the current one.
+             * @param err Error.
+             */
+            template<typename F>
+            void LocalPartitionsForEach(const std::vector<int32_t>& parts, F& visitor, int32_t threadNum,
+                IgniteError& err)
+            {
+                impl::cache::CachePartitionVisitor<K, V, F> partVisitor(*impl.Get(), parts, visitor,
+                    impl::cache::CacheEntryIteratorImpl::DEFAULT_BATCH_SIZE);
+
+                partVisitor.Visit(threadNum, err);
+            }
+
             /**
              * Gets the number of all entries cached across all nodes.
              * @note this operation is distributed and will query all participating nodes for their cache sizes.
@@ -1639,6 +1809,80 @@ namespace ignite
                 return res;
             }
 
+            /**
+             * Invokes an CacheEntryProcessor against the set of MutableCacheEntry
+             * specified by the provided keys. Keys are sent to every primary
+             * node in a single batch and the processor is applied to all of
+             * them there, so the cost of the operation does not grow with the
+             * number of the round trips.
+             *
+             * Processor requirements are the same as for Invoke().
+             *
+             * Exception thrown by the processor for some key does not affect
+             * other keys and is returned as a part of the result for that key.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @throw IgniteError on fail.
+             *
+             * @param keys The keys.
+             * @param processor The processor.
+             * @param arg The argument.
+             * @return Map of the processing results. Contains only keys for
+             *   which the processor has returned a value or has thrown.
+             */
+            template<typename R, typename P, typename A>
+            std::map<K, CacheEntryProcessorResult<R> > InvokeAll(const std::set<K>& keys, const P& processor,
+                const A& arg)
+            {
+                IgniteError err;
+
+                std::map<K, CacheEntryProcessorResult<R> > res = InvokeAll<R>(keys, processor, arg, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return res;
+            }
+
+            /**
+             * Invokes an CacheEntryProcessor against the set of MutableCacheEntry
+             * specified by the provided keys. Keys are sent to every primary
+             * node in a single batch and the processor is applied to all of
+             * them there, so the cost of the operation does not grow with the
+             * number of the round trips.
+             *
+             * Processor requirements are the same as for Invoke().
+             *
+             * Exception thrown by the processor for some key does not affect
+             * other keys and is returned as a part of the result for that key.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * Sets err param which should be checked for the operation result.
+             *
+             * @param keys The keys.
+             * @param processor The processor.
+             * @param arg The argument.
+             * @param err Error.
+             * @return Map of the processing results. Empty map on error.
+             */
+            template<typename R, typename P, typename A>
+            std::map<K, CacheEntryProcessorResult<R> > InvokeAll(const std::set<K>& keys, const P& processor,
+                const A& arg, IgniteError& err)
+            {
+                typedef impl::cache::CacheEntryProcessorHolder<P, A> ProcessorHolder;
+
+                std::map<K, CacheEntryProcessorResult<R> > res;
+                ProcessorHolder procHolder(processor, arg);
+
+                impl::InCacheInvokeAllOperation<K, ProcessorHolder> inOp(keys, procHolder);
+                impl::OutCacheInvokeAllOperation<K, R> outOp(res);
+
+                impl.Get()->InvokeAll(inOp, outOp, err);
+
+                return res;
+            }
+
             /**
              * Invokes an instance of Java class CacheEntryProcessor against the
              * entry specified by the provided key. If an entry does not exist
@@ -1814,6 +2058,379 @@ namespace ignite
                 return query::continuous::ContinuousQueryHandle<K, V>(cqImpl);
             }
 
+            /**
+             * Asynchronously retrieves value mapped to the specified key from cache.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @return Future for the value. Default-constructed value is set if
+             *   there is no mapping for the key.
+             */
+            Future<V> GetAsync(const K& key)
+            {
+                impl::In1Operation<K> inOp(key);
+
+                return PerformAsync< V, impl::cache::CacheFutureHolder<V> >(AsyncOperation::GET, inOp);
+            }
+
+            /**
+             * Asynchronously retrieves values mapped to the specified keys from cache.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param keys Keys.
+             * @return Future for the map of key-value pairs.
+             */
+            Future< std::map<K, V> > GetAllAsync(const std::set<K>& keys)
+            {
+                typedef std::map<K, V> ResultType;
+                typedef impl::cache::CacheFutureHolder<ResultType, impl::OutMapOperation<K, V> > FutureHolder;
+
+                impl::InSetOperation<K> inOp(keys);
+
+                return PerformAsync<ResultType, FutureHolder>(AsyncOperation::GET_ALL, inOp);
+            }
+
+            /**
+             * Asynchronously checks if cache contains mapping for the key.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @return Future for the check result.
+             */
+            Future<bool> ContainsKeyAsync(const K& key)
+            {
+                impl::In1Operation<K> inOp(key);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::CONTAINS_KEY, inOp);
+            }
+
+            /**
+             * Asynchronously checks if cache contains mapping for all the keys.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param keys Keys.
+             * @return Future for the check result.
+             */
+            Future<bool> ContainsKeysAsync(const std::set<K>& keys)
+            {
+                impl::InSetOperation<K> inOp(keys);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::CONTAINS_KEYS, inOp);
+            }
+
+            /**
+             * Asynchronously associates the specified value with the specified key in the cache.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key with which the specified value is to be associated.
+             * @param val Value to be associated with the specified key.
+             * @return Future which is completed once the value is stored.
+             */
+            Future<void> PutAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::PUT, inOp);
+            }
+
+            /**
+             * Asynchronously stores given key-value pairs in cache.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param vals Key-value pairs to store in cache.
+             * @return Future which is completed once the values are stored.
+             */
+            Future<void> PutAllAsync(const std::map<K, V>& vals)
+            {
+                impl::InMapOperation<K, V> inOp(vals);
+
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::PUT_ALL, inOp);
+            }
+
+            /**
+             * Asynchronously associates the specified value with the specified key
+             * and returns the previous value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key with which the specified value is to be associated.
+             * @param val Value to be associated with the specified key.
+             * @return Future for the value previously associated with the key.
+             */
+            Future<V> GetAndPutAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< V, impl::cache::CacheFutureHolder<V> >(AsyncOperation::GET_AND_PUT, inOp);
+            }
+
+            /**
+             * Asynchronously replaces the value for the key if it is mapped to
+             * some value and returns the previous value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key with which the specified value is to be associated.
+             * @param val Value to be associated with the specified key.
+             * @return Future for the value previously associated with the key.
+             */
+            Future<V> GetAndReplaceAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< V, impl::cache::CacheFutureHolder<V> >(AsyncOperation::GET_AND_REPLACE, inOp);
+            }
+
+            /**
+             * Asynchronously removes the mapping for the key and returns the
+             * previous value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @return Future for the value previously associated with the key.
+             */
+            Future<V> GetAndRemoveAsync(const K& key)
+            {
+                impl::In1Operation<K> inOp(key);
+
+                return PerformAsync< V, impl::cache::CacheFutureHolder<V> >(AsyncOperation::GET_AND_REMOVE, inOp);
+            }
+
+            /**
+             * Asynchronously associates the specified value with the key only if
+             * there is no mapping for the key yet.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param val Value.
+             * @return Future for the result. @c true if the value was set.
+             */
+            Future<bool> PutIfAbsentAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::PUT_IF_ABSENT, inOp);
+            }
+
+            /**
+             * Asynchronously associates the specified value with the key only if
+             * there is no mapping for the key yet and returns the previous value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param val Value.
+             * @return Future for the value previously associated with the key.
+             */
+            Future<V> GetAndPutIfAbsentAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< V, impl::cache::CacheFutureHolder<V> >(AsyncOperation::GET_AND_PUT_IF_ABSENT, inOp);
+            }
+
+            /**
+             * Asynchronously replaces the value for the key only if the key is
+             * mapped to some value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param val Value.
+             * @return Future for the result. @c true if the value was replaced.
+             */
+            Future<bool> ReplaceAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::REPLACE_2, inOp);
+            }
+
+            /**
+             * Asynchronously replaces the value for the key only if the key is
+             * mapped to the given value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param oldVal Value expected to be associated with the key.
+             * @param newVal Value to be associated with the key.
+             * @return Future for the result. @c true if the value was replaced.
+             */
+            Future<bool> ReplaceAsync(const K& key, const V& oldVal, const V& newVal)
+            {
+                impl::In3Operation<K, V, V> inOp(key, oldVal, newVal);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::REPLACE_3, inOp);
+            }
+
+            /**
+             * Asynchronously removes the mapping for the key.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @return Future for the result. @c true if the mapping was removed.
+             */
+            Future<bool> RemoveAsync(const K& key)
+            {
+                impl::In1Operation<K> inOp(key);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::REMOVE_1, inOp);
+            }
+
+            /**
+             * Asynchronously removes the mapping for the key only if the key is
+             * mapped to the given value.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param val Value expected to be associated with the key.
+             * @return Future for the result. @c true if the mapping was removed.
+             */
+            Future<bool> RemoveAsync(const K& key, const V& val)
+            {
+                impl::In2Operation<K, V> inOp(key, val);
+
+                return PerformAsync< bool, impl::cache::CacheFutureHolder<bool> >(AsyncOperation::REMOVE_2, inOp);
+            }
+
+            /**
+             * Asynchronously removes the mappings for the keys.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param keys Keys.
+             * @return Future which is completed once the mappings are removed.
+             */
+            Future<void> RemoveAllAsync(const std::set<K>& keys)
+            {
+                impl::InSetOperation<K> inOp(keys);
+
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::REMOVE_ALL, inOp);
+            }
+
+            /**
+             * Asynchronously removes all mappings from cache.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Future which is completed once the mappings are removed.
+             */
+            Future<void> RemoveAllAsync()
+            {
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::REMOVE_ALL2);
+            }
+
+            /**
+             * Asynchronously clears the key without notifying listeners or
+             * cache writers.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key to clear.
+             * @return Future which is completed once the key is cleared.
+             */
+            Future<void> ClearAsync(const K& key)
+            {
+                impl::In1Operation<K> inOp(key);
+
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::CLEAR, inOp);
+            }
+
+            /**
+             * Asynchronously clears the keys without notifying listeners or
+             * cache writers.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param keys Keys to clear.
+             * @return Future which is completed once the keys are cleared.
+             */
+            Future<void> ClearAllAsync(const std::set<K>& keys)
+            {
+                impl::InSetOperation<K> inOp(keys);
+
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::CLEAR_ALL, inOp);
+            }
+
+            /**
+             * Asynchronously clears the contents of the cache without notifying
+             * listeners or cache writers.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Future which is completed once the cache is cleared.
+             */
+            Future<void> ClearAsync()
+            {
+                return PerformAsync< void, impl::compute::JavaComputeTaskHolder<void> >(AsyncOperation::CLEAR_CACHE);
+            }
+
+            /**
+             * Asynchronously invokes an CacheEntryProcessor against the
+             * MutableCacheEntry specified by the provided key.
+             *
+             * Processor class should be registered as a cache entry processor
+             * using IgniteBinding::RegisterCacheEntryProcessor() method. See
+             * Invoke() for details.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key The key.
+             * @param processor The processor.
+             * @param arg The argument.
+             * @return Future for the result of the processing. Exception thrown
+             *   by the processor is set as the future error.
+             */
+            template<typename R, typename P, typename A>
+            Future<R> InvokeAsync(const K& key, const P& processor, const A& arg)
+            {
+                typedef impl::cache::CacheEntryProcessorHolder<P, A> ProcessorHolder;
+
+                ProcessorHolder procHolder(processor, arg);
+
+                impl::InCacheInvokeOperation<K, ProcessorHolder> inOp(key, procHolder);
+
+                return PerformAsync< R, impl::cache::CacheInvokeFutureHolder<R> >(AsyncOperation::INVOKE, inOp);
+            }
+
+            /**
+             * Asynchronously invokes an CacheEntryProcessor against the set of
+             * MutableCacheEntry specified by the provided keys. See InvokeAll()
+             * for details.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param keys The keys.
+             * @param processor The processor.
+             * @param arg The argument.
+             * @return Future for the map of the processing results.
+             */
+            template<typename R, typename P, typename A>
+            Future< std::map<K, CacheEntryProcessorResult<R> > > InvokeAllAsync(const std::set<K>& keys,
+                const P& processor, const A& arg)
+            {
+                typedef impl::cache::CacheEntryProcessorHolder<P, A> ProcessorHolder;
+                typedef std::map<K, CacheEntryProcessorResult<R> > ResultMap;
+                typedef impl::cache::CacheFutureHolder< ResultMap, impl::OutCacheInvokeAllOperation<K, R> > Holder;
+
+                ProcessorHolder procHolder(processor, arg);
+
+                impl::InCacheInvokeAllOperation<K, ProcessorHolder> inOp(keys, procHolder);
+
+                return PerformAsync<ResultMap, Holder>(AsyncOperation::INVOKE_ALL, inOp);
+            }
+
             /**
              * Check if the instance is valid.
              *
@@ -1860,6 +2477,55 @@ namespace ignite
             }
 
         private:
+            typedef impl::cache::CacheImpl::AsyncOperation AsyncOperation;
+
+            /**
+             * Start asynchronous operation.
+             *
+             * @tparam R Result type.
+             * @tparam H Future holder type.
+             *
+             * @param op Operation type.
+             * @param inOp Input.
+             * @return Future for the result.
+             */
+            template<typename R, typename H>
+            Future<R> PerformAsync(AsyncOperation::Type op, impl::InputOperation& inOp)
+            {
+                common::concurrent::SharedPointer<H> fut(new H());
+
+                IgniteError err;
+
+                impl.Get()->OutOpAsync(op, inOp, fut, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return fut.Get()->GetPromise().GetFuture();
+            }
+
+            /**
+             * Start asynchronous operation without arguments.
+             *
+             * @tparam R Result type.
+             * @tparam H Future holder type.
+             *
+             * @param op Operation type.
+             * @return Future for the result.
+             */
+            template<typename R, typename H>
+            Future<R> PerformAsync(AsyncOperation::Type op)
+            {
+                common::concurrent::SharedPointer<H> fut(new H());
+
+                IgniteError err;
+
+                impl.Get()->OutOpAsync(op, fut, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return fut.Get()->GetPromise().GetFuture();
+            }
+
             /** Implementation delegate. */
             common::concurrent::SharedPointer<impl::cache::CacheImpl> impl;
         };
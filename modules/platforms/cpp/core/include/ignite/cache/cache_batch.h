@@ -0,0 +1,238 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::cache::CacheBatch class template.
+ */
+
+#ifndef _IGNITE_CACHE_CACHE_BATCH
+#define _IGNITE_CACHE_CACHE_BATCH
+
+#include <vector>
+
+#include <ignite/common/common.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        /* Forward declaration. */
+        template<typename K, typename V>
+        class InOutCacheBatchOperation;
+    }
+
+    namespace cache
+    {
+        /**
+         * Batch of independent single-key cache operations. All operations of
+         * the batch are executed by Cache::ExecuteBatch() in a single call to
+         * the Java side, in the order they were added.
+         *
+         * @tparam K Cache key type.
+         * @tparam V Cache value type.
+         */
+        template<typename K, typename V>
+        class CacheBatch
+        {
+            friend class impl::InOutCacheBatchOperation<K, V>;
+        public:
+            /**
+             * Default constructor.
+             */
+            CacheBatch() :
+                entries(),
+                executed(0)
+            {
+                // No-op.
+            }
+
+            /**
+             * Add Put operation.
+             *
+             * @param key Key.
+             * @param val Value.
+             */
+            void Put(const K& key, const V& val)
+            {
+                entries.push_back(Entry(Operation::PUT, key, val));
+            }
+
+            /**
+             * Add PutIfAbsent operation. Its result is available through GetFlag().
+             *
+             * @param key Key.
+             * @param val Value.
+             */
+            void PutIfAbsent(const K& key, const V& val)
+            {
+                entries.push_back(Entry(Operation::PUT_IF_ABSENT, key, val));
+            }
+
+            /**
+             * Add Get operation. Its result is available through GetValue().
+             *
+             * @param key Key.
+             */
+            void Get(const K& key)
+            {
+                entries.push_back(Entry(Operation::GET, key, V()));
+            }
+
+            /**
+             * Add ContainsKey operation. Its result is available through GetFlag().
+             *
+             * @param key Key.
+             */
+            void ContainsKey(const K& key)
+            {
+                entries.push_back(Entry(Operation::CONTAINS_KEY, key, V()));
+            }
+
+            /**
+             * Add Remove operation. Its result is available through GetFlag().
+             *
+             * @param key Key.
+             */
+            void Remove(const K& key)
+            {
+                entries.push_back(Entry(Operation::REMOVE, key, V()));
+            }
+
+            /**
+             * Get number of operations in the batch.
+             *
+             * @return Number of operations.
+             */
+            int32_t GetSize() const
+            {
+                return static_cast<int32_t>(entries.size());
+            }
+
+            /**
+             * Get number of operations executed by the last execution of the
+             * batch. Less than GetSize() if an operation has failed: operations
+             * after the failed one are not executed.
+             *
+             * @return Number of executed operations.
+             */
+            int32_t GetExecuted() const
+            {
+                return executed;
+            }
+
+            /**
+             * Get result of the executed PutIfAbsent, ContainsKey or Remove operation.
+             *
+             * @param idx Operation index.
+             * @return Operation result.
+             */
+            bool GetFlag(int32_t idx) const
+            {
+                return entries[idx].flag;
+            }
+
+            /**
+             * Get result of the executed Get operation.
+             *
+             * @param idx Operation index.
+             * @return Value or default value if the key is absent.
+             */
+            const V& GetValue(int32_t idx) const
+            {
+                return entries[idx].val;
+            }
+
+            /**
+             * Remove all operations from the batch.
+             */
+            void Clear()
+            {
+                entries.clear();
+
+                executed = 0;
+            }
+
+        private:
+            /**
+             * Operation type. Matches operation codes of the Java cache target.
+             */
+            struct Operation
+            {
+                enum Type
+                {
+                    /** ContainsKey. */
+                    CONTAINS_KEY = 3,
+
+                    /** Get. */
+                    GET = 5,
+
+                    /** Put. */
+                    PUT = 26,
+
+                    /** PutIfAbsent. */
+                    PUT_IF_ABSENT = 28,
+
+                    /** Remove. */
+                    REMOVE = 36
+                };
+            };
+
+            /**
+             * Batch entry.
+             */
+            struct Entry
+            {
+                /**
+                 * Constructor.
+                 *
+                 * @param op Operation type.
+                 * @param key Key.
+                 * @param val Value.
+                 */
+                Entry(int32_t op, const K& key, const V& val) :
+                    op(op),
+                    key(key),
+                    val(val),
+                    flag(false)
+                {
+                    // No-op.
+                }
+
+                /** Operation type. */
+                int32_t op;
+
+                /** Key. */
+                K key;
+
+                /** Argument value or result of Get. */
+                V val;
+
+                /** Boolean result. */
+                bool flag;
+            };
+
+            /** Entries. */
+            std::vector<Entry> entries;
+
+            /** Number of executed operations. */
+            int32_t executed;
+        };
+    }
+}
+
+#endif //_IGNITE_CACHE_CACHE_BATCH
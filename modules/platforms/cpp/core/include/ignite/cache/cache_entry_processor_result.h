@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::cache::CacheEntryProcessorResult class template.
+ */
+
+#ifndef _IGNITE_CACHE_CACHE_ENTRY_PROCESSOR_RESULT
+#define _IGNITE_CACHE_CACHE_ENTRY_PROCESSOR_RESULT
+
+#include <ignite/ignite_error.h>
+
+namespace ignite
+{
+    namespace cache
+    {
+        /**
+         * Result of the cache entry processor invocation on a single key.
+         * Holds either the value returned by the processor or the error
+         * thrown by it.
+         *
+         * @tparam R Processor result type.
+         */
+        template<typename R>
+        class CacheEntryProcessorResult
+        {
+        public:
+            /**
+             * Default constructor.
+             */
+            CacheEntryProcessorResult() :
+                res(),
+                err()
+            {
+                // No-op.
+            }
+
+            /**
+             * Constructor for the successful result.
+             *
+             * @param res Processor result.
+             */
+            CacheEntryProcessorResult(const R& res) :
+                res(res),
+                err()
+            {
+                // No-op.
+            }
+
+            /**
+             * Constructor for the failed result.
+             *
+             * @param err Processor error.
+             */
+            CacheEntryProcessorResult(const IgniteError& err) :
+                res(),
+                err(err)
+            {
+                // No-op.
+            }
+
+            /**
+             * Check if the processor completed successfully.
+             *
+             * @return True if the processor has not thrown.
+             */
+            bool IsSuccess() const
+            {
+                return err.GetCode() == IgniteError::IGNITE_SUCCESS;
+            }
+
+            /**
+             * Get processor result.
+             *
+             * @return Processor result.
+             * @throw IgniteError if the processor has thrown.
+             */
+            const R& GetResult() const
+            {
+                IgniteError::ThrowIfNeeded(err);
+
+                return res;
+            }
+
+            /**
+             * Get processor error.
+             *
+             * @return Processor error. Has IGNITE_SUCCESS code if the
+             *   processor completed successfully.
+             */
+            const IgniteError& GetError() const
+            {
+                return err;
+            }
+
+        private:
+            /** Result. */
+            R res;
+
+            /** Error. */
+            IgniteError err;
+        };
+    }
+}
+
+#endif //_IGNITE_CACHE_CACHE_ENTRY_PROCESSOR_RESULT
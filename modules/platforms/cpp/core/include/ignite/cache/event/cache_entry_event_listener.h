@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 
+#include <ignite/ignite_error.h>
 #include <ignite/cache/event/cache_entry_event.h>
 
 namespace ignite
@@ -63,6 +64,18 @@ namespace ignite
                  * @param num Events number.
                  */
                 virtual void OnEvent(const CacheEntryEvent<K, V>* evts, uint32_t num) = 0;
+
+                /**
+                 * Error callback. Called when events can not be delivered
+                 * anymore, e.g. when the native event queue of the continuous
+                 * query overflows with the FAIL policy.
+                 *
+                 * Default implementation does nothing.
+                 */
+                virtual void OnError(const IgniteError&)
+                {
+                    // No-op.
+                }
             };
         }
     }
@@ -27,6 +27,7 @@
 
 #include <ignite/cache/event/cache_entry_event_listener.h>
 #include <ignite/cache/event/cache_entry_event_filter.h>
+#include <ignite/cache/query/continuous/continuous_query_overflow_policy.h>
 
 namespace ignite
 {
@@ -70,6 +71,22 @@ namespace ignite
                      */
                     enum { DEFAULT_TIME_INTERVAL = 0 };
 
+                    /**
+                     * Default value for the native event queue size. Zero
+                     * means that the queue is disabled.
+                     */
+                    enum { DEFAULT_EVENT_QUEUE_SIZE = 0 };
+
+                    /**
+                     * Default value for the event batch size.
+                     */
+                    enum { DEFAULT_EVENT_BATCH_SIZE = 256 };
+
+                    /**
+                     * Default value for the event batch delay.
+                     */
+                    enum { DEFAULT_EVENT_BATCH_DELAY = 0 };
+
                     /**
                      * Destructor.
                      */
@@ -228,6 +245,110 @@ namespace ignite
                         return impl.Get()->GetTimeInterval();
                     }
 
+                    /**
+                     * Set native event queue size.
+                     *
+                     * By default events are delivered to the listener in the
+                     * thread which has received them, so a slow listener blocks
+                     * Ignite notification threads. When the queue size is
+                     * positive, events are put into a bounded queue instead and
+                     * delivered to the listener in batches by the dedicated
+                     * thread. When the queue is full, the overflow policy set
+                     * with SetOverflowPolicy() is applied.
+                     *
+                     * Default value is DEFAULT_EVENT_QUEUE_SIZE, i.e. 0, which
+                     * means that the queue is disabled.
+                     *
+                     * @param val Maximum number of queued events.
+                     */
+                    void SetEventQueueSize(int32_t val)
+                    {
+                        impl.Get()->SetEventQueueSize(val);
+                    }
+
+                    /**
+                     * Get native event queue size.
+                     *
+                     * @return Maximum number of queued events.
+                     */
+                    int32_t GetEventQueueSize() const
+                    {
+                        return impl.Get()->GetEventQueueSize();
+                    }
+
+                    /**
+                     * Set maximum number of events passed to the listener at
+                     * once. Only used when the native event queue is enabled.
+                     *
+                     * Default value is DEFAULT_EVENT_BATCH_SIZE.
+                     *
+                     * @param val Event batch size.
+                     */
+                    void SetEventBatchSize(int32_t val)
+                    {
+                        impl.Get()->SetEventBatchSize(val);
+                    }
+
+                    /**
+                     * Get maximum number of events passed to the listener at
+                     * once.
+                     *
+                     * @return Event batch size.
+                     */
+                    int32_t GetEventBatchSize() const
+                    {
+                        return impl.Get()->GetEventBatchSize();
+                    }
+
+                    /**
+                     * Set maximum time the events wait in the native queue for
+                     * the batch to fill up. Only used when the native event
+                     * queue is enabled.
+                     *
+                     * Default value is DEFAULT_EVENT_BATCH_DELAY, i.e. 0, which
+                     * means that queued events are delivered as soon as the
+                     * listener is free.
+                     *
+                     * @param val Event batch delay in milliseconds.
+                     */
+                    void SetEventBatchDelay(int64_t val)
+                    {
+                        impl.Get()->SetEventBatchDelay(val);
+                    }
+
+                    /**
+                     * Get maximum time the events wait in the native queue for
+                     * the batch to fill up.
+                     *
+                     * @return Event batch delay in milliseconds.
+                     */
+                    int64_t GetEventBatchDelay() const
+                    {
+                        return impl.Get()->GetEventBatchDelay();
+                    }
+
+                    /**
+                     * Set policy applied when the native event queue is full.
+                     *
+                     * Default value is ContinuousQueryOverflowPolicy::BLOCK.
+                     *
+                     * @param val Overflow policy.
+                     */
+                    void SetOverflowPolicy(ContinuousQueryOverflowPolicy::Type val)
+                    {
+                        impl.Get()->SetOverflowPolicy(val);
+                    }
+
+                    /**
+                     * Get policy applied when the native event queue is full.
+                     *
+                     * @return Overflow policy.
+                     */
+                    ContinuousQueryOverflowPolicy::Type GetOverflowPolicy() const
+                    {
+                        return impl.Get()->GetOverflowPolicy();
+                    }
+
                     /**
                      * Set cache entry event listener.
                      *
@@ -0,0 +1,69 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::cache::query::continuous::ContinuousQueryOverflowPolicy enum.
+ */
+
+#ifndef _IGNITE_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_OVERFLOW_POLICY
+#define _IGNITE_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_OVERFLOW_POLICY
+
+namespace ignite
+{
+    namespace cache
+    {
+        namespace query
+        {
+            namespace continuous
+            {
+                /**
+                 * Policy applied when the native event queue of the
+                 * continuous query is full.
+                 */
+                struct ContinuousQueryOverflowPolicy
+                {
+                    enum Type
+                    {
+                        /**
+                         * Block the notifying thread until there is space in
+                         * the queue. If the native thread pool is enabled, the
+                         * notifying thread is the pool worker, which is then
+                         * not available for the listeners of other queries.
+                         */
+                        BLOCK = 0,
+
+                        /**
+                         * Discard the oldest queued events to make space for
+                         * the new ones.
+                         */
+                        DROP_OLDEST = 1,
+
+                        /**
+                         * Stop delivering events. Queued and further events are
+                         * discarded and the listener is notified with
+                         * CacheEntryEventListener::OnError().
+                         */
+                        FAIL = 2
+                    };
+                };
+            }
+        }
+    }
+}
+
+#endif //_IGNITE_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_OVERFLOW_POLICY
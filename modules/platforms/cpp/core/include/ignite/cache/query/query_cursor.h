@@ -241,6 +241,26 @@ namespace ignite
                     }
                 }
 
+                /**
+                 * Set number of batches fetched in the background while the
+                 * current batch is processed. Zero, which is the default,
+                 * means that the batches are fetched on demand.
+                 *
+                 * Prefetching hides the round trip latency when the batches
+                 * are large. Should be called before the iteration is started.
+                 *
+                 * This method should only be used on the valid instance.
+                 *
+                 * @param depth Number of prefetched batches.
+                 */
+                void SetPrefetchDepth(int32_t depth)
+                {
+                    impl::cache::query::QueryCursorImpl* impl0 = impl.Get();
+
+                    if (impl0)
+                        impl0->SetPrefetchDepth(depth);
+                }
+
                 /**
                  * Check if the instance is valid.
                  *
@@ -163,6 +163,76 @@ namespace ignite
                     }
                 }
 
+                /**
+                 * Get next entry reusing the row instance.
+                 *
+                 * Row previously returned by this method is overwritten, so
+                 * there are no allocations per row while the rows of the same
+                 * batch are read. All columns of the previous row should be
+                 * read before the call.
+                 *
+                 * This method should only be used on the valid instance.
+                 *
+                 * @param row Row to store the next entry in.
+                 *
+                 * @throw IgniteError class instance in case of failure.
+                 */
+                void GetNext(QueryFieldsRow& row)
+                {
+                    IgniteError err;
+
+                    GetNext(row, err);
+
+                    IgniteError::ThrowIfNeeded(err);
+                }
+
+                /**
+                 * Get next entry reusing the row instance.
+                 * Properly sets error param in case of failure.
+                 *
+                 * Row previously returned by this method is overwritten, so
+                 * there are no allocations per row while the rows of the same
+                 * batch are read. All columns of the previous row should be
+                 * read before the call.
+                 *
+                 * This method should only be used on the valid instance.
+                 *
+                 * @param row Row to store the next entry in.
+                 * @param err Used to set operation result.
+                 */
+                void GetNext(QueryFieldsRow& row, IgniteError& err)
+                {
+                    impl::cache::query::QueryCursorImpl* impl0 = impl.Get();
+
+                    if (impl0)
+                        impl0->GetNextRow(row.impl, err);
+                    else
+                    {
+                        err = IgniteError(IgniteError::IGNITE_ERR_GENERIC,
+                            "Instance is not usable (did you check for error?).");
+                    }
+                }
+
+                /**
+                 * Set number of batches fetched in the background while the
+                 * current batch is processed. Zero, which is the default,
+                 * means that the batches are fetched on demand.
+                 *
+                 * Prefetching hides the round trip latency when the batches
+                 * are large. Should be called before the iteration is started.
+                 *
+                 * This method should only be used on the valid instance.
+                 *
+                 * @param depth Number of prefetched batches.
+                 */
+                void SetPrefetchDepth(int32_t depth)
+                {
+                    impl::cache::query::QueryCursorImpl* impl0 = impl.Get();
+
+                    if (impl0)
+                        impl0->SetPrefetchDepth(depth);
+                }
+
                 /**
                  * Check if the instance is valid.
                  *
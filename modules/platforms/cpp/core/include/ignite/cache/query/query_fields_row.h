@@ -216,6 +216,8 @@ namespace ignite
                 }
 
             private:
+                friend class QueryFieldsCursor;
+
                 /** Implementation delegate. */
                 ignite::common::concurrent::SharedPointer<impl::cache::query::QueryFieldsRowImpl> impl;
             };
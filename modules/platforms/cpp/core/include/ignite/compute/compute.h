@@ -28,6 +28,7 @@
 #include <ignite/ignite_error.h>
 #include <ignite/future.h>
 #include <ignite/compute/compute_func.h>
+#include <ignite/compute/compute_task.h>
 
 #include <ignite/impl/compute/compute_impl.h>
 
@@ -306,6 +307,91 @@ namespace ignite
                 return impl.Get()->BroadcastAsync<F, false>(func);
             }
 
+            /**
+             * Executes given compute task within the cluster group. Task
+             * splits the execution into jobs, which are mapped to the nodes,
+             * and reduces the job results into the task result.
+             *
+             * @tparam T Task type. Should implement ComputeTask class.
+             * @param task Task to execute.
+             * @return Task result.
+             * @throw IgniteError in case of error.
+             */
+            template<typename T>
+            typename T::ResultType Execute(const T& task)
+            {
+                return impl.Get()->ExecuteAsync<T>(task).GetValue();
+            }
+
+            /**
+             * Asyncronuously executes given compute task within the cluster
+             * group.
+             *
+             * @tparam T Task type. Should implement ComputeTask class.
+             * @param task Task to execute.
+             * @return Future that can be used to access task result once
+             *  it's ready.
+             * @throw IgniteError in case of error.
+             */
+            template<typename T>
+            Future<typename T::ResultType> ExecuteAsync(const T& task)
+            {
+                return impl.Get()->ExecuteAsync<T>(task);
+            }
+
+            /**
+             * Applies provided function to every argument. Arguments are
+             * split into contiguous parts, one per node of the cluster group,
+             * so every node receives a single job.
+             *
+             * Function type should be registered on all nodes with
+             * IgniteBinding::RegisterComputeApplyFunc().
+             *
+             * @tparam R Function result type. BinaryType should be
+             *  specialized for the type if it is not primitive.
+             * @tparam F Function type. Should implement
+             *  <tt>R Apply(const A&)</tt> method. BinaryType should be
+             *  specialized for the type.
+             * @tparam A Function argument type. BinaryType should be
+             *  specialized for the type if it is not primitive.
+             * @param func Function to apply.
+             * @param args Arguments.
+             * @return Results in the order of the arguments.
+             * @throw IgniteError in case of error.
+             */
+            template<typename R, typename F, typename A>
+            std::vector<R> Apply(const F& func, const std::vector<A>& args)
+            {
+                return impl.Get()->ApplyAsync<R, F, A>(func, args).GetValue();
+            }
+
+            /**
+             * Asyncronuously applies provided function to every argument.
+             * Arguments are split into contiguous parts, one per node of the
+             * cluster group, so every node receives a single job.
+             *
+             * Function type should be registered on all nodes with
+             * IgniteBinding::RegisterComputeApplyFunc().
+             *
+             * @tparam R Function result type. BinaryType should be
+             *  specialized for the type if it is not primitive.
+             * @tparam F Function type. Should implement
+             *  <tt>R Apply(const A&)</tt> method. BinaryType should be
+             *  specialized for the type.
+             * @tparam A Function argument type. BinaryType should be
+             *  specialized for the type if it is not primitive.
+             * @param func Function to apply.
+             * @param args Arguments.
+             * @return Future that can be used to access results once they
+             *  are ready.
+             * @throw IgniteError in case of error.
+             */
+            template<typename R, typename F, typename A>
+            Future< std::vector<R> > ApplyAsync(const F& func, const std::vector<A>& args)
+            {
+                return impl.Get()->ApplyAsync<R, F, A>(func, args);
+            }
+
             /**
              * Executes given Java task on the grid projection. If task for given name has not been deployed yet,
              * then 'taskName' will be used as task class name to auto-deploy the task.
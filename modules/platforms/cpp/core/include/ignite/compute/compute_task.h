@@ -0,0 +1,141 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::compute::ComputeTask class template.
+ */
+
+#ifndef _IGNITE_COMPUTE_COMPUTE_TASK
+#define _IGNITE_COMPUTE_COMPUTE_TASK
+
+#include <utility>
+#include <vector>
+
+#include <ignite/ignite_error.h>
+#include <ignite/cluster/cluster_node.h>
+
+namespace ignite
+{
+    namespace compute
+    {
+        /**
+         * Policy returned by the task when the job result is received.
+         */
+        struct ComputeJobResultPolicy
+        {
+            enum Type
+            {
+                /**
+                 * Wait for the rest of the results. Reduce is started once
+                 * all the results are received.
+                 */
+                WAIT = 0,
+
+                /**
+                 * Ignore results which are not received yet and start
+                 * reducing.
+                 */
+                REDUCE = 1,
+
+                /**
+                 * Fail-over the job to execute on another node.
+                 */
+                FAILOVER = 2
+            };
+        };
+
+        /**
+         * Compute task. Splits the execution into a number of jobs, maps
+         * them to the nodes of the cluster group and reduces job results
+         * as they arrive into the task result.
+         *
+         * Task is copied on execution, so every execution works with its own
+         * instance and can keep intermediate state in the instance members.
+         * Task argument, if any, should also be passed in the task members.
+         *
+         * @tparam F Job type. Should implement ComputeFunc<JR> class and be
+         *  registered with IgniteBinding::RegisterComputeFunc() on all the
+         *  nodes the jobs are mapped to.
+         * @tparam JR Job result type. BinaryType should be specialized for
+         *  the type if it is not primitive. Should not be void.
+         * @tparam R Task result type. Should not be void.
+         */
+        template<typename F, typename JR, typename R>
+        class ComputeTask
+        {
+        public:
+            typedef F JobType;
+            typedef JR JobResultType;
+            typedef R ResultType;
+
+            /** Jobs paired with the nodes they should be executed on. */
+            typedef std::vector< std::pair<F, cluster::ClusterNode> > JobMapping;
+
+            /**
+             * Destructor.
+             */
+            virtual ~ComputeTask()
+            {
+                // No-op.
+            }
+
+            /**
+             * Split the task into jobs and map them to the nodes.
+             *
+             * @param subgrid Nodes available for the task execution.
+             * @param jobs Output mapping of the jobs to the nodes.
+             * @throw IgniteError to fail the task.
+             */
+            virtual void Map(const std::vector<cluster::ClusterNode>& subgrid, JobMapping& jobs) = 0;
+
+            /**
+             * Called on every successful job result. Results are delivered
+             * one at a time as soon as they arrive, so the task can reduce
+             * them without keeping all the results in memory.
+             *
+             * @param res Job result.
+             * @return Policy which defines how to proceed with the task.
+             */
+            virtual ComputeJobResultPolicy::Type OnResult(const JR& res) = 0;
+
+            /**
+             * Called on every failed job. Default implementation fails the
+             * task with the job error.
+             *
+             * @param err Job error.
+             * @return Policy which defines how to proceed with the task.
+             * @throw IgniteError to fail the task.
+             */
+            virtual ComputeJobResultPolicy::Type OnError(const IgniteError& err)
+            {
+                throw err;
+            }
+
+            /**
+             * Reduce the results into the task result. Called once all the
+             * results are received or the reduce policy is returned.
+             *
+             * @return Task result.
+             * @throw IgniteError to fail the task.
+             */
+            virtual R Reduce() = 0;
+        };
+    }
+}
+
+#endif //_IGNITE_COMPUTE_COMPUTE_TASK
@@ -0,0 +1,347 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::datastreamer::DataStreamer class.
+ */
+
+#ifndef _IGNITE_DATASTREAMER_DATA_STREAMER
+#define _IGNITE_DATASTREAMER_DATA_STREAMER
+
+#include <map>
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/datastreamer/stream_receiver.h>
+#include <ignite/impl/datastreamer/data_streamer_impl.h>
+
+namespace ignite
+{
+    namespace datastreamer
+    {
+        /**
+         * Data streamer is responsible for streaming external data into cache.
+         *
+         * Entries are buffered on the native side and sent to the cluster in
+         * batches, so adding an entry does not cross JNI boundary unless the
+         * batch is full. Data is not guaranteed to be in cache until Flush() or
+         * Close() is called.
+         *
+         * All templated types should be default-constructable,
+         * copy-constructable and assignable. Also BinaryType class
+         * template should be specialized for both types.
+         *
+         * This class is implemented as a reference to an implementation so copying
+         * of this class instance will only create another reference to the same
+         * underlying object. Underlying object will be released and the streamer
+         * closed automatically once all the instances are destructed.
+         *
+         * @tparam K Cache key type.
+         * @tparam V Cache value type.
+         */
+        template<typename K, typename V>
+        class IGNITE_IMPORT_EXPORT DataStreamer
+        {
+        public:
+            /**
+             * Constructor.
+             *
+             * Internal method. Should not be used by user.
+             *
+             * @param impl Implementation.
+             */
+            DataStreamer(impl::datastreamer::DataStreamerImpl* impl) :
+                impl(impl)
+            {
+                // No-op.
+            }
+
+            /**
+             * Get name of the cache this streamer loads data to.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Cache name.
+             */
+            const std::string& GetCacheName() const
+            {
+                return impl.Get()->GetCacheName();
+            }
+
+            /**
+             * Add entry to the streamer.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             * @param val Value.
+             */
+            void AddData(const K& key, const V& val)
+            {
+                impl.Get()->AddData(key, val);
+            }
+
+            /**
+             * Add entries to the streamer.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param begin Iterator pointing to the beggining of the key-value pair sequence.
+             * @param end Iterator pointing to the end of the key-value pair sequence.
+             */
+            template<typename Iter>
+            void AddData(Iter begin, Iter end)
+            {
+                for (Iter it = begin; it != end; ++it)
+                    impl.Get()->AddData(it->first, it->second);
+            }
+
+            /**
+             * Add entries to the streamer.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param vals Key-value pairs.
+             */
+            void AddData(const std::map<K, V>& vals)
+            {
+                AddData(vals.begin(), vals.end());
+            }
+
+            /**
+             * Add removal of the entry to the streamer. The entry is
+             * removed from cache only if overwriting is allowed.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param key Key.
+             */
+            void RemoveData(const K& key)
+            {
+                impl.Get()->RemoveData(key);
+            }
+
+            /**
+             * Send buffered entries and wait until all the entries added
+             * before this call are loaded into cache.
+             *
+             * This method should only be used on the valid instance.
+             */
+            void Flush()
+            {
+                impl.Get()->Flush();
+            }
+
+            /**
+             * Send buffered entries without waiting for them to be loaded.
+             *
+             * This method should only be used on the valid instance.
+             */
+            void TryFlush()
+            {
+                impl.Get()->TryFlush();
+            }
+
+            /**
+             * Close streamer. Buffered entries are loaded into cache before
+             * the method returns.
+             *
+             * This method should only be used on the valid instance.
+             */
+            void Close()
+            {
+                impl.Get()->Close(false);
+            }
+
+            /**
+             * Close streamer.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param cancel Cancel flag. If @c true, buffered entries are
+             *    discarded, otherwise they are loaded before the method returns.
+             */
+            void Close(bool cancel)
+            {
+                impl.Get()->Close(cancel);
+            }
+
+            /**
+             * Set stream receiver. Receiver is invoked on the data nodes
+             * instead of the default cache update.
+             *
+             * Receiver type should be registered with
+             * IgniteBinding::RegisterStreamReceiver() on every data node.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param receiver Receiver. Should inherit from StreamReceiver<K, V>.
+             */
+            template<typename R>
+            void SetReceiver(const R& receiver)
+            {
+                impl.Get()->SetReceiver(receiver);
+            }
+
+            /**
+             * Get allow overwrite flag. If it is @c false, existing entries are
+             * not overwritten. Default is @c false.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Allow overwrite flag.
+             */
+            bool IsAllowOverwrite()
+            {
+                return impl.Get()->IsAllowOverwrite();
+            }
+
+            /**
+             * Set allow overwrite flag.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param allowOverwrite Allow overwrite flag.
+             */
+            void SetAllowOverwrite(bool allowOverwrite)
+            {
+                impl.Get()->SetAllowOverwrite(allowOverwrite);
+            }
+
+            /**
+             * Get skip store flag. If it is @c true, cache store is not
+             * updated. Default is @c false.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Skip store flag.
+             */
+            bool IsSkipStore()
+            {
+                return impl.Get()->IsSkipStore();
+            }
+
+            /**
+             * Set skip store flag.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param skipStore Skip store flag.
+             */
+            void SetSkipStore(bool skipStore)
+            {
+                impl.Get()->SetSkipStore(skipStore);
+            }
+
+            /**
+             * Get size of per node key-value pairs buffer. Native batch holds
+             * this many entries for every data node in topology.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Per node buffer size.
+             */
+            int32_t GetPerNodeBufferSize()
+            {
+                return impl.Get()->GetPerNodeBufferSize();
+            }
+
+            /**
+             * Set size of per node key-value pairs buffer.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param size Per node buffer size.
+             */
+            void SetPerNodeBufferSize(int32_t size)
+            {
+                impl.Get()->SetPerNodeBufferSize(size);
+            }
+
+            /**
+             * Get maximum number of parallel stream operations for a single node.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Maximum number of parallel stream operations.
+             */
+            int32_t GetPerNodeParallelOperations()
+            {
+                return impl.Get()->GetPerNodeParallelOperations();
+            }
+
+            /**
+             * Set maximum number of parallel stream operations for a single node.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param parallelOps Maximum number of parallel stream operations.
+             */
+            void SetPerNodeParallelOperations(int32_t parallelOps)
+            {
+                impl.Get()->SetPerNodeParallelOperations(parallelOps);
+            }
+
+            /**
+             * Get timeout of streamer operations.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @return Timeout in milliseconds.
+             */
+            int64_t GetTimeout()
+            {
+                return impl.Get()->GetTimeout();
+            }
+
+            /**
+             * Set timeout of streamer operations.
+             *
+             * This method should only be used on the valid instance.
+             *
+             * @param timeout Timeout in milliseconds.
+             */
+            void SetTimeout(int64_t timeout)
+            {
+                impl.Get()->SetTimeout(timeout);
+            }
+
+            /**
+             * Check if the instance is valid.
+             *
+             * Invalid instance can be returned if some of the previous
+             * operations have resulted in a failure. For example invalid
+             * instance can be returned by not-throwing version of method
+             * in case of error. Invalid instances also often can be
+             * created using default constructor.
+             *
+             * @return True if the instance is valid and can be used.
+             */
+            bool IsValid() const
+            {
+                return impl.IsValid();
+            }
+
+        private:
+            /** Implementation delegate. */
+            common::concurrent::SharedPointer<impl::datastreamer::DataStreamerImpl> impl;
+        };
+    }
+}
+
+#endif //_IGNITE_DATASTREAMER_DATA_STREAMER
@@ -0,0 +1,76 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::datastreamer::StreamReceiver class template.
+ */
+
+#ifndef _IGNITE_DATASTREAMER_STREAM_RECEIVER
+#define _IGNITE_DATASTREAMER_STREAM_RECEIVER
+
+#include <vector>
+
+#include <ignite/cache/cache.h>
+#include <ignite/cache/cache_entry.h>
+
+namespace ignite
+{
+    namespace datastreamer
+    {
+        /**
+         * Stream receiver class template. Updates cache with the data loaded by
+         * DataStreamer.
+         *
+         * Any stream receiver should inherit from this class.
+         * ignite::binary::BinaryType class template should be specialized for
+         * any class, inheriting from this class and the class should be
+         * registered with IgniteBinding::RegisterStreamReceiver() on every
+         * node.
+         *
+         * @tparam K Key type.
+         * @tparam V Value type.
+         */
+        template<typename K, typename V>
+        class StreamReceiver
+        {
+        public:
+            typedef K KeyType;
+            typedef V ValueType;
+            typedef cache::Cache<K, V> CacheType;
+            typedef cache::CacheEntry<K, V> EntryType;
+
+            /**
+             * Destructor.
+             */
+            virtual ~StreamReceiver()
+            {
+                // No-op.
+            }
+
+            /**
+             * Update cache with the entries.
+             *
+             * @param cache Cache.
+             * @param entries Entries.
+             */
+            virtual void Receive(cache::Cache<K, V>& cache, const std::vector< cache::CacheEntry<K, V> >& entries) = 0;
+        };
+    }
+}
+
+#endif //_IGNITE_DATASTREAMER_STREAM_RECEIVER
@@ -30,6 +30,7 @@
 #include <ignite/cache/cache_affinity.h>
 #include <ignite/transactions/transactions.h>
 #include <ignite/compute/compute.h>
+#include <ignite/datastreamer/data_streamer.h>
 #include <ignite/cluster/ignite_cluster.h>
 
 namespace ignite
@@ -203,6 +204,43 @@ namespace ignite
             return cache::Cache<K, V>(cacheImpl);
         }
 
+        /**
+         * Get data streamer for the cache.
+         *
+         * This method should only be used on the valid instance.
+         *
+         * @param cacheName Cache name.
+         * @return Data streamer.
+         */
+        template<typename K, typename V>
+        datastreamer::DataStreamer<K, V> GetDataStreamer(const char* cacheName)
+        {
+            IgniteError err;
+
+            datastreamer::DataStreamer<K, V> res = GetDataStreamer<K, V>(cacheName, err);
+
+            IgniteError::ThrowIfNeeded(err);
+
+            return res;
+        }
+
+        /**
+         * Get data streamer for the cache.
+         *
+         * This method should only be used on the valid instance.
+         *
+         * @param cacheName Cache name.
+         * @param err Error;
+         * @return Data streamer.
+         */
+        template<typename K, typename V>
+        datastreamer::DataStreamer<K, V> GetDataStreamer(const char* cacheName, IgniteError& err)
+        {
+            impl::datastreamer::DataStreamerImpl* streamerImpl = impl.Get()->GetDataStreamer(cacheName, err);
+
+            return datastreamer::DataStreamer<K, V>(streamerImpl);
+        }
+
         /**
          * Check if the Ignite grid is active.
          *
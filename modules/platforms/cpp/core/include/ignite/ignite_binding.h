@@ -150,6 +150,62 @@ namespace ignite
             }
         }
 
+        /**
+         * Register type as Compute apply function.
+         *
+         * Registred type should implement <tt>R Apply(const A&)</tt> method.
+         * The function is used with ignite::compute::Compute::Apply().
+         *
+         * @tparam F Function type.
+         * @tparam R Function result type.
+         * @tparam A Function argument type.
+         */
+        template<typename F, typename R, typename A>
+        void RegisterComputeApplyFunc()
+        {
+            typedef impl::compute::ComputeApplyJob<F, R, A> JobType;
+
+            impl::IgniteBindingImpl *im = impl.Get();
+
+            int32_t typeId = binary::BinaryType<JobType>::GetTypeId();
+
+            if (im)
+            {
+                im->RegisterCallback(impl::IgniteBindingImpl::CallbackType::COMPUTE_JOB_CREATE,
+                    typeId, impl::binding::ComputeJobCreate<JobType, typename JobType::ReturnType>);
+            }
+            else
+            {
+                throw IgniteError(IgniteError::IGNITE_ERR_GENERIC,
+                    "Instance is not usable (did you check for error?).");
+            }
+        }
+
+        /**
+         * Register type as Stream Receiver.
+         *
+         * Registred type should be a child of ignite::datastreamer::StreamReceiver
+         * class.
+         */
+        template<typename R>
+        void RegisterStreamReceiver()
+        {
+            impl::IgniteBindingImpl *im = impl.Get();
+
+            int32_t typeId = binary::BinaryType<R>::GetTypeId();
+
+            if (im)
+            {
+                im->RegisterCallback(impl::IgniteBindingImpl::CallbackType::STREAM_RECEIVER_INVOKE,
+                    typeId, impl::binding::StreamReceiverInvoke<R, typename R::KeyType, typename R::ValueType>);
+            }
+            else
+            {
+                throw IgniteError(IgniteError::IGNITE_ERR_GENERIC,
+                    "Instance is not usable (did you check for error?).");
+            }
+        }
+
         /**
          * Check if the instance is valid.
          *
@@ -55,11 +55,19 @@ namespace ignite
         /** Additional JVM options. */
         std::list<std::string> jvmOpts;
 
+        /**
+         * Number of native threads which execute continuous query listeners.
+         * If zero, listeners are executed by the Java thread which has invoked
+         * the callback. Compute jobs are always executed by the Java thread,
+         * as it waits for the job result.
+         */
+        int32_t nativeThreadPoolSize;
+
         /**
          * Default constructor.
          */
         IgniteConfiguration() : igniteHome(), springCfgPath(), jvmLibPath(), jvmClassPath(),
-            jvmInitMem(512), jvmMaxMem(1024), jvmOpts()
+            jvmInitMem(512), jvmMaxMem(1024), jvmOpts(), nativeThreadPoolSize(0)
         {
             // No-op.
         }
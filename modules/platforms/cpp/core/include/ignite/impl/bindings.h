@@ -25,6 +25,9 @@
 #include <ignite/impl/cache/query/continuous/continuous_query_impl.h>
 #include <ignite/impl/cache/cache_entry_processor_holder.h>
 #include <ignite/impl/compute/compute_task_holder.h>
+#include <ignite/impl/compute/compute_apply_task.h>
+#include <ignite/impl/datastreamer/stream_receiver_holder.h>
+#include <ignite/impl/cache/cache_impl.h>
 
 namespace ignite
 {
@@ -112,6 +115,57 @@ namespace ignite
 
                 return env.GetHandleRegistry().Allocate(jobPtr);
             }
+
+            /**
+             * Binding for stream receiver invocation.
+             *
+             * Deserializes receiver and the batch of entries using provided
+             * reader and passes the entries to the receiver.
+             *
+             * @tparam R The receiver type which inherits from StreamReceiver.
+             * @tparam K Key type.
+             * @tparam V Value type.
+             *
+             * @param reader Reader.
+             * @param env Environment.
+             * @return Zero.
+             */
+            template<typename R, typename K, typename V>
+            int64_t StreamReceiverInvoke(binary::BinaryReaderImpl& reader, binary::BinaryWriterImpl&,
+                IgniteEnvironment& env)
+            {
+                using namespace common::concurrent;
+
+                typedef datastreamer::StreamReceiverHolder<R> ReceiverHolder;
+                typedef typename R::CacheType CacheType;
+                typedef typename R::EntryType Entry;
+
+                ReceiverHolder rcvHolder = reader.ReadObject<ReceiverHolder>();
+
+                int32_t cnt = reader.ReadInt32();
+
+                std::vector<Entry> entries;
+                entries.reserve(cnt);
+
+                for (int32_t i = 0; i < cnt; ++i)
+                {
+                    K key = reader.ReadObject<K>();
+                    V val = reader.ReadObject<V>();
+
+                    entries.push_back(Entry(key, val));
+                }
+
+                const std::string& cacheName = rcvHolder.GetCacheName();
+
+                jobject cacheRef = env.GetProcessorCache(cacheName);
+
+                CacheType cache(new cache::CacheImpl(common::CopyChars(cacheName.c_str()),
+                    SharedPointer<IgniteEnvironment>(&env, SharedPointerEmptyDeleter), cacheRef));
+
+                rcvHolder.GetReceiver().Receive(cache, entries);
+
+                return 0;
+            }
         }
     }
 }
@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_CACHE_CACHE_ENTRY_ITERATOR_IMPL
+#define _IGNITE_IMPL_CACHE_CACHE_ENTRY_ITERATOR_IMPL
+
+#include <ignite/ignite_error.h>
+
+#include "ignite/impl/ignite_environment.h"
+#include "ignite/impl/operations.h"
+#include "ignite/impl/interop/interop_target.h"
+#include "ignite/impl/cache/query/query_batch.h"
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cache
+        {
+            /**
+             * Cache entry iterator implementation. Fetches entries from the
+             * Java iterator in batches to reduce the number of JNI calls.
+             */
+            class IGNITE_IMPORT_EXPORT CacheEntryIteratorImpl : private interop::InteropTarget
+            {
+            public:
+                /** Default number of entries fetched in one batch. */
+                enum { DEFAULT_BATCH_SIZE = 1024 };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param env Environment.
+                 * @param javaRef Java reference.
+                 * @param batchSize Number of entries fetched in one batch.
+                 */
+                CacheEntryIteratorImpl(ignite::common::concurrent::SharedPointer<IgniteEnvironment> env,
+                    jobject javaRef, int32_t batchSize);
+
+                /**
+                 * Destructor. Closes the iterator if it is not closed yet.
+                 */
+                ~CacheEntryIteratorImpl();
+
+                /**
+                 * Check whether next entry exists.
+                 *
+                 * @param err Error.
+                 * @return True if exists.
+                 */
+                bool HasNext(IgniteError& err);
+
+                /**
+                 * Get next entry.
+                 *
+                 * @param op Operation.
+                 * @param err Error.
+                 */
+                void GetNext(OutputOperation& op, IgniteError& err);
+
+                /**
+                 * Close the iterator releasing the resources held by the
+                 * Java side. Iterator has no more entries after that.
+                 *
+                 * @param err Error.
+                 */
+                void Close(IgniteError& err);
+
+            private:
+                /**
+                 * Get next batch if the current one is exhausted.
+                 *
+                 * @param err Error.
+                 * @return False in case of error.
+                 */
+                bool GetNextBatchIfNeeded(IgniteError& err);
+
+                /** Number of entries fetched in one batch. */
+                int32_t batchSize;
+
+                /** Current batch. */
+                query::QueryBatch* batch;
+
+                /** Whether the last batch has been received. */
+                bool lastBatch;
+
+                /** Whether end of the iterator is reached. */
+                bool endReached;
+
+                /** Whether the iterator is closed. */
+                bool closed;
+
+                IGNITE_NO_COPY_ASSIGNMENT(CacheEntryIteratorImpl);
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_CACHE_CACHE_ENTRY_ITERATOR_IMPL
@@ -0,0 +1,191 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::cache::CacheFutureHolder class template.
+ */
+
+#ifndef _IGNITE_IMPL_CACHE_CACHE_FUTURE_HOLDER
+#define _IGNITE_IMPL_CACHE_CACHE_FUTURE_HOLDER
+
+#include <ignite/common/promise.h>
+#include <ignite/impl/operations.h>
+#include <ignite/impl/compute/compute_job_result.h>
+#include <ignite/impl/compute/compute_task_holder.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cache
+        {
+            /**
+             * Holder of the asynchronous cache operation result. Registered in
+             * the handle registry and completed by the Java future callbacks.
+             *
+             * @tparam R Result type.
+             * @tparam O Output operation used to read the result.
+             */
+            template<typename R, typename O = Out1Operation<R> >
+            class CacheFutureHolder : public compute::ComputeTaskHolder
+            {
+            public:
+                typedef R ResultType;
+
+                /**
+                 * Constructor.
+                 */
+                CacheFutureHolder() :
+                    ComputeTaskHolder(-1)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~CacheFutureHolder()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Process local job result.
+                 *
+                 * @param job Job.
+                 * @return Policy.
+                 */
+                virtual int32_t JobResultLocal(compute::ComputeJobHolder&)
+                {
+                    return compute::ComputeJobResultPolicy::WAIT;
+                }
+
+                /**
+                 * Process remote job result.
+                 *
+                 * @param reader Reader for stream with result.
+                 * @return Policy.
+                 */
+                virtual int32_t JobResultRemote(binary::BinaryReaderImpl&)
+                {
+                    return compute::ComputeJobResultPolicy::WAIT;
+                }
+
+                /**
+                 * Process error.
+                 *
+                 * @param err Error.
+                 */
+                virtual void JobResultError(const IgniteError& err)
+                {
+                    res.SetError(err);
+                }
+
+                /**
+                 * Process successful primitive result.
+                 *
+                 * @param value Value.
+                 */
+                virtual void JobResultSuccess(int64_t value)
+                {
+                    res.SetResult(compute::PrimitiveFutureResult<ResultType>(value));
+                }
+
+                /**
+                 * Process successful result.
+                 *
+                 * @param reader Reader for stream with result.
+                 */
+                virtual void JobResultSuccess(binary::BinaryReaderImpl& reader)
+                {
+                    ResultType val = ResultType();
+                    O outOp(val);
+
+                    outOp.ProcessOutput(reader);
+
+                    res.SetResult(val);
+                }
+
+                /**
+                 * Process successful null result.
+                 */
+                virtual void JobNullResultSuccess()
+                {
+                    res.SetResult(ResultType());
+                }
+
+                /**
+                 * Set promise to the state which corresponds to result.
+                 */
+                virtual void Reduce()
+                {
+                    res.SetPromise(promise);
+                }
+
+                /**
+                 * Get result promise.
+                 *
+                 * @return Reference to result promise.
+                 */
+                common::Promise<ResultType>& GetPromise()
+                {
+                    return promise;
+                }
+
+            private:
+                /** Result. */
+                compute::ComputeJobResult<ResultType> res;
+
+                /** Result promise. */
+                common::Promise<ResultType> promise;
+            };
+
+            /**
+             * Holder of the asynchronous cache invoke result. Entry processor
+             * errors are passed as a part of the successful result.
+             *
+             * @tparam R Processor result type.
+             */
+            template<typename R>
+            class CacheInvokeFutureHolder : public CacheFutureHolder<R>
+            {
+            public:
+                /**
+                 * Process successful result.
+                 *
+                 * @param reader Reader for stream with result.
+                 */
+                virtual void JobResultSuccess(binary::BinaryReaderImpl& reader)
+                {
+                    bool failed = reader.GetStream()->ReadBool();
+
+                    if (!failed)
+                    {
+                        CacheFutureHolder<R>::JobResultSuccess(reader);
+
+                        return;
+                    }
+
+                    this->JobResultError(ReadEntryProcessorError(reader));
+                }
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_CACHE_CACHE_FUTURE_HOLDER
@@ -23,9 +23,11 @@
 #include <ignite/cache/query/query_text.h>
 #include <ignite/cache/query/query_sql_fields.h>
 #include <ignite/impl/cache/query/query_impl.h>
+#include <ignite/impl/cache/cache_entry_iterator_impl.h>
 #include <ignite/impl/cache/query/continuous/continuous_query_impl.h>
 
 #include <ignite/impl/interop/interop_target.h>
+#include <ignite/impl/compute/compute_task_holder.h>
 
 namespace ignite
 {    
@@ -48,6 +50,81 @@ namespace ignite
             class IGNITE_IMPORT_EXPORT CacheImpl : private interop::InteropTarget
             {
             public:
+                /**
+                 * Asynchronous operation type.
+                 */
+                struct AsyncOperation
+                {
+                    enum Type
+                    {
+                        /** Operation: Put. */
+                        PUT = 57,
+
+                        /** Operation: Clear(). */
+                        CLEAR_CACHE = 58,
+
+                        /** Operation: ClearAll. */
+                        CLEAR_ALL = 59,
+
+                        /** Operation: RemoveAll(). */
+                        REMOVE_ALL2 = 60,
+
+                        /** Operation: Clear. */
+                        CLEAR = 62,
+
+                        /** Operation: PutAll. */
+                        PUT_ALL = 65,
+
+                        /** Operation: RemoveAll. */
+                        REMOVE_ALL = 66,
+
+                        /** Operation: Get. */
+                        GET = 67,
+
+                        /** Operation: ContainsKey. */
+                        CONTAINS_KEY = 68,
+
+                        /** Operation: ContainsKeys. */
+                        CONTAINS_KEYS = 69,
+
+                        /** Operation: Remove(K, V). */
+                        REMOVE_2 = 70,
+
+                        /** Operation: Remove(K). */
+                        REMOVE_1 = 71,
+
+                        /** Operation: GetAll. */
+                        GET_ALL = 72,
+
+                        /** Operation: GetAndPut. */
+                        GET_AND_PUT = 73,
+
+                        /** Operation: GetAndPutIfAbsent. */
+                        GET_AND_PUT_IF_ABSENT = 74,
+
+                        /** Operation: GetAndRemove. */
+                        GET_AND_REMOVE = 75,
+
+                        /** Operation: GetAndReplace. */
+                        GET_AND_REPLACE = 76,
+
+                        /** Operation: Replace(K, V). */
+                        REPLACE_2 = 77,
+
+                        /** Operation: Replace(K, V, V). */
+                        REPLACE_3 = 78,
+
+                        /** Operation: Invoke. */
+                        INVOKE = 79,
+
+                        /** Operation: InvokeAll. */
+                        INVOKE_ALL = 80,
+
+                        /** Operation: PutIfAbsent. */
+                        PUT_IF_ABSENT = 81
+                    };
+                };
+
                 /**
                  * Constructor used to create new instance.
                  *
@@ -130,6 +207,15 @@ namespace ignite
                  */
                 void PutAll(InputOperation& inOp, IgniteError& err);
 
+                /**
+                 * Perform ExecuteBatch.
+                 *
+                 * @param inOp Input.
+                 * @param outOp Output.
+                 * @param err Error.
+                 */
+                void ExecuteBatch(InputOperation& inOp, OutputOperation& outOp, IgniteError& err);
+
                 /**
                  * Perform GetAndPut.
                  *
@@ -282,6 +368,27 @@ namespace ignite
                 */
                 int32_t Size(int32_t peekModes, bool local, IgniteError& err);
 
+                /**
+                 * Get iterator over the entries cached on this node.
+                 *
+                 * @param peekModes Peek modes.
+                 * @param batchSize Number of entries fetched in one batch.
+                 * @param err Error.
+                 * @return Iterator.
+                 */
+                CacheEntryIteratorImpl* LocalEntries(int32_t peekModes, int32_t batchSize, IgniteError& err);
+
+                /**
+                 * Get iterator over the entries of the partition stored on
+                 * this node.
+                 *
+                 * @param part Partition.
+                 * @param batchSize Number of entries fetched in one batch.
+                 * @param err Error.
+                 * @return Iterator.
+                 */
+                CacheEntryIteratorImpl* LocalPartitionEntries(int32_t part, int32_t batchSize, IgniteError& err);
+
                 /**
                  * Invoke query.
                  *
@@ -327,6 +434,15 @@ namespace ignite
                  */
                 void Invoke(InputOperation& inOp, OutputOperation& outOp, IgniteError& err);
 
+                /**
+                 * Perform InvokeAll.
+                 *
+                 * @param inOp Input.
+                 * @param outOp Output.
+                 * @param err Error.
+                 */
+                void InvokeAll(InputOperation& inOp, OutputOperation& outOp, IgniteError& err);
+
                 /**
                  * Perform Invoke of Java entry processor.
                  *
@@ -402,6 +518,28 @@ namespace ignite
                  */
                 void LocalLoadCache(IgniteError& err);
 
+                /**
+                 * Start asynchronous operation. Future holder is completed by
+                 * the Java future callbacks once the operation is done.
+                 *
+                 * @param op Operation type.
+                 * @param inOp Input.
+                 * @param fut Future holder.
+                 * @param err Error.
+                 */
+                void OutOpAsync(AsyncOperation::Type op, InputOperation& inOp,
+                    common::concurrent::SharedPointer<compute::ComputeTaskHolder> fut, IgniteError& err);
+
+                /**
+                 * Start asynchronous operation without arguments.
+                 *
+                 * @param op Operation type.
+                 * @param fut Future holder.
+                 * @param err Error.
+                 */
+                void OutOpAsync(AsyncOperation::Type op,
+                    common::concurrent::SharedPointer<compute::ComputeTaskHolder> fut, IgniteError& err);
+
             private:
                 IGNITE_NO_COPY_ASSIGNMENT(CacheImpl);
 
@@ -0,0 +1,267 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::cache::CachePartitionVisitor class template.
+ */
+
+#ifndef _IGNITE_IMPL_CACHE_CACHE_PARTITION_VISITOR
+#define _IGNITE_IMPL_CACHE_CACHE_PARTITION_VISITOR
+
+#include <stdint.h>
+
+#include <exception>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/ignite_error.h>
+
+#include <ignite/cache/cache_entry_iterator.h>
+#include <ignite/impl/cache/cache_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cache
+        {
+            /**
+             * Visits local entries of the set of partitions using several
+             * threads. Every partition is visited by a single thread, while
+             * threads take partitions one by one until all of them are visited
+             * or an error occurs.
+             *
+             * @tparam K Key type.
+             * @tparam V Value type.
+             * @tparam F Visitor type. Should implement
+             *  void operator()(const ignite::cache::CacheEntry<K, V>&) and be
+             *  safe to call from several threads concurrently.
+             */
+            template<typename K, typename V, typename F>
+            class CachePartitionVisitor
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param cache Cache.
+                 * @param parts Partitions to visit.
+                 * @param visitor Visitor.
+                 * @param batchSize Number of entries fetched in one batch.
+                 */
+                CachePartitionVisitor(CacheImpl& cache, const std::vector<int32_t>& parts, F& visitor,
+                    int32_t batchSize) :
+                    cache(cache),
+                    parts(parts),
+                    visitor(visitor),
+                    batchSize(batchSize),
+                    next(0),
+                    error(),
+                    mux()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Visit the partitions.
+                 *
+                 * @param threadNum Number of threads. Current thread is one of
+                 *  them. Limited by the number of partitions.
+                 * @param err Error. Set to the first error which has occurred.
+                 */
+                void Visit(int32_t threadNum, IgniteError& err)
+                {
+                    int32_t partCnt = static_cast<int32_t>(parts.size());
+
+                    if (threadNum > partCnt)
+                        threadNum = partCnt;
+
+                    std::vector<Worker*> workers;
+
+                    workers.reserve(threadNum > 1 ? threadNum - 1 : 0);
+
+                    for (int32_t i = 1; i < threadNum; ++i)
+                    {
+                        workers.push_back(new Worker(*this));
+
+                        workers.back()->Start();
+                    }
+
+                    Run();
+
+                    for (size_t i = 0; i < workers.size(); ++i)
+                    {
+                        workers[i]->Join();
+
+                        delete workers[i];
+                    }
+
+                    err = error;
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(CachePartitionVisitor);
+
+                /**
+                 * Worker thread.
+                 */
+                class Worker : public common::concurrent::Thread
+                {
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param owner Visitor.
+                     */
+                    explicit Worker(CachePartitionVisitor& owner) :
+                        owner(owner)
+                    {
+                        // No-op.
+                    }
+
+                    virtual void Run()
+                    {
+                        owner.Run();
+                    }
+
+                private:
+                    IGNITE_NO_COPY_ASSIGNMENT(Worker);
+
+                    /** Visitor. */
+                    CachePartitionVisitor& owner;
+                };
+
+                /**
+                 * Take partitions and visit them until there are none left.
+                 */
+                void Run()
+                {
+                    int32_t partCnt = static_cast<int32_t>(parts.size());
+
+                    while (!IsFailed())
+                    {
+                        int32_t idx = common::concurrent::Atomics::IncrementAndGet32(&next) - 1;
+
+                        if (idx >= partCnt)
+                            break;
+
+                        IgniteError err;
+
+                        try
+                        {
+                            VisitPartition(parts[idx], err);
+                        }
+                        catch (const IgniteError& err0)
+                        {
+                            err = err0;
+                        }
+                        catch (const std::exception& err0)
+                        {
+                            err = IgniteError(IgniteError::IGNITE_ERR_STD, err0.what());
+                        }
+                        catch (...)
+                        {
+                            err = IgniteError(IgniteError::IGNITE_ERR_UNKNOWN,
+                                "Unknown error occurred during partition visit.");
+                        }
+
+                        if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                            SetError(err);
+                    }
+                }
+
+                /**
+                 * Visit single partition.
+                 *
+                 * @param part Partition.
+                 * @param err Error.
+                 */
+                void VisitPartition(int32_t part, IgniteError& err)
+                {
+                    ignite::cache::CacheEntryIterator<K, V> iter(cache.LocalPartitionEntries(part, batchSize, err));
+
+                    if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                        return;
+
+                    while (!IsFailed() && iter.HasNext(err))
+                    {
+                        ignite::cache::CacheEntry<K, V> entry = iter.GetNext(err);
+
+                        if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                            break;
+
+                        visitor(entry);
+                    }
+
+                    // Release the partition right away if the visit has stopped early.
+                    IgniteError closeErr;
+
+                    iter.Close(closeErr);
+                }
+
+                /**
+                 * Check whether one of the threads has failed.
+                 *
+                 * @return True if failed.
+                 */
+                bool IsFailed()
+                {
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    return error.GetCode() != IgniteError::IGNITE_SUCCESS;
+                }
+
+                /**
+                 * Set error unless it is already set.
+                 *
+                 * @param err Error.
+                 */
+                void SetError(const IgniteError& err)
+                {
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    if (error.GetCode() == IgniteError::IGNITE_SUCCESS)
+                        error = err;
+                }
+
+                /** Cache. */
+                CacheImpl& cache;
+
+                /** Partitions. */
+                const std::vector<int32_t>& parts;
+
+                /** Visitor. */
+                F& visitor;
+
+                /** Number of entries fetched in one batch. */
+                int32_t batchSize;
+
+                /** Index of the next partition to visit. */
+                int32_t next;
+
+                /** First error. */
+                IgniteError error;
+
+                /** Mutex. */
+                common::concurrent::CriticalSection mux;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_CACHE_CACHE_PARTITION_VISITOR
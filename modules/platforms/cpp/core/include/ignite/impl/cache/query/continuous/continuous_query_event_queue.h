@@ -0,0 +1,406 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::cache::query::continuous::ContinuousQueryEventQueue class template.
+ */
+
+#ifndef _IGNITE_IMPL_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_EVENT_QUEUE
+#define _IGNITE_IMPL_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_EVENT_QUEUE
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/ignite_error.h>
+#include <ignite/reference.h>
+
+#include <ignite/cache/event/cache_entry_event_listener.h>
+#include <ignite/cache/query/continuous/continuous_query_overflow_policy.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cache
+        {
+            namespace query
+            {
+                namespace continuous
+                {
+                    /**
+                     * Bounded queue of the continuous query events. Events are
+                     * delivered to the listener in batches by the dedicated
+                     * dispatcher thread, so the notifying threads are not
+                     * blocked by the listener.
+                     *
+                     * @tparam K Key type.
+                     * @tparam V Value type.
+                     */
+                    template<typename K, typename V>
+                    class ContinuousQueryEventQueue
+                    {
+                    public:
+                        typedef ignite::cache::CacheEntryEvent<K, V> EventType;
+                        typedef ignite::cache::event::CacheEntryEventListener<K, V> ListenerType;
+                        typedef ignite::cache::query::continuous::ContinuousQueryOverflowPolicy OverflowPolicy;
+
+                        /**
+                         * Constructor. Starts the dispatcher thread.
+                         *
+                         * @param lsnr Listener.
+                         * @param capacity Maximum number of queued events.
+                         * @param batchSize Maximum number of events in the batch.
+                         * @param batchDelay Maximum time in milliseconds the
+                         *     event waits for the batch to fill up. Zero means
+                         *     that available events are delivered immediately.
+                         * @param policy Overflow policy.
+                         */
+                        ContinuousQueryEventQueue(Reference<ListenerType>& lsnr, int32_t capacity,
+                            int32_t batchSize, int64_t batchDelay, OverflowPolicy::Type policy) :
+                            dispatcher(new Dispatcher(lsnr, capacity, batchSize, batchDelay, policy))
+                        {
+                            dispatcher->Start();
+                        }
+
+                        /**
+                         * Destructor. Delivers the queued events and stops the
+                         * dispatcher thread.
+                         *
+                         * If called from the listener, e.g. when the listener
+                         * releases the last query handle, the dispatcher thread
+                         * can not be joined. It is detached instead and releases
+                         * itself once the queued events are delivered.
+                         */
+                        ~ContinuousQueryEventQueue()
+                        {
+                            dispatcher->Stop();
+
+                            if (dispatcher->IsCurrent())
+                            {
+                                dispatcher->Detach();
+                                dispatcher->ReleaseOnExit();
+
+                                return;
+                            }
+
+                            dispatcher->Join();
+
+                            delete dispatcher;
+                        }
+
+                        /**
+                         * Add events to the queue applying the overflow policy
+                         * if there is not enough space.
+                         *
+                         * With the BLOCK policy the calling thread waits for the
+                         * listener. That is the Java thread which has invoked
+                         * the callback or the native pool worker if
+                         * IgniteConfiguration::nativeThreadPoolSize is set. The
+                         * blocked worker also delays listeners of the other
+                         * queries assigned to it.
+                         *
+                         * @param evts Events.
+                         */
+                        void Push(const std::vector<EventType>& evts)
+                        {
+                            dispatcher->Push(evts);
+                        }
+
+                    private:
+                        IGNITE_NO_COPY_ASSIGNMENT(ContinuousQueryEventQueue);
+
+                        /**
+                         * Dispatcher thread. Holds the queue state, so it can
+                         * outlive the queue if detached.
+                         */
+                        class Dispatcher : public common::concurrent::Thread
+                        {
+                        public:
+                            /**
+                             * Constructor.
+                             *
+                             * @param lsnr Listener.
+                             * @param capacity Maximum number of queued events.
+                             * @param batchSize Maximum number of events in the batch.
+                             * @param batchDelay Maximum batch delay in milliseconds.
+                             * @param policy Overflow policy.
+                             */
+                            Dispatcher(Reference<ListenerType>& lsnr, int32_t capacity,
+                                int32_t batchSize, int64_t batchDelay, OverflowPolicy::Type policy) :
+                                lsnr(lsnr),
+                                capacity(capacity > 0 ? static_cast<size_t>(capacity) : 1),
+                                batchSize(batchSize > 0 ? static_cast<size_t>(batchSize) : 1),
+                                batchDelay(static_cast<int32_t>(
+                                    std::min<int64_t>(batchDelay, std::numeric_limits<int32_t>::max()))),
+                                policy(policy),
+                                events(),
+                                mux(),
+                                notEmpty(),
+                                notFull(),
+                                stopped(false),
+                                failed(false),
+                                releaseOnExit(false)
+                            {
+                                // No-op.
+                            }
+
+                            virtual void Run()
+                            {
+                                Dispatch();
+
+                                // Set by the same thread, so no synchronization is needed.
+                                if (releaseOnExit)
+                                    delete this;
+                            }
+
+                            /**
+                             * Stop accepting events. Queued events are still
+                             * delivered.
+                             */
+                            void Stop()
+                            {
+                                common::concurrent::CsLockGuard guard(mux);
+
+                                stopped = true;
+
+                                notEmpty.NotifyAll();
+                                notFull.NotifyAll();
+                            }
+
+                            /**
+                             * Make the thread release itself when done.
+                             * Should be called from the thread itself.
+                             */
+                            void ReleaseOnExit()
+                            {
+                                releaseOnExit = true;
+                            }
+
+                            /**
+                             * Add events to the queue.
+                             *
+                             * @param evts Events.
+                             */
+                            void Push(const std::vector<EventType>& evts)
+                            {
+                                common::concurrent::CsLockGuard guard(mux);
+
+                                for (typename std::vector<EventType>::const_iterator it = evts.begin();
+                                    it != evts.end(); ++it)
+                                {
+                                    if (failed || stopped)
+                                        return;
+
+                                    if (events.size() >= capacity && !MakeSpace())
+                                        return;
+
+                                    events.push_back(*it);
+
+                                    // Dispatcher waits either for the first event or
+                                    // for the full batch.
+                                    if (events.size() == 1 || events.size() >= batchSize)
+                                        notEmpty.NotifyOne();
+                                }
+                            }
+
+                        private:
+                            IGNITE_NO_COPY_ASSIGNMENT(Dispatcher);
+
+                            /**
+                             * Make space for the new event according to the policy.
+                             * Should be called under the lock.
+                             *
+                             * @return True if the event can be added.
+                             */
+                            bool MakeSpace()
+                            {
+                                switch (policy)
+                                {
+                                    case OverflowPolicy::DROP_OLDEST:
+                                    {
+                                        events.pop_front();
+
+                                        return true;
+                                    }
+
+                                    case OverflowPolicy::FAIL:
+                                    {
+                                        failed = true;
+
+                                        events.clear();
+
+                                        // Dispatcher notifies the listener.
+                                        notEmpty.NotifyOne();
+
+                                        return false;
+                                    }
+
+                                    case OverflowPolicy::BLOCK:
+                                    default:
+                                    {
+                                        while (events.size() >= capacity && !stopped)
+                                            notFull.Wait(mux);
+
+                                        return !stopped;
+                                    }
+                                }
+                            }
+
+                            /**
+                             * Deliver events to the listener until stopped.
+                             */
+                            void Dispatch()
+                            {
+                                std::vector<EventType> batch;
+
+                                batch.reserve(batchSize);
+
+                                while (true)
+                                {
+                                    bool notifyFailed = false;
+
+                                    {
+                                        common::concurrent::CsLockGuard guard(mux);
+
+                                        while (events.empty() && !stopped && !failed)
+                                            notEmpty.Wait(mux);
+
+                                        // Give the batch a chance to fill up. Pushing
+                                        // thread only wakes the dispatcher up once the
+                                        // batch is full.
+                                        if (batchDelay > 0 && !events.empty() && events.size() < batchSize &&
+                                            !stopped && !failed)
+                                            notEmpty.WaitFor(mux, batchDelay);
+
+                                        if (failed)
+                                        {
+                                            events.clear();
+
+                                            notifyFailed = true;
+                                        }
+                                        else if (events.empty() && stopped)
+                                            return;
+
+                                        size_t cnt = events.size() < batchSize ? events.size() : batchSize;
+
+                                        batch.assign(events.begin(), events.begin() + cnt);
+
+                                        events.erase(events.begin(), events.begin() + cnt);
+
+                                        notFull.NotifyAll();
+                                    }
+
+                                    if (notifyFailed)
+                                    {
+                                        NotifyError(IgniteError(IgniteError::IGNITE_ERR_GENERIC,
+                                            "Continuous query event queue overflow. Events are not delivered anymore."));
+
+                                        return;
+                                    }
+
+                                    if (!batch.empty())
+                                        Deliver(batch);
+                                }
+                            }
+
+                            /**
+                             * Pass the batch to the listener ignoring the exceptions.
+                             *
+                             * @param batch Batch.
+                             */
+                            void Deliver(const std::vector<EventType>& batch)
+                            {
+                                try
+                                {
+                                    lsnr.Get()->OnEvent(&batch[0], static_cast<uint32_t>(batch.size()));
+                                }
+                                catch (...)
+                                {
+                                    // No-op.
+                                }
+                            }
+
+                            /**
+                             * Pass the error to the listener ignoring the exceptions.
+                             *
+                             * @param err Error.
+                             */
+                            void NotifyError(const IgniteError& err)
+                            {
+                                try
+                                {
+                                    lsnr.Get()->OnError(err);
+                                }
+                                catch (...)
+                                {
+                                    // No-op.
+                                }
+                            }
+
+                            /** Listener. Kept here as the query may be released by the listener. */
+                            Reference<ListenerType> lsnr;
+
+                            /** Maximum number of queued events. */
+                            size_t capacity;
+
+                            /** Maximum number of events in the batch. */
+                            size_t batchSize;
+
+                            /** Maximum time in milliseconds the event waits for the batch to fill up. */
+                            int32_t batchDelay;
+
+                            /** Overflow policy. */
+                            OverflowPolicy::Type policy;
+
+                            /** Queued events. */
+                            std::deque<EventType> events;
+
+                            /** Mutex. */
+                            common::concurrent::CriticalSection mux;
+
+                            /** Signalled when events are added. */
+                            common::concurrent::ConditionVariable notEmpty;
+
+                            /** Signalled when events are taken. */
+                            common::concurrent::ConditionVariable notFull;
+
+                            /** Stopped flag. */
+                            bool stopped;
+
+                            /** Failed flag. Set on overflow with the FAIL policy. */
+                            bool failed;
+
+                            /** Release on exit flag. */
+                            bool releaseOnExit;
+                        };
+
+                        /** Dispatcher thread. */
+                        Dispatcher* dispatcher;
+                    };
+                }
+            }
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_CACHE_QUERY_CONTINUOUS_CONTINUOUS_QUERY_EVENT_QUEUE
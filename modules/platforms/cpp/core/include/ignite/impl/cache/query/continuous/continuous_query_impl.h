@@ -28,9 +28,13 @@
 
 #include <ignite/reference.h>
 
+#include <ignite/common/concurrent.h>
+
 #include <ignite/cache/event/cache_entry_event_listener.h>
+#include <ignite/cache/query/continuous/continuous_query_overflow_policy.h>
 #include <ignite/binary/binary_raw_reader.h>
 #include <ignite/impl/cache/event/cache_entry_event_filter_holder.h>
+#include <ignite/impl/cache/query/continuous/continuous_query_event_queue.h>
 
 namespace ignite
 {
@@ -77,6 +81,22 @@ namespace ignite
                          */
                         enum { DEFAULT_TIME_INTERVAL = 0 };
 
+                        /**
+                         * Default value for the native event queue size.
+                         * Zero means that the queue is disabled.
+                         */
+                        enum { DEFAULT_EVENT_QUEUE_SIZE = 0 };
+
+                        /**
+                         * Default value for the event batch size.
+                         */
+                        enum { DEFAULT_EVENT_BATCH_SIZE = 256 };
+
+                        /**
+                         * Default value for the event batch delay.
+                         */
+                        enum { DEFAULT_EVENT_BATCH_DELAY = 0 };
+
                         /**
                          * Constructor.
                          *
@@ -86,6 +106,10 @@ namespace ignite
                             local(loc),
                             bufferSize(DEFAULT_BUFFER_SIZE),
                             timeInterval(DEFAULT_TIME_INTERVAL),
+                            eventQueueSize(DEFAULT_EVENT_QUEUE_SIZE),
+                            eventBatchSize(DEFAULT_EVENT_BATCH_SIZE),
+                            eventBatchDelay(DEFAULT_EVENT_BATCH_DELAY),
+                            overflowPolicy(ignite::cache::query::continuous::ContinuousQueryOverflowPolicy::BLOCK),
                             filterOp(filterOp)
                         {
                             // No-op.
@@ -185,6 +209,97 @@ namespace ignite
                             return timeInterval;
                         }
 
+                        /**
+                         * Set native event queue size.
+                         *
+                         * When set to a positive value, events are put into a
+                         * bounded queue and delivered to the listener in batches
+                         * by the dedicated thread, so a slow listener does not
+                         * block the notifying threads. Zero disables the queue
+                         * and events are delivered in the notifying thread.
+                         *
+                         * @param val Maximum number of queued events.
+                         */
+                        void SetEventQueueSize(int32_t val)
+                        {
+                            eventQueueSize = val;
+                        }
+
+                        /**
+                         * Get native event queue size.
+                         *
+                         * @return Maximum number of queued events.
+                         */
+                        int32_t GetEventQueueSize() const
+                        {
+                            return eventQueueSize;
+                        }
+
+                        /**
+                         * Set maximum number of events delivered to the listener
+                         * at once when the native event queue is enabled.
+                         *
+                         * @param val Event batch size.
+                         */
+                        void SetEventBatchSize(int32_t val)
+                        {
+                            eventBatchSize = val;
+                        }
+
+                        /**
+                         * Get maximum number of events delivered to the listener
+                         * at once when the native event queue is enabled.
+                         *
+                         * @return Event batch size.
+                         */
+                        int32_t GetEventBatchSize() const
+                        {
+                            return eventBatchSize;
+                        }
+
+                        /**
+                         * Set maximum time the event waits in the native queue for
+                         * the batch to fill up. Zero means that available events
+                         * are delivered immediately.
+                         *
+                         * @param val Event batch delay in milliseconds.
+                         */
+                        void SetEventBatchDelay(int64_t val)
+                        {
+                            eventBatchDelay = val;
+                        }
+
+                        /**
+                         * Get maximum time the event waits in the native queue for
+                         * the batch to fill up.
+                         *
+                         * @return Event batch delay in milliseconds.
+                         */
+                        int64_t GetEventBatchDelay() const
+                        {
+                            return eventBatchDelay;
+                        }
+
+                        /**
+                         * Set policy applied when the native event queue is full.
+                         *
+                         * @param val Overflow policy.
+                         */
+                        void SetOverflowPolicy(ignite::cache::query::continuous::ContinuousQueryOverflowPolicy::Type val)
+                        {
+                            overflowPolicy = val;
+                        }
+
+                        /**
+                         * Get policy applied when the native event queue is full.
+                         *
+                         * @return Overflow policy.
+                         */
+                        ignite::cache::query::continuous::ContinuousQueryOverflowPolicy::Type GetOverflowPolicy() const
+                        {
+                            return overflowPolicy;
+                        }
+
                         /**
                          * Get remote filter holder.
                          *
@@ -235,6 +350,18 @@ namespace ignite
                          */
                         int64_t timeInterval;
 
+                        /** Native event queue size. Zero means that the queue is disabled. */
+                        int32_t eventQueueSize;
+
+                        /** Maximum number of events delivered to the listener at once. */
+                        int32_t eventBatchSize;
+
+                        /** Maximum time in milliseconds the event waits for the batch to fill up. */
+                        int64_t eventBatchDelay;
+
+                        /** Policy applied when the native event queue is full. */
+                        ignite::cache::query::continuous::ContinuousQueryOverflowPolicy::Type overflowPolicy;
+
                         /** Cache entry event filter holder. */
                         std::auto_ptr<event::CacheEntryEventFilterHolderBase> filterOp;
                     };
@@ -275,7 +402,9 @@ namespace ignite
                         ContinuousQueryImpl(Reference<ignite::cache::event::CacheEntryEventListener<K, V> >& lsnr,
                             bool loc) :
                             ContinuousQueryImplBase(loc, new event::CacheEntryEventFilterHolder<void>()),
-                            lsnr(lsnr)
+                            lsnr(lsnr),
+                            queueMux(),
+                            queue()
                         {
                             // No-op.
                         }
@@ -291,7 +420,9 @@ namespace ignite
                         ContinuousQueryImpl(Reference<ignite::cache::event::CacheEntryEventListener<K, V> >& lsnr,
                             bool loc, const Reference<F>& filter) :
                             ContinuousQueryImplBase(loc, new event::CacheEntryEventFilterHolder<F>(filter)),
-                            lsnr(lsnr)
+                            lsnr(lsnr),
+                            queueMux(),
+                            queue()
                         {
                             // No-op.
                         }
@@ -355,12 +486,39 @@ namespace ignite
                             for (int32_t i = 0; i < cnt; ++i)
                                 events[i].Read(reader);
 
-                            lsnr.Get()->OnEvent(events.data(), cnt);
+                            if (GetEventQueueSize() > 0)
+                                GetQueue().Push(events);
+                            else
+                                lsnr.Get()->OnEvent(events.data(), cnt);
                         }
 
                     private:
+                        /**
+                         * Get native event queue creating it on the first use.
+                         *
+                         * @return Event queue.
+                         */
+                        ContinuousQueryEventQueue<K, V>& GetQueue()
+                        {
+                            common::concurrent::CsLockGuard guard(queueMux);
+
+                            if (!queue.get())
+                            {
+                                queue.reset(new ContinuousQueryEventQueue<K, V>(lsnr, GetEventQueueSize(),
+                                    GetEventBatchSize(), GetEventBatchDelay(), GetOverflowPolicy()));
+                            }
+
+                            return *queue;
+                        }
+
                         /** Cache entry event listener. */
                         Reference<ignite::cache::event::CacheEntryEventListener<K, V> > lsnr;
+
+                        /** Native event queue lock. */
+                        common::concurrent::CriticalSection queueMux;
+
+                        /** Native event queue. Should be destructed before the listener. */
+                        std::auto_ptr< ContinuousQueryEventQueue<K, V> > queue;
                     };
 
                     /**
@@ -119,6 +119,14 @@ namespace ignite
                      */
                     QueryFieldsRowImpl* GetNextRow();
 
+                    /**
+                     * Get next row reusing the row instance if it reads from
+                     * the memory of this batch.
+                     *
+                     * @param row Row. Reset to the next row.
+                     */
+                    void GetNextRow(common::concurrent::SharedPointer<QueryFieldsRowImpl>& row);
+
                 private:
                     /** Environment. */
                     IgniteEnvironment& env;
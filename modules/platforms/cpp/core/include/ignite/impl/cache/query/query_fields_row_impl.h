@@ -40,7 +40,7 @@ namespace ignite
                     /**
                      * Constructor.
                      *
-                     * @param mem Memory containig row data.
+                     * @param mem Memory containing row data.
                      */
                     QueryFieldsRowImpl(SP_InteropMemory mem, int32_t rowBegin, int32_t columnNum) :
                         mem(mem),
@@ -52,6 +52,28 @@ namespace ignite
                         stream.Position(rowBegin);
                     }
 
+                    /**
+                     * Point the row to another row in the same memory.
+                     *
+                     * @param mem Memory containing row data.
+                     * @param rowBegin Row data position.
+                     * @param columnNum Number of columns.
+                     * @return True on success and false if the row data is
+                     *     in the different memory.
+                     */
+                    bool Reset(const SP_InteropMemory& mem, int32_t rowBegin, int32_t columnNum)
+                    {
+                        if (this->mem.Get() != mem.Get())
+                            return false;
+
+                        stream.Position(rowBegin);
+
+                        this->columnNum = columnNum;
+                        processed = 0;
+
+                        return true;
+                    }
+
                     /**
                      * Check whether next entry exists.
                      *
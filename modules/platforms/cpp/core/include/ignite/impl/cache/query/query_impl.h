@@ -33,12 +33,14 @@ namespace ignite
             namespace query
             {
                 class QueryFieldsRowImpl;
+                class QueryBatchPrefetcher;
 
                 /**
                  * Query cursor implementation.
                  */
                 class IGNITE_IMPORT_EXPORT QueryCursorImpl
                 {
+                    friend class QueryBatchPrefetcher;
                 public:
                     /**
                      * Constructor.
@@ -77,6 +79,14 @@ namespace ignite
                      */
                     QueryFieldsRowImpl* GetNextRow(IgniteError& err);
 
+                    /**
+                     * Get next row reusing the row instance if possible.
+                     *
+                     * @param row Row. Reset to the next row on success.
+                     * @param err Error.
+                     */
+                    void GetNextRow(common::concurrent::SharedPointer<QueryFieldsRowImpl>& row, IgniteError& err);
+
                     /**
                      * Get all cursor entries.
                      *
@@ -92,6 +102,18 @@ namespace ignite
                      */
                     void GetAll(OutputOperation& op);
 
+                    /**
+                     * Set number of batches fetched in background while the
+                     * current batch is processed. Only has effect if called
+                     * before the iteration is started.
+                     *
+                     * @param depth Prefetch depth. Zero disables prefetching.
+                     */
+                    void SetPrefetchDepth(int32_t depth)
+                    {
+                        prefetchDepth = depth;
+                    }
+
                 private:
                     /** Environment. */
                     ignite::common::concurrent::SharedPointer<impl::IgniteEnvironment> env;
@@ -111,6 +133,12 @@ namespace ignite
                     /** Whether GetAll() method was called. */
                     bool getAllCalled;
 
+                    /** Number of batches fetched in background. */
+                    int32_t prefetchDepth;
+
+                    /** Background batch fetcher. Only used if the prefetch depth is positive. */
+                    QueryBatchPrefetcher* prefetcher;
+
                     IGNITE_NO_COPY_ASSIGNMENT(QueryCursorImpl);
 
                     /**
@@ -136,6 +164,15 @@ namespace ignite
                      * @return True if the next element is available.
                      */
                     bool IteratorHasNext(IgniteError& err);
+
+                    /**
+                     * Fetch next non-empty batch from the Java side.
+                     *
+                     * @param err Error.
+                     * @return Batch or null if there are no more batches or
+                     *     an error has occurred.
+                     */
+                    QueryBatch* FetchBatch(IgniteError& err);
                 };
             }
         }
@@ -0,0 +1,429 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::compute::ComputeApplyTask class template.
+ */
+
+#ifndef _IGNITE_IMPL_COMPUTE_COMPUTE_APPLY_TASK
+#define _IGNITE_IMPL_COMPUTE_COMPUTE_APPLY_TASK
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/binary/binary.h>
+#include <ignite/compute/compute_func.h>
+#include <ignite/compute/compute_task.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace compute
+        {
+            /**
+             * Name of the argument or result type of the apply job. Binary
+             * type name is used for user types.
+             *
+             * @tparam T Type.
+             */
+            template<typename T>
+            struct ComputeApplyTypeName
+            {
+                /**
+                 * Get type name.
+                 *
+                 * @param dst Output type name.
+                 */
+                static void Get(std::string& dst)
+                {
+                    ignite::binary::BinaryType<T>::GetTypeName(dst);
+                }
+            };
+
+            /**
+             * Declares ComputeApplyTypeName specialization for the type
+             * without BinaryType.
+             */
+#define IGNITE_COMPUTE_APPLY_TYPE_NAME(T)                                   \
+            template<>                                                      \
+            struct ComputeApplyTypeName<T>                                  \
+            {                                                               \
+                static void Get(std::string& dst)                           \
+                {                                                           \
+                    dst = #T;                                               \
+                }                                                           \
+            };
+
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(int8_t)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(bool)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(int16_t)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(uint16_t)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(int32_t)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(int64_t)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(float)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(double)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(std::string)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(Guid)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(Date)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(Timestamp)
+            IGNITE_COMPUTE_APPLY_TYPE_NAME(Time)
+
+#undef IGNITE_COMPUTE_APPLY_TYPE_NAME
+
+            /**
+             * Result of the apply job. Holds results for the contiguous part
+             * of the arguments along with its offset.
+             *
+             * @tparam R Function result type.
+             */
+            template<typename R>
+            struct ComputeApplyResult
+            {
+                /**
+                 * Default constructor.
+                 */
+                ComputeApplyResult() :
+                    offset(0),
+                    values()
+                {
+                    // No-op.
+                }
+
+                /** Offset of the first argument. */
+                int32_t offset;
+
+                /** Function results. */
+                std::vector<R> values;
+            };
+
+            /**
+             * Job which applies function to the part of the arguments.
+             *
+             * @tparam F Function type. Should implement R Apply(const A&).
+             * @tparam R Function result type.
+             * @tparam A Function argument type.
+             */
+            template<typename F, typename R, typename A>
+            class ComputeApplyJob : public ignite::compute::ComputeFunc< ComputeApplyResult<R> >
+            {
+            public:
+                /**
+                 * Default constructor.
+                 */
+                ComputeApplyJob() :
+                    func(),
+                    offset(0),
+                    args()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Constructor.
+                 *
+                 * @param func Function.
+                 * @param offset Offset of the first argument.
+                 * @param args Arguments.
+                 */
+                ComputeApplyJob(const F& func, int32_t offset, const std::vector<A>& args) :
+                    func(func),
+                    offset(offset),
+                    args(args)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~ComputeApplyJob()
+                {
+                    // No-op.
+                }
+
+                virtual ComputeApplyResult<R> Call()
+                {
+                    ComputeApplyResult<R> res;
+
+                    res.offset = offset;
+                    res.values.reserve(args.size());
+
+                    for (typename std::vector<A>::const_iterator it = args.begin(); it != args.end(); ++it)
+                        res.values.push_back(func.Apply(*it));
+
+                    return res;
+                }
+
+                /**
+                 * Get function.
+                 *
+                 * @return Function.
+                 */
+                const F& GetFunc() const
+                {
+                    return func;
+                }
+
+                /**
+                 * Get offset of the first argument.
+                 *
+                 * @return Offset.
+                 */
+                int32_t GetOffset() const
+                {
+                    return offset;
+                }
+
+                /**
+                 * Get arguments.
+                 *
+                 * @return Arguments.
+                 */
+                const std::vector<A>& GetArgs() const
+                {
+                    return args;
+                }
+
+            private:
+                /** Function. */
+                F func;
+
+                /** Offset of the first argument. */
+                int32_t offset;
+
+                /** Arguments. */
+                std::vector<A> args;
+            };
+
+            /**
+             * Task which splits the arguments between the nodes and applies
+             * the function to every argument.
+             *
+             * @tparam F Function type. Should implement R Apply(const A&).
+             * @tparam R Function result type.
+             * @tparam A Function argument type.
+             */
+            template<typename F, typename R, typename A>
+            class ComputeApplyTask :
+                public ignite::compute::ComputeTask<ComputeApplyJob<F, R, A>, ComputeApplyResult<R>, std::vector<R> >
+            {
+            public:
+                typedef ComputeApplyJob<F, R, A> Job;
+                typedef ignite::compute::ComputeTask<Job, ComputeApplyResult<R>, std::vector<R> > Base;
+
+                /**
+                 * Constructor.
+                 *
+                 * @param func Function.
+                 * @param args Arguments.
+                 */
+                ComputeApplyTask(const F& func, const std::vector<A>& args) :
+                    func(func),
+                    args(args),
+                    res()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~ComputeApplyTask()
+                {
+                    // No-op.
+                }
+
+                virtual void Map(const std::vector<ignite::cluster::ClusterNode>& subgrid,
+                    typename Base::JobMapping& jobs)
+                {
+                    if (subgrid.empty())
+                        throw IgniteError(IgniteError::IGNITE_ERR_GENERIC, "No nodes to map the arguments to.");
+
+                    size_t jobCnt = std::min(subgrid.size(), args.size());
+
+                    size_t chunk = args.size() / jobCnt;
+                    size_t rem = args.size() % jobCnt;
+
+                    typename std::vector<A>::const_iterator it = args.begin();
+
+                    jobs.reserve(jobCnt);
+
+                    for (size_t i = 0; i < jobCnt; ++i)
+                    {
+                        int32_t offset = static_cast<int32_t>(it - args.begin());
+                        size_t size = chunk + (i < rem ? 1 : 0);
+
+                        std::vector<A> jobArgs(it, it + size);
+
+                        it += size;
+
+                        jobs.push_back(std::make_pair(Job(func, offset, jobArgs), subgrid[i]));
+                    }
+
+                    res.resize(args.size());
+                }
+
+                virtual ignite::compute::ComputeJobResultPolicy::Type OnResult(const ComputeApplyResult<R>& jobRes)
+                {
+                    std::copy(jobRes.values.begin(), jobRes.values.end(), res.begin() + jobRes.offset);
+
+                    return ignite::compute::ComputeJobResultPolicy::WAIT;
+                }
+
+                virtual std::vector<R> Reduce()
+                {
+                    return res;
+                }
+
+            private:
+                /** Function. */
+                F func;
+
+                /** Arguments. */
+                std::vector<A> args;
+
+                /** Results in the order of the arguments. */
+                std::vector<R> res;
+            };
+        }
+    }
+
+    namespace binary
+    {
+        /**
+         * Binary type specialization for ComputeApplyResult.
+         */
+        template<typename R>
+        struct BinaryType<impl::compute::ComputeApplyResult<R> > :
+            BinaryTypeNonNullableType< impl::compute::ComputeApplyResult<R> >
+        {
+            typedef impl::compute::ComputeApplyResult<R> UnderlyingType;
+
+            IGNITE_BINARY_GET_FIELD_ID_AS_HASH
+
+            static int32_t GetTypeId()
+            {
+                return GetBinaryStringHashCode("ComputeApplyResult");
+            }
+
+            static void GetTypeName(std::string& dst)
+            {
+                dst = "ComputeApplyResult";
+            }
+
+            static void Write(BinaryWriter& writer, const UnderlyingType& obj)
+            {
+                BinaryRawWriter raw = writer.RawWriter();
+
+                raw.WriteInt32(obj.offset);
+                raw.WriteCollection(obj.values.begin(), obj.values.end());
+            }
+
+            static void Read(BinaryReader& reader, UnderlyingType& dst)
+            {
+                BinaryRawReader raw = reader.RawReader();
+
+                dst.offset = raw.ReadInt32();
+
+                dst.values.clear();
+                raw.ReadCollection<R>(std::back_inserter(dst.values));
+            }
+        };
+
+        /**
+         * Binary type specialization for ComputeApplyJob.
+         */
+        template<typename F, typename R, typename A>
+        struct BinaryType<impl::compute::ComputeApplyJob<F, R, A> > :
+            BinaryTypeNonNullableType< impl::compute::ComputeApplyJob<F, R, A> >
+        {
+            typedef impl::compute::ComputeApplyJob<F, R, A> UnderlyingType;
+
+            IGNITE_BINARY_GET_FIELD_ID_AS_HASH
+
+            static int32_t GetTypeId()
+            {
+                static bool typeIdInited = false;
+                static int32_t typeId;
+                static common::concurrent::CriticalSection initLock;
+
+                if (typeIdInited)
+                    return typeId;
+
+                common::concurrent::CsLockGuard guard(initLock);
+
+                if (typeIdInited)
+                    return typeId;
+
+                std::string typeName;
+                GetTypeName(typeName);
+
+                typeId = GetBinaryStringHashCode(typeName.c_str());
+                typeIdInited = true;
+
+                return typeId;
+            }
+
+            static void GetTypeName(std::string& dst)
+            {
+                std::string funcName;
+                std::string resName;
+                std::string argName;
+
+                BinaryType<F>::GetTypeName(funcName);
+                impl::compute::ComputeApplyTypeName<R>::Get(resName);
+                impl::compute::ComputeApplyTypeName<A>::Get(argName);
+
+                dst.reserve(sizeof("ComputeApplyJob<, , >") - 1 + funcName.size() + resName.size() + argName.size());
+
+                dst.assign("ComputeApplyJob<").append(funcName).append(", ").append(resName)
+                    .append(", ").append(argName).push_back('>');
+            }
+
+            static void Write(BinaryWriter& writer, const UnderlyingType& obj)
+            {
+                BinaryRawWriter raw = writer.RawWriter();
+
+                raw.WriteObject(obj.GetFunc());
+                raw.WriteInt32(obj.GetOffset());
+                raw.WriteCollection(obj.GetArgs().begin(), obj.GetArgs().end());
+            }
+
+            static void Read(BinaryReader& reader, UnderlyingType& dst)
+            {
+                BinaryRawReader raw = reader.RawReader();
+
+                F func = raw.ReadObject<F>();
+                int32_t offset = raw.ReadInt32();
+
+                std::vector<A> args;
+                raw.ReadCollection<A>(std::back_inserter(args));
+
+                dst = UnderlyingType(func, offset, args);
+            }
+        };
+    }
+}
+
+#endif //_IGNITE_IMPL_COMPUTE_COMPUTE_APPLY_TASK
@@ -33,6 +33,8 @@
 #include <ignite/impl/compute/java_compute_task_holder.h>
 #include <ignite/impl/compute/single_job_compute_task_holder.h>
 #include <ignite/impl/compute/multiple_job_compute_task_holder.h>
+#include <ignite/impl/compute/native_compute_task_holder.h>
+#include <ignite/impl/compute/compute_apply_task.h>
 #include <ignite/impl/compute/cancelable_impl.h>
 
 namespace ignite
@@ -62,6 +64,8 @@ namespace ignite
 
                         UNICAST = 5,
 
+                        EXEC_NATIVE = 8,
+
                         AFFINITY_CALL = 13,
 
                         AFFINITY_RUN = 14
@@ -208,6 +212,83 @@ namespace ignite
                     return PerformTask<void, F, JobType, TaskType>(Operation::BROADCAST, func);
                 }
 
+                /**
+                 * Asynchronously executes given compute task within the
+                 * underlying cluster group.
+                 *
+                 * @tparam T Task type. Should implement ComputeTask class.
+                 * @param task Task to execute. Task is copied, so the
+                 *  execution does not affect the passed instance.
+                 * @return Future that can be used to access task result
+                 *  once it's ready.
+                 */
+                template<typename T>
+                Future<typename T::ResultType> ExecuteAsync(const T& task)
+                {
+                    typedef NativeComputeTaskHolderImpl<T> TaskHolder;
+
+                    TaskHolder* taskPtr = new TaskHolder(task);
+                    common::concurrent::SharedPointer<ComputeTaskHolder> taskHolder(taskPtr);
+
+                    int64_t taskHandle = GetEnvironment().GetHandleRegistry().Allocate(taskHolder);
+
+                    common::concurrent::SharedPointer<interop::InteropMemory> mem = GetEnvironment().AllocateMemory();
+                    interop::InteropOutputStream out(mem.Get());
+                    binary::BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                    writer.WriteInt64(taskHandle);
+
+                    // Zero topology version makes Java side always pass the subgrid to the map.
+                    writer.WriteInt64(0);
+
+                    out.Synchronize();
+
+                    IgniteError err;
+                    jobject target = InStreamOutObject(Operation::EXEC_NATIVE, *mem.Get(), err);
+
+                    if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                    {
+                        GetEnvironment().GetHandleRegistry().Release(taskHandle);
+
+                        throw err;
+                    }
+
+                    std::auto_ptr<common::Cancelable> cancelable(new CancelableImpl(GetEnvironmentPointer(), target));
+
+                    common::Promise<typename T::ResultType>& promise = taskPtr->GetPromise();
+                    promise.SetCancelTarget(cancelable);
+
+                    return promise.GetFuture();
+                }
+
+                /**
+                 * Asynchronously applies provided function to every argument
+                 * splitting the arguments between the nodes of the underlying
+                 * cluster group.
+                 *
+                 * @tparam R Function result type.
+                 * @tparam F Function type.
+                 * @tparam A Function argument type.
+                 * @param func Function to apply.
+                 * @param args Arguments.
+                 * @return Future that can be used to access results once
+                 *  they are ready.
+                 */
+                template<typename R, typename F, typename A>
+                Future< std::vector<R> > ApplyAsync(const F& func, const std::vector<A>& args)
+                {
+                    if (args.empty())
+                    {
+                        common::Promise< std::vector<R> > promise;
+
+                        promise.SetValue(std::auto_ptr< std::vector<R> >(new std::vector<R>()));
+
+                        return promise.GetFuture();
+                    }
+
+                    return ExecuteAsync(ComputeApplyTask<F, R, A>(func, args));
+                }
+
                 /**
                  * Executes given Java task on the grid projection. If task for given name has not been deployed yet,
                  * then 'taskName' will be used as task class name to auto-deploy the task.
@@ -107,6 +107,19 @@ namespace ignite
                  */
                 virtual void Reduce() = 0;
 
+                /**
+                 * Process task completion. Called once the task is done
+                 * whether it has succeeded or not.
+                 *
+                 * @param env Environment.
+                 * @param err Task error. Has IGNITE_SUCCESS code if the task
+                 *    has completed successfully.
+                 */
+                virtual void Complete(IgniteEnvironment&, const IgniteError&)
+                {
+                    // No-op.
+                }
+
                 /**
                  * Get related job handle.
                  *
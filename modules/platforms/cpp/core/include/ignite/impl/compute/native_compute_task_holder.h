@@ -0,0 +1,336 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::impl::compute::NativeComputeTaskHolder class and
+ * ignite::impl::compute::NativeComputeTaskHolderImpl class template.
+ */
+
+#ifndef _IGNITE_IMPL_COMPUTE_NATIVE_COMPUTE_TASK_HOLDER
+#define _IGNITE_IMPL_COMPUTE_NATIVE_COMPUTE_TASK_HOLDER
+
+#include <stdint.h>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/common/promise.h>
+#include <ignite/cluster/cluster_node.h>
+#include <ignite/compute/compute_task.h>
+
+#include <ignite/impl/compute/compute_job_holder.h>
+#include <ignite/impl/compute/compute_job_result.h>
+#include <ignite/impl/compute/compute_task_holder.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace compute
+        {
+            /**
+             * Holder for the task which is split into jobs on the native
+             * side. Internal helper class. Used to map the task in general
+             * way, without specific types.
+             */
+            class NativeComputeTaskHolder : public ComputeTaskHolder
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                NativeComputeTaskHolder() :
+                    ComputeTaskHolder(-1)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~NativeComputeTaskHolder()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Map task to the nodes and write the jobs.
+                 *
+                 * @param env Environment.
+                 * @param subgrid Nodes available for the task execution.
+                 * @param writer Writer for the map result.
+                 */
+                virtual void Map(IgniteEnvironment& env, const std::vector<ignite::cluster::ClusterNode>& subgrid,
+                    binary::BinaryWriterImpl& writer) = 0;
+            };
+
+            /**
+             * Native compute task holder type-specific implementation.
+             *
+             * @tparam T Task type. Should implement ComputeTask class.
+             */
+            template<typename T>
+            class NativeComputeTaskHolderImpl : public NativeComputeTaskHolder
+            {
+            public:
+                typedef T TaskType;
+                typedef typename T::JobType JobType;
+                typedef typename T::JobResultType JobResultType;
+                typedef typename T::ResultType ResultType;
+
+                /**
+                 * Constructor.
+                 *
+                 * @param task Task.
+                 */
+                NativeComputeTaskHolderImpl(const TaskType& task) :
+                    task(task),
+                    jobHandles(),
+                    error(),
+                    done(false),
+                    promise()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~NativeComputeTaskHolderImpl()
+                {
+                    // No-op.
+                }
+
+                virtual void Map(IgniteEnvironment& env, const std::vector<ignite::cluster::ClusterNode>& subgrid,
+                    binary::BinaryWriterImpl& writer)
+                {
+                    typedef typename TaskType::JobMapping JobMapping;
+                    typedef ComputeJobHolderImpl<JobType, JobResultType> JobHolder;
+
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    JobMapping jobs;
+
+                    try
+                    {
+                        task.Map(subgrid, jobs);
+                    }
+                    catch (const IgniteError& err)
+                    {
+                        error = err;
+
+                        throw;
+                    }
+
+                    // Map succeeded, result is not null.
+                    writer.WriteBool(true);
+                    writer.WriteBool(true);
+
+                    writer.WriteInt32(static_cast<int32_t>(jobs.size()));
+
+                    for (typename JobMapping::const_iterator it = jobs.begin(); it != jobs.end(); ++it)
+                    {
+                        common::concurrent::SharedPointer<ComputeJobHolder> job(new JobHolder(it->first));
+
+                        int64_t jobHandle = env.GetHandleRegistry().Allocate(job);
+
+                        jobHandles.push_back(jobHandle);
+
+                        writer.WriteInt64(jobHandle);
+
+                        // Job is always serialized so the Java side does not
+                        // need to request it if the job is sent to the remote node.
+                        writer.WriteBool(true);
+                        writer.WriteObject<JobType>(it->first);
+
+                        writer.WriteGuid(it->second.GetId());
+                    }
+                }
+
+                virtual int32_t JobResultLocal(ComputeJobHolder& job)
+                {
+                    typedef ComputeJobHolderImpl<JobType, JobResultType> JobHolder;
+
+                    JobHolder& job0 = static_cast<JobHolder&>(job);
+
+                    return ProcessResult(job0.GetResult());
+                }
+
+                virtual int32_t JobResultRemote(binary::BinaryReaderImpl& reader)
+                {
+                    ComputeJobResult<JobResultType> res;
+
+                    res.Read(reader);
+
+                    return ProcessResult(res);
+                }
+
+                virtual void JobResultError(const IgniteError&)
+                {
+                    // No-op. Job results are delivered with JobResultLocal and JobResultRemote.
+                }
+
+                virtual void JobResultSuccess(int64_t)
+                {
+                    // No-op. Job results are delivered with JobResultLocal and JobResultRemote.
+                }
+
+                virtual void JobResultSuccess(binary::BinaryReaderImpl&)
+                {
+                    // No-op. Job results are delivered with JobResultLocal and JobResultRemote.
+                }
+
+                virtual void JobNullResultSuccess()
+                {
+                    // No-op. Job results are delivered with JobResultLocal and JobResultRemote.
+                }
+
+                virtual void Reduce()
+                {
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    if (done)
+                        return;
+
+                    done = true;
+
+                    if (error.GetCode() != IgniteError::IGNITE_SUCCESS)
+                    {
+                        promise.SetError(error);
+
+                        return;
+                    }
+
+                    try
+                    {
+                        promise.SetValue(std::auto_ptr<ResultType>(new ResultType(task.Reduce())));
+                    }
+                    catch (const IgniteError& err)
+                    {
+                        promise.SetError(err);
+                    }
+                    catch (const std::exception& err)
+                    {
+                        promise.SetError(IgniteError(IgniteError::IGNITE_ERR_STD, err.what()));
+                    }
+                    catch (...)
+                    {
+                        promise.SetError(IgniteError(IgniteError::IGNITE_ERR_UNKNOWN,
+                            "Unknown error occurred during reduce."));
+                    }
+                }
+
+                virtual void Complete(IgniteEnvironment& env, const IgniteError& err)
+                {
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    for (std::vector<int64_t>::iterator it = jobHandles.begin(); it != jobHandles.end(); ++it)
+                        env.GetHandleRegistry().Release(*it);
+
+                    jobHandles.clear();
+
+                    if (done)
+                        return;
+
+                    done = true;
+
+                    // Prefer the native error which has caused the failure if there is one.
+                    if (error.GetCode() != IgniteError::IGNITE_SUCCESS)
+                        promise.SetError(error);
+                    else if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                        promise.SetError(err);
+                    else
+                    {
+                        promise.SetError(IgniteError(IgniteError::IGNITE_ERR_GENERIC,
+                            "Task has been completed without reduce."));
+                    }
+                }
+
+                /**
+                 * Get result promise.
+                 *
+                 * @return Reference to result promise.
+                 */
+                common::Promise<ResultType>& GetPromise()
+                {
+                    return promise;
+                }
+
+            private:
+                /**
+                 * Pass the job result to the task.
+                 *
+                 * @param res Job result.
+                 * @return Policy.
+                 */
+                int32_t ProcessResult(const ComputeJobResult<JobResultType>& res)
+                {
+                    common::concurrent::CsLockGuard guard(mux);
+
+                    // Results which arrive after the failure are ignored.
+                    if (error.GetCode() != IgniteError::IGNITE_SUCCESS)
+                        return ComputeJobResultPolicy::REDUCE;
+
+                    try
+                    {
+                        const IgniteError& jobErr = res.GetError();
+
+                        if (jobErr.GetCode() == IgniteError::IGNITE_SUCCESS)
+                            return task.OnResult(res.GetResult());
+
+                        return task.OnError(jobErr);
+                    }
+                    catch (const IgniteError& err)
+                    {
+                        error = err;
+                    }
+                    catch (const std::exception& err)
+                    {
+                        error = IgniteError(IgniteError::IGNITE_ERR_STD, err.what());
+                    }
+                    catch (...)
+                    {
+                        error = IgniteError(IgniteError::IGNITE_ERR_UNKNOWN,
+                            "Unknown error occurred during job result processing.");
+                    }
+
+                    return ComputeJobResultPolicy::REDUCE;
+                }
+
+                /** Task. */
+                TaskType task;
+
+                /** Handles of the jobs produced by the map. */
+                std::vector<int64_t> jobHandles;
+
+                /** Error which has failed the task. */
+                IgniteError error;
+
+                /** Flag indicating that the promise is set. */
+                bool done;
+
+                /** Mutex. */
+                common::concurrent::CriticalSection mux;
+
+                /** Task result promise. */
+                common::Promise<ResultType> promise;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_COMPUTE_NATIVE_COMPUTE_TASK_HOLDER
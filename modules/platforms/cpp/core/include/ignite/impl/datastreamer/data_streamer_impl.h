@@ -0,0 +1,459 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_DATASTREAMER_DATA_STREAMER_IMPL
+#define _IGNITE_IMPL_DATASTREAMER_DATA_STREAMER_IMPL
+
+#include <string>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/future.h>
+
+#include <ignite/impl/interop/interop_target.h>
+#include <ignite/impl/datastreamer/stream_receiver_holder.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace datastreamer
+        {
+            /**
+             * Data streamer topology. Updated by the topology listener
+             * registered on the Java side.
+             */
+            class DataStreamerTopology
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                DataStreamerTopology() :
+                    lock(),
+                    topVer(0),
+                    topSize(1)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Update topology.
+                 *
+                 * @param topVer Topology version.
+                 * @param topSize Number of data nodes in topology.
+                 */
+                void Update(int64_t topVer, int32_t topSize)
+                {
+                    common::concurrent::CsLockGuard guard(lock);
+
+                    if (topVer < this->topVer)
+                        return;
+
+                    this->topVer = topVer;
+                    this->topSize = topSize > 0 ? topSize : 1;
+                }
+
+                /**
+                 * Get number of data nodes in topology.
+                 *
+                 * @return Number of data nodes. Never less than one.
+                 */
+                int32_t GetSize()
+                {
+                    common::concurrent::CsLockGuard guard(lock);
+
+                    return topSize;
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(DataStreamerTopology);
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Topology version. */
+                int64_t topVer;
+
+                /** Number of data nodes. */
+                int32_t topSize;
+            };
+
+            /**
+             * Data streamer implementation.
+             *
+             * Entries are serialized into the native batch buffer and sent to the
+             * Java streamer by a single call once the buffer holds enough entries
+             * for every data node. Completion of each batch is tracked by a future.
+             */
+            class IGNITE_FRIEND_EXPORT DataStreamerImpl : private interop::InteropTarget
+            {
+                typedef common::concurrent::SharedPointer<IgniteEnvironment> SP_IgniteEnvironment;
+                typedef common::concurrent::SharedPointer<DataStreamerTopology> SP_DataStreamerTopology;
+            public:
+                /**
+                 * Constructor used to create new instance.
+                 *
+                 * @param env Environment.
+                 * @param javaRef Reference to java object.
+                 * @param cacheName Cache name.
+                 */
+                DataStreamerImpl(SP_IgniteEnvironment env, jobject javaRef, const std::string& cacheName);
+
+                /**
+                 * Destructor.
+                 * Closes streamer if it was not closed explicitly.
+                 */
+                ~DataStreamerImpl();
+
+                /**
+                 * Get cache name.
+                 *
+                 * @return Cache name.
+                 */
+                const std::string& GetCacheName() const
+                {
+                    return cacheName;
+                }
+
+                /**
+                 * Add entry to the streamer.
+                 *
+                 * @param key Key.
+                 * @param val Value.
+                 */
+                template<typename K, typename V>
+                void AddData(const K& key, const V& val)
+                {
+                    common::concurrent::CsLockGuard guard(lock);
+
+                    interop::InteropOutputStream out(batchMem.Get());
+                    binary::BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                    StartEntry(out);
+
+                    writer.WriteTopObject(key);
+                    writer.WriteTopObject(val);
+
+                    FinishEntry(out);
+                }
+
+                /**
+                 * Add removal of the entry to the streamer.
+                 *
+                 * @param key Key.
+                 */
+                template<typename K>
+                void RemoveData(const K& key)
+                {
+                    common::concurrent::CsLockGuard guard(lock);
+
+                    interop::InteropOutputStream out(batchMem.Get());
+                    binary::BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                    StartEntry(out);
+
+                    writer.WriteTopObject(key);
+                    writer.WriteNull();
+
+                    FinishEntry(out);
+                }
+
+                /**
+                 * Set stream receiver.
+                 *
+                 * @param receiver Receiver.
+                 */
+                template<typename R>
+                void SetReceiver(const R& receiver)
+                {
+                    StreamReceiverHolder<R> holder(receiver, cacheName);
+
+                    int32_t metaVer = GetEnvironment().GetTypeManager()->GetVersion();
+
+                    common::concurrent::SharedPointer<interop::InteropMemory> mem = GetEnvironment().AllocateMemory();
+                    interop::InteropOutputStream out(mem.Get());
+                    binary::BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                    // Native pointer is not used as receiver is resolved by type on every node.
+                    writer.WriteInt64(0);
+                    writer.WriteTopObject(holder);
+
+                    out.Synchronize();
+
+                    IgniteError err;
+
+                    ProcessMetaUpdates(metaVer, err);
+
+                    if (err.GetCode() == IgniteError::IGNITE_SUCCESS)
+                        OutOp(Operation::RECEIVER, *mem.Get(), err);
+
+                    IgniteError::ThrowIfNeeded(err);
+                }
+
+                /**
+                 * Send buffered entries and wait until all the entries added
+                 * before this call are processed.
+                 */
+                void Flush();
+
+                /**
+                 * Send buffered entries without waiting for them to be processed.
+                 */
+                void TryFlush();
+
+                /**
+                 * Close streamer.
+                 *
+                 * @param cancel Cancel flag. If @c true, buffered entries are
+                 *    discarded, otherwise they are flushed.
+                 */
+                void Close(bool cancel);
+
+                /**
+                 * Get allow overwrite flag.
+                 *
+                 * @return Allow overwrite flag.
+                 */
+                bool IsAllowOverwrite();
+
+                /**
+                 * Set allow overwrite flag.
+                 *
+                 * @param allowOverwrite Allow overwrite flag.
+                 */
+                void SetAllowOverwrite(bool allowOverwrite);
+
+                /**
+                 * Get skip store flag.
+                 *
+                 * @return Skip store flag.
+                 */
+                bool IsSkipStore();
+
+                /**
+                 * Set skip store flag.
+                 *
+                 * @param skipStore Skip store flag.
+                 */
+                void SetSkipStore(bool skipStore);
+
+                /**
+                 * Get size of per node key-value pairs buffer.
+                 *
+                 * @return Per node buffer size.
+                 */
+                int32_t GetPerNodeBufferSize();
+
+                /**
+                 * Set size of per node key-value pairs buffer.
+                 *
+                 * @param size Per node buffer size.
+                 */
+                void SetPerNodeBufferSize(int32_t size);
+
+                /**
+                 * Get maximum number of parallel stream operations for a single node.
+                 *
+                 * @return Maximum number of parallel stream operations.
+                 */
+                int32_t GetPerNodeParallelOperations();
+
+                /**
+                 * Set maximum number of parallel stream operations for a single node.
+                 *
+                 * @param parallelOps Maximum number of parallel stream operations.
+                 */
+                void SetPerNodeParallelOperations(int32_t parallelOps);
+
+                /**
+                 * Get timeout of streamer operations.
+                 *
+                 * @return Timeout in milliseconds.
+                 */
+                int64_t GetTimeout();
+
+                /**
+                 * Set timeout of streamer operations.
+                 *
+                 * @param timeout Timeout in milliseconds.
+                 */
+                void SetTimeout(int64_t timeout);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(DataStreamerImpl);
+
+                /**
+                 * Operation type.
+                 */
+                struct Operation
+                {
+                    enum Type
+                    {
+                        UPDATE = 1,
+
+                        RECEIVER = 2,
+
+                        ALLOW_OVERWRITE = 3,
+
+                        SET_ALLOW_OVERWRITE = 4,
+
+                        SKIP_STORE = 5,
+
+                        SET_SKIP_STORE = 6,
+
+                        PER_NODE_BUFFER_SIZE = 7,
+
+                        SET_PER_NODE_BUFFER_SIZE = 8,
+
+                        PER_NODE_PARALLEL_OPS = 9,
+
+                        SET_PER_NODE_PARALLEL_OPS = 10,
+
+                        LISTEN_TOPOLOGY = 11,
+
+                        GET_TIMEOUT = 12,
+
+                        SET_TIMEOUT = 13
+                    };
+                };
+
+                /**
+                 * Update policy.
+                 */
+                struct Policy
+                {
+                    enum Type
+                    {
+                        /** Keep entries buffered on the Java side. */
+                        CONTINUE = 0,
+
+                        /** Flush entries and close streamer. */
+                        CLOSE = 1,
+
+                        /** Discard entries and close streamer. */
+                        CANCEL_CLOSE = 2,
+
+                        /** Initiate flush of the entries. */
+                        FLUSH = 3
+                    };
+                };
+
+                /**
+                 * Prepare batch buffer for the new entry.
+                 * Should be called with the lock held.
+                 *
+                 * @param out Output stream over the batch buffer.
+                 */
+                void StartEntry(interop::InteropOutputStream& out);
+
+                /**
+                 * Account written entry and send the batch if it is full.
+                 * Should be called with the lock held.
+                 *
+                 * @param out Output stream over the batch buffer.
+                 */
+                void FinishEntry(interop::InteropOutputStream& out);
+
+                /**
+                 * Send buffered entries.
+                 * Should be called with the lock held.
+                 *
+                 * @param plc Policy.
+                 */
+                void SendBatch(Policy::Type plc);
+
+                /**
+                 * Send binary metadata updates made since the specified version.
+                 *
+                 * @param metaVer Binary metadata version.
+                 * @param err Error.
+                 */
+                void ProcessMetaUpdates(int32_t metaVer, IgniteError& err);
+
+                /**
+                 * Wait for the batches.
+                 *
+                 * @param futs Batch futures.
+                 */
+                static void WaitAll(const std::vector< Future<void> >& futs);
+
+                /**
+                 * Get boolean property.
+                 *
+                 * @param op Operation.
+                 * @return Property value.
+                 */
+                bool GetBoolProperty(Operation::Type op);
+
+                /**
+                 * Get long property.
+                 *
+                 * @param op Operation.
+                 * @return Property value.
+                 */
+                int64_t GetLongProperty(Operation::Type op);
+
+                /**
+                 * Set property.
+                 *
+                 * @param op Operation.
+                 * @param val Property value.
+                 */
+                void SetProperty(Operation::Type op, int64_t val);
+
+                /** Cache name. */
+                std::string cacheName;
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Topology. */
+                SP_DataStreamerTopology topology;
+
+                /** Topology handle. */
+                int64_t topologyHandle;
+
+                /** Batch buffer. */
+                common::concurrent::SharedPointer<interop::InteropMemory> batchMem;
+
+                /** Position of the end of the last entry in the batch buffer. */
+                int32_t batchPos;
+
+                /** Number of entries in the batch buffer. */
+                int32_t batchSize;
+
+                /** Binary metadata version at the moment the batch was started. */
+                int32_t batchMetaVer;
+
+                /** Per node buffer size. */
+                int32_t perNodeBufferSize;
+
+                /** Futures of the sent batches. */
+                std::vector< Future<void> > batchFuts;
+
+                /** Closed flag. */
+                bool closed;
+            };
+
+            /* Shared pointer. */
+            typedef common::concurrent::SharedPointer<DataStreamerImpl> SP_DataStreamerImpl;
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_DATASTREAMER_DATA_STREAMER_IMPL
@@ -0,0 +1,196 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_DATASTREAMER_STREAM_RECEIVER_HOLDER
+#define _IGNITE_IMPL_DATASTREAMER_STREAM_RECEIVER_HOLDER
+
+#include <string>
+
+#include <ignite/common/common.h>
+#include <ignite/binary/binary.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace datastreamer
+        {
+            /**
+             * Holder for the Stream Receiver and the name of the cache it is
+             * set for. Used as a convenient way to transmit Stream Receiver
+             * between nodes.
+             */
+            template<typename R>
+            class StreamReceiverHolder
+            {
+            public:
+                typedef R ReceiverType;
+
+                /**
+                 * Default constructor.
+                 */
+                StreamReceiverHolder() :
+                    receiver(),
+                    cacheName()
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Constructor.
+                 *
+                 * @param receiver Receiver.
+                 * @param cacheName Cache name.
+                 */
+                StreamReceiverHolder(const R& receiver, const std::string& cacheName) :
+                    receiver(receiver),
+                    cacheName(cacheName)
+                {
+                    // No-op.
+                }
+
+                /**
+                 * Get receiver.
+                 *
+                 * @return Receiver.
+                 */
+                ReceiverType& GetReceiver()
+                {
+                    return receiver;
+                }
+
+                /**
+                 * Get receiver.
+                 *
+                 * @return Receiver.
+                 */
+                const ReceiverType& GetReceiver() const
+                {
+                    return receiver;
+                }
+
+                /**
+                 * Get cache name.
+                 *
+                 * @return Cache name.
+                 */
+                const std::string& GetCacheName() const
+                {
+                    return cacheName;
+                }
+
+            private:
+                /** Stored receiver. */
+                ReceiverType receiver;
+
+                /** Cache name. */
+                std::string cacheName;
+            };
+        }
+    }
+
+    namespace binary
+    {
+        /**
+         * Binary type specialization for StreamReceiverHolder.
+         */
+        template<typename R>
+        struct BinaryType<impl::datastreamer::StreamReceiverHolder<R> > :
+            BinaryTypeNonNullableType< impl::datastreamer::StreamReceiverHolder<R> >
+        {
+            typedef impl::datastreamer::StreamReceiverHolder<R> UnderlyingType;
+
+            IGNITE_BINARY_GET_FIELD_ID_AS_HASH
+
+            static int32_t GetTypeId()
+            {
+                static bool typeIdInited = false;
+                static int32_t typeId;
+                static common::concurrent::CriticalSection initLock;
+
+                if (typeIdInited)
+                    return typeId;
+
+                common::concurrent::CsLockGuard guard(initLock);
+
+                if (typeIdInited)
+                    return typeId;
+
+                std::string typeName;
+                GetTypeName(typeName);
+
+                typeId = GetBinaryStringHashCode(typeName.c_str());
+                typeIdInited = true;
+
+                return typeId;
+            }
+
+            static void GetTypeName(std::string& dst)
+            {
+                static std::string name;
+                static common::concurrent::CriticalSection initLock;
+
+                if (!name.empty())
+                {
+                    dst = name;
+
+                    return;
+                }
+
+                common::concurrent::CsLockGuard guard(initLock);
+
+                if (!name.empty())
+                {
+                    dst = name;
+
+                    return;
+                }
+
+                std::string receiverName;
+
+                BinaryType<R>::GetTypeName(receiverName);
+
+                // -1 is for unnessecary null byte at the end of the C-string.
+                name.reserve(sizeof("StreamReceiverHolder<>") - 1 + receiverName.size());
+
+                name.append("StreamReceiverHolder<").append(receiverName).push_back('>');
+
+                dst = name;
+            }
+
+            static void Write(BinaryWriter& writer, const UnderlyingType& obj)
+            {
+                BinaryRawWriter raw = writer.RawWriter();
+
+                raw.WriteObject(obj.GetReceiver());
+                raw.WriteString(obj.GetCacheName());
+            }
+
+            static void Read(BinaryReader& reader, UnderlyingType& dst)
+            {
+                BinaryRawReader raw = reader.RawReader();
+
+                const R& receiver = raw.ReadObject<R>();
+                const std::string& cacheName = raw.ReadString();
+
+                dst = UnderlyingType(receiver, cacheName);
+            }
+        };
+    }
+}
+
+#endif //_IGNITE_IMPL_DATASTREAMER_STREAM_RECEIVER_HOLDER
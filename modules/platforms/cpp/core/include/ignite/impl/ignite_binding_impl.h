@@ -53,7 +53,9 @@ namespace ignite
 
                     CACHE_ENTRY_FILTER_APPLY = 3,
 
-                    COMPUTE_JOB_CREATE = 4
+                    COMPUTE_JOB_CREATE = 4,
+
+                    STREAM_RECEIVER_INVOKE = 5
                 };
             };
 
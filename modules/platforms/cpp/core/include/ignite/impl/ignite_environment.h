@@ -27,6 +27,7 @@
 #include <ignite/impl/interop/interop_memory.h>
 #include <ignite/impl/binary/binary_type_manager.h>
 #include <ignite/impl/handle_registry.h>
+#include <ignite/impl/thread_pool.h>
 
 namespace ignite
 {
@@ -182,6 +183,22 @@ namespace ignite
              */
             void CacheInvokeCallback(common::concurrent::SharedPointer<interop::InteropMemory>& mem);
 
+            /**
+             * Data streamer topology update callback.
+             *
+             * @param handle Data streamer topology handle.
+             * @param topVer Topology version.
+             * @param topSize Number of data nodes.
+             */
+            void OnDataStreamerTopologyUpdate(int64_t handle, int64_t topVer, int32_t topSize);
+
+            /**
+             * Data streamer stream receiver invoke callback.
+             *
+             * @param mem Memory with data.
+             */
+            void OnDataStreamerStreamReceiverInvoke(common::concurrent::SharedPointer<interop::InteropMemory>& mem);
+
             /**
              * Get name of Ignite instance.
              *
@@ -266,6 +283,14 @@ namespace ignite
              */
             HandleRegistry& GetHandleRegistry();
 
+            /**
+             * Wait for the listener events of the continuous query which are
+             * queued to the native thread pool to be processed.
+             *
+             * @param handle Continuous query handle.
+             */
+            void AwaitContinuousQueryListener(int64_t handle);
+
             /**
              * Get binding.
              *
@@ -281,6 +306,14 @@ namespace ignite
              */
             jobject GetProcessorCompute(jobject proj);
 
+            /**
+             * Get processor cache.
+             *
+             * @param name Cache name.
+             * @return Processor cache.
+             */
+            jobject GetProcessorCache(const std::string& name);
+
             /**
              * Locally execute compute job.
              *
@@ -304,12 +337,22 @@ namespace ignite
              */
             void ComputeTaskReduce(int64_t taskHandle);
 
+            /**
+             * Map compute task to the nodes.
+             *
+             * @param mem Memory containing the subgrid. Map result is
+             *    written to the same memory.
+             */
+            void ComputeTaskMap(common::concurrent::SharedPointer<interop::InteropMemory>& mem);
+
             /**
              * Complete compute task.
              *
              * @param taskHandle Task handle.
+             * @param memPtr Pointer to the memory containing task error or
+             *    zero if the task has completed successfully.
              */
-            void ComputeTaskComplete(int64_t taskHandle);
+            void ComputeTaskComplete(int64_t taskHandle, int64_t memPtr);
 
             /**
              * Create compute job.
@@ -396,6 +439,9 @@ namespace ignite
             /** Ignite node. */
             ignite::Ignite* ignite;
 
+            /** Native thread pool for continuous query listeners. Null if listeners are executed by the Java threads. */
+            ThreadPool* threadPool;
+
             IGNITE_NO_COPY_ASSIGNMENT(IgniteEnvironment);
         };
     }
@@ -31,6 +31,7 @@
 #include <ignite/impl/cluster/ignite_cluster_impl.h>
 #include <ignite/impl/cache/cache_affinity_impl.h>
 #include <ignite/impl/compute/compute_impl.h>
+#include <ignite/impl/datastreamer/data_streamer_impl.h>
 #include <ignite/impl/cluster/cluster_group_impl.h>
 
 namespace ignite
@@ -109,6 +110,14 @@ namespace ignite
              */
             cache::CacheImpl* CreateCache(const char* name, IgniteError& err);
 
+            /**
+             * Get data streamer.
+             *
+             * @param cacheName Cache name.
+             * @param err Error.
+             */
+            datastreamer::DataStreamerImpl* GetDataStreamer(const char* cacheName, IgniteError& err);
+
             /**
              * Get ignite binding.
              *
@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_INTEROP_INTEROP_MEMORY_POOL
+#define _IGNITE_IMPL_INTEROP_INTEROP_MEMORY_POOL
+
+#include <stdint.h>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/interop/interop_memory.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace interop
+        {
+            /* Forward declaration. */
+            class InteropMemoryPool;
+
+            /**
+             * Interop pooled memory. Has the same layout as unpooled memory
+             * so it can be reallocated by the Java side, but is returned to
+             * the pool instead of being freed.
+             */
+            class IGNITE_IMPORT_EXPORT InteropPooledMemory : public InteropMemory
+            {
+                friend class InteropMemoryPool;
+            public:
+                virtual void Reallocate(int32_t cap);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(InteropPooledMemory);
+
+                /**
+                 * Chunk state.
+                 */
+                struct State
+                {
+                    enum Type
+                    {
+                        /** Chunk is in the pool. */
+                        FREE = 0,
+
+                        /** Chunk is in use. */
+                        ACQUIRED = 1,
+
+                        /** Pool is destroyed, chunk is freed on release. */
+                        ORPHANED = 2
+                    };
+                };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param cap Capacity.
+                 */
+                explicit InteropPooledMemory(int32_t cap);
+
+                /**
+                 * Destructor.
+                 */
+                ~InteropPooledMemory();
+
+                /**
+                 * Try to take the chunk from the pool.
+                 * Should only be called by the pool owning thread.
+                 *
+                 * @return True on success.
+                 */
+                bool TryAcquire();
+
+                /**
+                 * Return the chunk to the pool. Can be called from any thread.
+                 * Frees the chunk if the pool has already been destroyed.
+                 */
+                void Release();
+
+                /**
+                 * Detach the chunk from the pool. Frees the chunk if it is
+                 * not in use.
+                 */
+                void Orphan();
+
+                /**
+                 * Check if the chunk is in the pool.
+                 *
+                 * @return True if the chunk is free.
+                 */
+                bool IsFree() const
+                {
+                    return state == State::FREE;
+                }
+
+                /** Capacity the chunk is shrunk to on release. */
+                int32_t initCap;
+
+                /** State. */
+                int32_t state;
+            };
+
+            /**
+             * Per-thread pool of the interop memory chunks. Chunks are reused
+             * between interop calls, so steady-state operations do not
+             * allocate buffers.
+             */
+            class IGNITE_IMPORT_EXPORT InteropMemoryPool
+            {
+            public:
+                /** Maximum number of chunks in the pool. */
+                enum { MAX_CHUNKS = 8 };
+
+                /** Chunks larger than this are shrunk before returning to the pool. */
+                enum { MAX_POOLED_CAPACITY = 256 * 1024 };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param initCap Initial capacity of the chunks.
+                 */
+                explicit InteropMemoryPool(int32_t initCap);
+
+                /**
+                 * Destructor.
+                 */
+                ~InteropMemoryPool();
+
+                /**
+                 * Take memory chunk with at least the specified capacity from
+                 * the pool. Returned chunk goes back to the pool once the last
+                 * reference is released.
+                 *
+                 * @param cap Capacity.
+                 * @return Memory or null pointer if all the chunks are in use.
+                 */
+                SP_InteropMemory Allocate(int32_t cap);
+
+                /**
+                 * Take memory chunk from the pool of the current thread.
+                 *
+                 * @param cap Capacity.
+                 * @param initCap Initial capacity of the chunks for a new pool.
+                 * @return Memory or null pointer if all the chunks are in use.
+                 */
+                static SP_InteropMemory AllocateThreadLocal(int32_t cap, int32_t initCap);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(InteropMemoryPool);
+
+                /**
+                 * Deleter passed to the shared pointer.
+                 *
+                 * @param mem Memory.
+                 */
+                static void ReleaseMemory(InteropMemory* mem);
+
+                /** Initial capacity of the chunks. */
+                int32_t initCap;
+
+                /** Chunks. */
+                InteropPooledMemory* chunks[MAX_CHUNKS];
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_IMPL_INTEROP_INTEROP_MEMORY_POOL
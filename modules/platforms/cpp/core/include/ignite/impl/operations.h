@@ -20,11 +20,14 @@
 
 #include <map>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #include <ignite/common/common.h>
 
+#include "ignite/cache/cache_batch.h"
 #include "ignite/cache/cache_entry.h"
+#include "ignite/cache/cache_entry_processor_result.h"
 #include "ignite/impl/binary/binary_reader_impl.h"
 #include "ignite/impl/binary/binary_writer_impl.h"
 #include "ignite/impl/binary/binary_utils.h"
@@ -287,6 +290,44 @@ namespace ignite
             IGNITE_NO_COPY_ASSIGNMENT(InCacheInvokeOperation);
         };
 
+        /**
+         * Cache InvokeAll input operation.
+         */
+        template<typename K, typename T>
+        class InCacheInvokeAllOperation : public InputOperation
+        {
+        public:
+            /**
+             * Constructor.
+             *
+             * @param keys Keys.
+             * @param holder Processor holder.
+             */
+            InCacheInvokeAllOperation(const std::set<K>& keys, const T& holder) : keys(keys), holder(holder)
+            {
+                // No-op.
+            }
+
+            virtual void ProcessInput(ignite::impl::binary::BinaryWriterImpl& writer)
+            {
+                writer.GetStream()->WriteInt32(static_cast<int32_t>(keys.size()));
+
+                for (typename std::set<K>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+                    writer.WriteTopObject<K>(*it);
+
+                writer.WriteInt64(0);
+                writer.WriteTopObject<T>(holder);
+            }
+        private:
+            /** Keys. */
+            const std::set<K>& keys;
+
+            /** Processor holder. */
+            const T& holder;
+
+            IGNITE_NO_COPY_ASSIGNMENT(InCacheInvokeAllOperation);
+        };
+
         /**
          * Input iterator operation.
          */
@@ -542,6 +583,169 @@ namespace ignite
             IGNITE_NO_COPY_ASSIGNMENT(OutMapOperation);
         };
 
+        /**
+         * Read entry processor error written by the Java side.
+         *
+         * @param reader Reader.
+         * @return Error.
+         */
+        inline IgniteError ReadEntryProcessorError(binary::BinaryReaderImpl& reader)
+        {
+            std::stringstream buf;
+
+            buf << reader.ReadObject<std::string>() << " : ";
+            buf << reader.ReadObject<std::string>() << ", ";
+            buf << reader.ReadObject<std::string>();
+
+            bool native = reader.GetStream()->ReadBool();
+
+            if (native)
+                return reader.ReadObject<IgniteError>();
+
+            std::string msg = buf.str();
+
+            return IgniteError(IgniteError::IGNITE_ERR_GENERIC, msg.c_str());
+        }
+
+        /**
+         * Output cache InvokeAll operation.
+         */
+        template<typename K, typename R>
+        class OutCacheInvokeAllOperation : public OutputOperation
+        {
+        public:
+            /** Result type. */
+            typedef std::map<K, ignite::cache::CacheEntryProcessorResult<R> > ResultMap;
+
+            /**
+             * Constructor.
+             *
+             * @param res Results.
+             */
+            OutCacheInvokeAllOperation(ResultMap& res) : res(res)
+            {
+                // No-op.
+            }
+
+            virtual void ProcessOutput(binary::BinaryReaderImpl& reader)
+            {
+                int32_t cnt = reader.GetStream()->ReadInt32();
+
+                ResultMap res0;
+
+                for (int32_t i = 0; i < cnt; i++)
+                {
+                    K key = reader.ReadTopObject<K>();
+
+                    bool failed = reader.GetStream()->ReadBool();
+
+                    if (failed)
+                        res0[key] = ignite::cache::CacheEntryProcessorResult<R>(ReadEntryProcessorError(reader));
+                    else
+                        res0[key] = ignite::cache::CacheEntryProcessorResult<R>(reader.ReadTopObject<R>());
+                }
+
+                std::swap(res, res0);
+            }
+
+            virtual void SetNull()
+            {
+                res.clear();
+            }
+
+        private:
+            /** Results. */
+            ResultMap& res;
+
+            IGNITE_NO_COPY_ASSIGNMENT(OutCacheInvokeAllOperation);
+        };
+
+        /**
+         * Cache batch operation. Writes operations of the batch and reads
+         * results of the executed ones back into the batch.
+         */
+        template<typename K, typename V>
+        class InOutCacheBatchOperation : public InputOperation, public OutputOperation
+        {
+        public:
+            /** Batch type. */
+            typedef ignite::cache::CacheBatch<K, V> Batch;
+
+            /**
+             * Constructor.
+             *
+             * @param batch Batch.
+             */
+            InOutCacheBatchOperation(Batch& batch) :
+                batch(batch),
+                err()
+            {
+                // No-op.
+            }
+
+            virtual void ProcessInput(binary::BinaryWriterImpl& writer)
+            {
+                writer.GetStream()->WriteInt32(batch.GetSize());
+
+                typedef typename std::vector<typename Batch::Entry>::const_iterator Iter;
+
+                for (Iter it = batch.entries.begin(); it != batch.entries.end(); ++it)
+                {
+                    writer.GetStream()->WriteInt32(it->op);
+                    writer.WriteTopObject<K>(it->key);
+
+                    if (it->op == Batch::Operation::PUT || it->op == Batch::Operation::PUT_IF_ABSENT)
+                        writer.WriteTopObject<V>(it->val);
+                }
+            }
+
+            virtual void ProcessOutput(binary::BinaryReaderImpl& reader)
+            {
+                int32_t executed = reader.GetStream()->ReadInt32();
+
+                for (int32_t i = 0; i < executed; ++i)
+                {
+                    typename Batch::Entry& entry = batch.entries[i];
+
+                    if (entry.op == Batch::Operation::GET)
+                        reader.ReadTopObject<V>(entry.val);
+                    else if (entry.op != Batch::Operation::PUT)
+                        entry.flag = reader.GetStream()->ReadBool();
+                }
+
+                batch.executed = executed;
+
+                bool failed = reader.GetStream()->ReadBool();
+
+                if (failed)
+                    err = ReadEntryProcessorError(reader);
+            }
+
+            virtual void SetNull()
+            {
+                batch.executed = 0;
+            }
+
+            /**
+             * Get error of the failed operation.
+             *
+             * @return Error. Has IGNITE_SUCCESS code if all operations succeeded.
+             */
+            const IgniteError& GetError() const
+            {
+                return err;
+            }
+
+        private:
+            /** Batch. */
+            Batch& batch;
+
+            /** Error of the failed operation. */
+            IgniteError err;
+
+            IGNITE_NO_COPY_ASSIGNMENT(InOutCacheBatchOperation);
+        };
+
         /**
          * Output query GET ALL operation.
          */
@@ -0,0 +1,196 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_IMPL_THREAD_POOL
+#define _IGNITE_IMPL_THREAD_POOL
+
+#include <stdint.h>
+
+#include <deque>
+#include <vector>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        /**
+         * Task executed by the thread pool.
+         */
+        class IGNITE_IMPORT_EXPORT ThreadPoolTask
+        {
+        public:
+            /**
+             * Destructor.
+             */
+            virtual ~ThreadPoolTask()
+            {
+                // No-op.
+            }
+
+            /**
+             * Execute task.
+             *
+             * Nobody waits for the dispatched task, so exceptions thrown by the
+             * task are ignored. Task should handle its errors itself.
+             */
+            virtual void Execute() = 0;
+        };
+
+        /** Shared pointer to the thread pool task. */
+        typedef common::concurrent::SharedPointer<ThreadPoolTask> SP_ThreadPoolTask;
+
+        /**
+         * Native thread pool.
+         *
+         * Tasks dispatched with the same key always go to the same worker and
+         * are executed in the order of dispatch.
+         */
+        class IGNITE_IMPORT_EXPORT ThreadPool
+        {
+        public:
+            /**
+             * Constructor. Starts the worker threads.
+             *
+             * @param size Number of worker threads. Should be positive.
+             */
+            explicit ThreadPool(int32_t size);
+
+            /**
+             * Destructor. Stops the pool.
+             */
+            ~ThreadPool();
+
+            /**
+             * Dispatch task to the worker assigned to the key. Tasks with the
+             * same key are executed sequentially in the order of dispatch.
+             *
+             * @param key Key.
+             * @param task Task.
+             */
+            void Dispatch(int64_t key, const SP_ThreadPoolTask& task);
+
+            /**
+             * Wait for the tasks dispatched with the key before the call to
+             * be executed. Returns immediately if called by the worker assigned
+             * to the key, as it would wait for itself.
+             *
+             * @param key Key.
+             */
+            void Await(int64_t key);
+
+            /**
+             * Stop the pool. Tasks which are already dispatched are executed
+             * before the workers exit. Dispatching after the stop executes
+             * the task in place.
+             */
+            void Stop();
+
+            /**
+             * Get number of worker threads.
+             *
+             * @return Number of worker threads.
+             */
+            int32_t GetSize() const
+            {
+                return static_cast<int32_t>(workers.size());
+            }
+
+        private:
+            IGNITE_NO_COPY_ASSIGNMENT(ThreadPool);
+
+            /**
+             * Worker thread.
+             */
+            class Worker : public common::concurrent::Thread
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param pool Pool.
+                 */
+                explicit Worker(ThreadPool& pool);
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~Worker();
+
+                /**
+                 * Run worker.
+                 */
+                virtual void Run();
+
+                /** Tasks assigned to this worker. Guarded by the pool lock. */
+                std::deque<SP_ThreadPoolTask> queue;
+
+                /** Condition variable to wake the worker up. */
+                common::concurrent::ConditionVariable cond;
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(Worker);
+
+                /** Pool. */
+                ThreadPool& pool;
+            };
+
+            /**
+             * Get worker assigned to the key.
+             *
+             * @param key Key.
+             * @return Worker.
+             */
+            Worker& GetWorker(int64_t key)
+            {
+                return *workers[static_cast<uint64_t>(key) % workers.size()];
+            }
+
+            /**
+             * Take the next task for the worker waiting for it if needed.
+             *
+             * @param worker Worker.
+             * @return Task or null pointer if the pool is stopped and there
+             *    are no more tasks.
+             */
+            SP_ThreadPoolTask Take(Worker& worker);
+
+            /**
+             * Execute task ignoring the exceptions.
+             *
+             * @param task Task.
+             */
+            static void ExecuteSafe(SP_ThreadPoolTask task);
+
+            /** Lock. */
+            common::concurrent::CriticalSection lock;
+
+            /** Workers. */
+            std::vector<Worker*> workers;
+
+            /** Worker running in the current thread. */
+            common::concurrent::ThreadLocalInstance<Worker*> current;
+
+            /** Stopped flag. */
+            bool stopped;
+        };
+    }
+}
+
+#endif //_IGNITE_IMPL_THREAD_POOL
@@ -33,6 +33,17 @@ namespace ignite
         class AttachHelper 
         {
         public:
+            /**
+             * Constructor.
+             *
+             * @param env JNI environment of the attached thread.
+             */
+            AttachHelper(JNIEnv* env) :
+                env(env)
+            {
+                // No-op.
+            }
+
             /**
              * Destructor.
              */
@@ -40,8 +51,21 @@ namespace ignite
 
             /**
              * Callback invoked on successful thread attach ot JVM.
+             *
+             * @param env JNI environment of the attached thread.
              */
-            static void OnThreadAttach();
+            static void OnThreadAttach(JNIEnv* env);
+
+            /**
+             * Get JNI environment remembered on attach of the current thread.
+             *
+             * @return JNI environment or NULL if the thread is not attached yet.
+             */
+            static JNIEnv* GetAttachedEnv();
+
+        private:
+            /** JNI environment. */
+            JNIEnv* env;
         };
 
         /**
@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/impl/cache/cache_entry_iterator_impl.h"
+
+using namespace ignite::common::concurrent;
+using namespace ignite::jni::java;
+using namespace ignite::impl::interop;
+using namespace ignite::impl::binary;
+using namespace ignite::impl::cache::query;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cache
+        {
+            /** Operation: get next batch of entries. */
+            const int32_t OP_NEXT_BATCH = 2;
+
+            /** Operation: close iterator. */
+            const int32_t OP_CLOSE = 3;
+
+            CacheEntryIteratorImpl::CacheEntryIteratorImpl(SharedPointer<IgniteEnvironment> env,
+                jobject javaRef, int32_t batchSize) :
+                InteropTarget(env, javaRef),
+                batchSize(batchSize > 0 ? batchSize : static_cast<int32_t>(DEFAULT_BATCH_SIZE)),
+                batch(0),
+                lastBatch(false),
+                endReached(false),
+                closed(false)
+            {
+                // No-op.
+            }
+
+            CacheEntryIteratorImpl::~CacheEntryIteratorImpl()
+            {
+                IgniteError err;
+
+                Close(err);
+            }
+
+            bool CacheEntryIteratorImpl::HasNext(IgniteError& err)
+            {
+                if (!GetNextBatchIfNeeded(err))
+                    return false;
+
+                return !endReached;
+            }
+
+            void CacheEntryIteratorImpl::GetNext(OutputOperation& op, IgniteError& err)
+            {
+                if (!GetNextBatchIfNeeded(err))
+                    return;
+
+                if (endReached)
+                {
+                    err = IgniteError(IgniteError::IGNITE_ERR_GENERIC, "No more elements available.");
+
+                    return;
+                }
+
+                batch->GetNext(op);
+            }
+
+            void CacheEntryIteratorImpl::Close(IgniteError& err)
+            {
+                if (closed)
+                    return;
+
+                closed = true;
+                endReached = true;
+
+                delete batch;
+
+                batch = 0;
+
+                OutInOpLong(OP_CLOSE, 0, err);
+            }
+
+            bool CacheEntryIteratorImpl::GetNextBatchIfNeeded(IgniteError& err)
+            {
+                if (endReached || (batch && batch->Left() > 0))
+                    return true;
+
+                // Batch smaller than requested means that Java iterator is
+                // exhausted, so there is no need for another round trip.
+                if (lastBatch)
+                {
+                    endReached = true;
+
+                    return true;
+                }
+
+                SharedPointer<InteropMemory> inMem = GetEnvironment().AllocateMemory();
+                SharedPointer<InteropMemory> outMem = GetEnvironment().AllocateMemory();
+
+                InteropOutputStream out(inMem.Get());
+                BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                writer.WriteInt32(batchSize);
+
+                out.Synchronize();
+
+                InStreamOutStream(OP_NEXT_BATCH, *inMem.Get(), *outMem.Get(), err);
+
+                if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                    return false;
+
+                delete batch;
+
+                // Needed for exception safety.
+                batch = 0;
+
+                batch = new QueryBatch(GetEnvironment(), outMem);
+
+                lastBatch = batch->Size() < batchSize;
+                endReached = batch->IsEmpty();
+
+                return true;
+            }
+        }
+    }
+}
@@ -35,6 +35,7 @@ using namespace ignite::impl::binary;
 using namespace ignite::impl::cache::query;
 using namespace ignite::impl::cache::query::continuous;
 using namespace ignite::impl::interop;
+using namespace ignite::impl::compute;
 using namespace ignite::binary;
 
 struct Operation
@@ -74,6 +75,9 @@ struct Operation
             /** Operation: Invoke. */
             INVOKE = 12,
 
+            /** Operation: InvokeAll. */
+            INVOKE_ALL = 13,
+
             /** Operation: LoadCache */
             LOAD_CACHE = 15,
 
@@ -140,14 +144,65 @@ struct Operation
             /** Operation: Size(peekModes). */
             SIZE = 48,
 
+            /** Operation: LocalEntries(peekModes). */
+            LOC_ITERATOR = 50,
+
             /** Operation: SizeLoc(peekModes). */
             SIZE_LOC = 56,
 
             /** Operation: Invoke. */
             INVOKE_JAVA = 98,
+
+            /** Operation: LocalPartitionEntries(part). */
+            LOC_PART_ITERATOR = 100,
+
+            /** Operation: ExecuteBatch(batch). */
+            BATCH = 101,
     };
 };
 
+/** Future type: object. Results of all cache operations are passed as objects. */
+const int32_t FUTURE_TYPE_OBJECT = 9;
+
+/**
+ * Input operation of the asynchronous cache operation. Writes arguments of the
+ * operation followed by the future handle and type.
+ */
+class InAsyncOperation : public InputOperation
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param inOp Arguments of the operation. Can be null.
+     * @param futHandle Future handle.
+     */
+    InAsyncOperation(InputOperation* inOp, int64_t futHandle) :
+        inOp(inOp),
+        futHandle(futHandle)
+    {
+        // No-op.
+    }
+
+    virtual void ProcessInput(BinaryWriterImpl& writer)
+    {
+        if (inOp)
+            inOp->ProcessInput(writer);
+
+        writer.WriteInt64(futHandle);
+        writer.WriteInt32(FUTURE_TYPE_OBJECT);
+    }
+
+private:
+    /** Arguments of the operation. */
+    InputOperation* inOp;
+
+    /** Future handle. */
+    int64_t futHandle;
+
+    IGNITE_NO_COPY_ASSIGNMENT(InAsyncOperation);
+};
+
 namespace ignite
 {
     namespace impl
@@ -209,6 +264,11 @@ namespace ignite
                 OutOp(Operation::PUT_ALL, inOp, err);
             }
 
+            void CacheImpl::ExecuteBatch(InputOperation& inOp, OutputOperation& outOp, IgniteError& err)
+            {
+                OutInOp(Operation::BATCH, inOp, outOp, err);
+            }
+
             void CacheImpl::GetAndPut(InputOperation& inOp, OutputOperation& outOp, IgniteError& err)
             {
                 OutInOpX(Operation::GET_AND_PUT, inOp, outOp, err);
@@ -309,6 +369,49 @@ namespace ignite
                 return static_cast<int32_t>(OutInOpLong(op, peekModes, err));
             }
 
+            CacheEntryIteratorImpl* CacheImpl::LocalEntries(int32_t peekModes, int32_t batchSize, IgniteError& err)
+            {
+                SharedPointer<InteropMemory> mem = GetEnvironment().AllocateMemory();
+                InteropOutputStream out(mem.Get());
+                BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                writer.WriteInt32(peekModes);
+
+                out.Synchronize();
+
+                jobject iterJavaRef = InStreamOutObject(Operation::LOC_ITERATOR, *mem.Get(), err);
+
+                if (!iterJavaRef)
+                    return 0;
+
+                return new CacheEntryIteratorImpl(GetEnvironmentPointer(), iterJavaRef, batchSize);
+            }
+
+            CacheEntryIteratorImpl* CacheImpl::LocalPartitionEntries(int32_t part, int32_t batchSize, IgniteError& err)
+            {
+                if (batchSize <= 0)
+                    batchSize = CacheEntryIteratorImpl::DEFAULT_BATCH_SIZE;
+
+                SharedPointer<InteropMemory> mem = GetEnvironment().AllocateMemory();
+                InteropOutputStream out(mem.Get());
+                BinaryWriterImpl writer(&out, GetEnvironment().GetTypeManager());
+
+                writer.WriteInt32(part);
+
+                // Scan query page size. Matches the batch size, so every batch
+                // is served from a single page.
+                writer.WriteInt32(batchSize);
+
+                out.Synchronize();
+
+                jobject iterJavaRef = InStreamOutObject(Operation::LOC_PART_ITERATOR, *mem.Get(), err);
+
+                if (!iterJavaRef)
+                    return 0;
+
+                return new CacheEntryIteratorImpl(GetEnvironmentPointer(), iterJavaRef, batchSize);
+            }
+
             QueryCursorImpl* CacheImpl::QuerySql(const SqlQuery& qry, IgniteError& err)
             {
                 return QueryInternal(qry, Operation::QRY_SQL, err);
@@ -329,6 +432,11 @@ namespace ignite
                 OutInOpX(Operation::INVOKE, inOp, outOp, err);
             }
 
+            void CacheImpl::InvokeAll(InputOperation& inOp, OutputOperation& outOp, IgniteError& err)
+            {
+                OutInOpX(Operation::INVOKE_ALL, inOp, outOp, err);
+            }
+
             void CacheImpl::InvokeJava(InputOperation& inOp, OutputOperation& outOp, IgniteError& err)
             {
                 OutInOpX(Operation::INVOKE_JAVA, inOp, outOp, err);
@@ -399,6 +507,36 @@ namespace ignite
                 IgniteError::SetError(jniErr.code, jniErr.errCls, jniErr.errMsg, err);
             }
 
+            void CacheImpl::OutOpAsync(AsyncOperation::Type op, InputOperation& inOp,
+                SharedPointer<ComputeTaskHolder> fut, IgniteError& err)
+            {
+                HandleRegistry& registry = GetEnvironment().GetHandleRegistry();
+
+                int64_t futHandle = registry.Allocate(fut);
+
+                InAsyncOperation asyncOp(&inOp, futHandle);
+
+                OutOp(op, asyncOp, err);
+
+                if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                    registry.Release(futHandle);
+            }
+
+            void CacheImpl::OutOpAsync(AsyncOperation::Type op, SharedPointer<ComputeTaskHolder> fut,
+                IgniteError& err)
+            {
+                HandleRegistry& registry = GetEnvironment().GetHandleRegistry();
+
+                int64_t futHandle = registry.Allocate(fut);
+
+                InAsyncOperation asyncOp(0, futHandle);
+
+                OutOp(op, asyncOp, err);
+
+                if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                    registry.Release(futHandle);
+            }
+
             struct Dummy
             {
                 void Write(BinaryRawWriter&) const
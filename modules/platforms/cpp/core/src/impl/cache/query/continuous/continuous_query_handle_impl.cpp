@@ -59,6 +59,9 @@ namespace ignite
 
                         JniContext::Release(javaRef);
 
+                        // Listener must not be used after the handle is released.
+                        env.Get()->AwaitContinuousQueryListener(handle);
+
                         env.Get()->GetHandleRegistry().Release(handle);
                     }
 
@@ -46,6 +46,30 @@ namespace ignite
                     return new QueryFieldsRowImpl(mem, dataPos, columnNum);
                 }
 
+                void QueryBatch::GetNextRow(common::concurrent::SharedPointer<QueryFieldsRowImpl>& row)
+                {
+                    assert(Left() > 0);
+
+                    int32_t rowBegin = stream.Position();
+
+                    int32_t rowLen = reader.ReadInt32();
+                    int32_t columnNum = reader.ReadInt32();
+
+                    int32_t dataPos = stream.Position();
+
+                    assert(rowLen >= 4);
+
+                    ++pos;
+
+                    stream.Position(rowBegin + rowLen);
+
+                    // Rows of the same batch share the memory, so the row is
+                    // only allocated once per batch.
+                    if (!row.IsValid() || !row.Get()->Reset(mem, dataPos, columnNum))
+                        row = common::concurrent::SharedPointer<QueryFieldsRowImpl>(
+                            new QueryFieldsRowImpl(mem, dataPos, columnNum));
+                }
+
             }
         }
     }
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <deque>
+
 #include "ignite/impl/cache/query/query_impl.h"
 #include "ignite/impl/cache/query/query_fields_row_impl.h"
 
@@ -47,26 +49,194 @@ namespace ignite
                 /** Operation: close iterator. */
                 const int32_t OP_ITERATOR_HAS_NEXT = 6;
 
+                /**
+                 * Fetches query batches in the background thread, so the next
+                 * batch is ready by the time the current one is processed.
+                 * Only the prefetcher thread accesses the Java iterator while
+                 * it is running.
+                 */
+                class QueryBatchPrefetcher : public Thread
+                {
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param cursor Cursor.
+                     * @param depth Maximum number of fetched batches.
+                     */
+                    QueryBatchPrefetcher(QueryCursorImpl& cursor, int32_t depth) :
+                        cursor(cursor),
+                        depth(static_cast<size_t>(depth)),
+                        ready(),
+                        mux(),
+                        cond(),
+                        stopped(false)
+                    {
+                        // No-op.
+                    }
+
+                    /**
+                     * Destructor. Stops the thread.
+                     */
+                    virtual ~QueryBatchPrefetcher()
+                    {
+                        {
+                            CsLockGuard guard(mux);
+
+                            stopped = true;
+
+                            cond.NotifyAll();
+                        }
+
+                        Join();
+
+                        for (std::deque<Result>::iterator it = ready.begin(); it != ready.end(); ++it)
+                            delete it->batch;
+                    }
+
+                    virtual void Run()
+                    {
+                        while (true)
+                        {
+                            {
+                                CsLockGuard guard(mux);
+
+                                while (ready.size() >= depth && !stopped)
+                                    cond.Wait(mux);
+
+                                if (stopped)
+                                    return;
+                            }
+
+                            Result res;
+
+                            // Errors are passed to the consumer, as there is no
+                            // one to handle them in this thread.
+                            try
+                            {
+                                res.batch = cursor.FetchBatch(res.err);
+                            }
+                            catch (const IgniteError& err)
+                            {
+                                res.batch = 0;
+                                res.err = err;
+                            }
+                            catch (const std::exception& err)
+                            {
+                                res.batch = 0;
+                                res.err = IgniteError(IgniteError::IGNITE_ERR_STD, err.what());
+                            }
+                            catch (...)
+                            {
+                                res.batch = 0;
+                                res.err = IgniteError(IgniteError::IGNITE_ERR_UNKNOWN,
+                                    "Unknown error occurred while fetching query batch.");
+                            }
+
+                            CsLockGuard guard(mux);
+
+                            ready.push_back(res);
+
+                            cond.NotifyAll();
+
+                            // Null batch is the last one: either the end is
+                            // reached or an error has occurred.
+                            if (!res.batch)
+                                return;
+                        }
+                    }
+
+                    /**
+                     * Take the next batch waiting for it if needed.
+                     *
+                     * @param err Error.
+                     * @return Batch or null if there are no more batches or an
+                     *     error has occurred.
+                     */
+                    QueryBatch* Take(IgniteError& err)
+                    {
+                        CsLockGuard guard(mux);
+
+                        while (ready.empty())
+                            cond.Wait(mux);
+
+                        Result& res = ready.front();
+
+                        if (!res.batch)
+                        {
+                            err = res.err;
+
+                            return 0;
+                        }
+
+                        QueryBatch* batch = res.batch;
+
+                        ready.pop_front();
+
+                        cond.NotifyAll();
+
+                        return batch;
+                    }
+
+                private:
+                    IGNITE_NO_COPY_ASSIGNMENT(QueryBatchPrefetcher);
+
+                    /**
+                     * Fetch result.
+                     */
+                    struct Result
+                    {
+                        /** Batch. Null if there are no more batches. */
+                        QueryBatch* batch;
+
+                        /** Error. */
+                        IgniteError err;
+                    };
+
+                    /** Cursor. */
+                    QueryCursorImpl& cursor;
+
+                    /** Maximum number of fetched batches. */
+                    size_t depth;
+
+                    /** Fetched batches. */
+                    std::deque<Result> ready;
+
+                    /** Mutex. */
+                    CriticalSection mux;
+
+                    /** Condition variable. */
+                    ConditionVariable cond;
+
+                    /** Stopped flag. */
+                    bool stopped;
+                };
+
                 QueryCursorImpl::QueryCursorImpl(SharedPointer<IgniteEnvironment> env, jobject javaRef) :
                     env(env),
                     javaRef(javaRef),
                     batch(0),
                     endReached(false),
                     iterCalled(false),
-                    getAllCalled(false)
+                    getAllCalled(false),
+                    prefetchDepth(0),
+                    prefetcher(0)
                 {
                     // No-op.
                 }
 
                 QueryCursorImpl::~QueryCursorImpl()
                 {
-                    // 1. Releasing memory.
+                    // 1. Stop background fetching.
+                    delete prefetcher;
+
+                    // 2. Releasing memory.
                     delete batch;
 
-                    // 2. Close the cursor.
+                    // 3. Close the cursor.
                     env.Get()->Context()->TargetInLongOutLong(javaRef, OP_ITERATOR_CLOSE, 0);
 
-                    // 3. Release Java reference.
+                    // 4. Release Java reference.
                     JniContext::Release(javaRef);
                 }
 
@@ -148,6 +318,29 @@ namespace ignite
                     return batch->GetNextRow();
                 }
 
+                void QueryCursorImpl::GetNextRow(SharedPointer<QueryFieldsRowImpl>& row, IgniteError& err)
+                {
+                    // Create iterator in Java if needed.
+                    if (!CreateIteratorIfNeeded(err))
+                        return;
+
+                    // Get next results batch if the end in the current batch
+                    // has been reached.
+                    if (!GetNextBatchIfNeeded(err))
+                        return;
+
+                    if (endReached)
+                    {
+                        // Ensure we do not overwrite possible previous error.
+                        if (err.GetCode() == IgniteError::IGNITE_SUCCESS)
+                            err = IgniteError(IgniteError::IGNITE_ERR_GENERIC, "No more elements available.");
+
+                        return;
+                    }
+
+                    batch->GetNextRow(row);
+                }
+
                 void QueryCursorImpl::GetAll(OutputOperation& op, IgniteError& err)
                 {
                     // Check whether any of iterator methods were called.
@@ -238,8 +431,17 @@ namespace ignite
                     IgniteError::SetError(jniErr.code, jniErr.errCls, jniErr.errMsg, err);
 
                     if (jniErr.code == IGNITE_JNI_ERR_SUCCESS)
+                    {
                         iterCalled = true;
 
+                        if (prefetchDepth > 0)
+                        {
+                            prefetcher = new QueryBatchPrefetcher(*this, prefetchDepth);
+
+                            prefetcher->Start();
+                        }
+                    }
+
                     return iterCalled;
                 }
 
@@ -250,10 +452,25 @@ namespace ignite
                     if (endReached || (batch && batch->Left() > 0))
                         return true;
 
-                    endReached = !IteratorHasNext(err);
+                    delete batch;
 
-                    if (endReached)
-                        return true;
+                    // Needed for exception safety.
+                    batch = 0;
+
+                    if (prefetcher)
+                        batch = prefetcher->Take(err);
+                    else
+                        batch = FetchBatch(err);
+
+                    endReached = batch == 0;
+
+                    return err.GetCode() == IgniteError::IGNITE_SUCCESS;
+                }
+
+                QueryBatch* QueryCursorImpl::FetchBatch(IgniteError& err)
+                {
+                    if (!IteratorHasNext(err))
+                        return 0;
 
                     JniErrorInfo jniErr;
 
@@ -265,18 +482,18 @@ namespace ignite
                     IgniteError::SetError(jniErr.code, jniErr.errCls, jniErr.errMsg, err);
 
                     if (jniErr.code != IGNITE_JNI_ERR_SUCCESS)
-                        return false;
-
-                    delete batch;
+                        return 0;
 
-                    // Needed for exception safety.
-                    batch = 0;
+                    QueryBatch* res = new QueryBatch(*env.Get(), inMem);
 
-                    batch = new QueryBatch(*env.Get(), inMem);
+                    if (res->IsEmpty())
+                    {
+                        delete res;
 
-                    endReached = batch->IsEmpty();
+                        return 0;
+                    }
 
-                    return true;
+                    return res;
                 }
 
                 bool QueryCursorImpl::IteratorHasNext(IgniteError& err)
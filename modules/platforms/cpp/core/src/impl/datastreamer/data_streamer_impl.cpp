@@ -0,0 +1,347 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/impl/datastreamer/data_streamer_impl.h"
+#include "ignite/impl/compute/java_compute_task_holder.h"
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::interop;
+using namespace ignite::impl::binary;
+using namespace ignite::impl::compute;
+
+namespace
+{
+    /** Position of the policy in the batch buffer. */
+    const int32_t POLICY_POS = 0;
+
+    /** Position of the future handle in the batch buffer. */
+    const int32_t FUTURE_POS = 4;
+
+    /** Position of the entries number in the batch buffer. */
+    const int32_t SIZE_POS = 12;
+
+    /** Position of the first entry in the batch buffer. */
+    const int32_t ENTRIES_POS = 16;
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace datastreamer
+        {
+            DataStreamerImpl::DataStreamerImpl(SP_IgniteEnvironment env, jobject javaRef,
+                const std::string& cacheName) :
+                InteropTarget(env, javaRef),
+                cacheName(cacheName),
+                lock(),
+                topology(new DataStreamerTopology()),
+                topologyHandle(-1),
+                batchMem(env.Get()->AllocateMemory()),
+                batchPos(ENTRIES_POS),
+                batchSize(0),
+                batchMetaVer(0),
+                perNodeBufferSize(0),
+                batchFuts(),
+                closed(false)
+            {
+                topologyHandle = env.Get()->GetHandleRegistry().Allocate(topology);
+
+                IgniteError err;
+
+                OutInOpLong(Operation::LISTEN_TOPOLOGY, topologyHandle, err);
+
+                if (err.GetCode() == IgniteError::IGNITE_SUCCESS)
+                    perNodeBufferSize = static_cast<int32_t>(OutInOpLong(Operation::PER_NODE_BUFFER_SIZE, 0, err));
+
+                if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                {
+                    env.Get()->GetHandleRegistry().Release(topologyHandle);
+
+                    throw err;
+                }
+            }
+
+            DataStreamerImpl::~DataStreamerImpl()
+            {
+                if (!closed)
+                {
+                    try
+                    {
+                        Close(false);
+                    }
+                    catch (const IgniteError&)
+                    {
+                        // No-op.
+                    }
+                }
+
+                GetEnvironment().GetHandleRegistry().Release(topologyHandle);
+            }
+
+            void DataStreamerImpl::Flush()
+            {
+                std::vector< Future<void> > futs;
+
+                {
+                    CsLockGuard guard(lock);
+
+                    if (closed)
+                        throw IgniteError(IgniteError::IGNITE_ERR_ILLEGAL_STATE, "Data streamer has been closed.");
+
+                    SendBatch(Policy::FLUSH);
+
+                    futs.swap(batchFuts);
+                }
+
+                WaitAll(futs);
+            }
+
+            void DataStreamerImpl::TryFlush()
+            {
+                CsLockGuard guard(lock);
+
+                if (closed)
+                    throw IgniteError(IgniteError::IGNITE_ERR_ILLEGAL_STATE, "Data streamer has been closed.");
+
+                SendBatch(Policy::FLUSH);
+            }
+
+            void DataStreamerImpl::Close(bool cancel)
+            {
+                std::vector< Future<void> > futs;
+
+                {
+                    CsLockGuard guard(lock);
+
+                    if (closed)
+                        return;
+
+                    closed = true;
+
+                    if (cancel)
+                    {
+                        batchPos = ENTRIES_POS;
+                        batchSize = 0;
+
+                        InteropOutputStream out(batchMem.Get());
+
+                        out.WriteInt32(Policy::CANCEL_CLOSE);
+
+                        out.Synchronize();
+
+                        IgniteError err;
+
+                        OutOp(Operation::UPDATE, *batchMem.Get(), err);
+
+                        batchFuts.clear();
+
+                        IgniteError::ThrowIfNeeded(err);
+
+                        return;
+                    }
+
+                    SendBatch(Policy::CLOSE);
+
+                    futs.swap(batchFuts);
+                }
+
+                WaitAll(futs);
+            }
+
+            bool DataStreamerImpl::IsAllowOverwrite()
+            {
+                return GetBoolProperty(Operation::ALLOW_OVERWRITE);
+            }
+
+            void DataStreamerImpl::SetAllowOverwrite(bool allowOverwrite)
+            {
+                SetProperty(Operation::SET_ALLOW_OVERWRITE, allowOverwrite ? 1 : 0);
+            }
+
+            bool DataStreamerImpl::IsSkipStore()
+            {
+                return GetBoolProperty(Operation::SKIP_STORE);
+            }
+
+            void DataStreamerImpl::SetSkipStore(bool skipStore)
+            {
+                SetProperty(Operation::SET_SKIP_STORE, skipStore ? 1 : 0);
+            }
+
+            int32_t DataStreamerImpl::GetPerNodeBufferSize()
+            {
+                return static_cast<int32_t>(GetLongProperty(Operation::PER_NODE_BUFFER_SIZE));
+            }
+
+            void DataStreamerImpl::SetPerNodeBufferSize(int32_t size)
+            {
+                if (size <= 0)
+                {
+                    throw IgniteError(IgniteError::IGNITE_ERR_ILLEGAL_ARGUMENT,
+                        "Per node buffer size should be positive.");
+                }
+
+                SetProperty(Operation::SET_PER_NODE_BUFFER_SIZE, size);
+
+                CsLockGuard guard(lock);
+
+                perNodeBufferSize = size;
+            }
+
+            int32_t DataStreamerImpl::GetPerNodeParallelOperations()
+            {
+                return static_cast<int32_t>(GetLongProperty(Operation::PER_NODE_PARALLEL_OPS));
+            }
+
+            void DataStreamerImpl::SetPerNodeParallelOperations(int32_t parallelOps)
+            {
+                SetProperty(Operation::SET_PER_NODE_PARALLEL_OPS, parallelOps);
+            }
+
+            int64_t DataStreamerImpl::GetTimeout()
+            {
+                return GetLongProperty(Operation::GET_TIMEOUT);
+            }
+
+            void DataStreamerImpl::SetTimeout(int64_t timeout)
+            {
+                SetProperty(Operation::SET_TIMEOUT, timeout);
+            }
+
+            void DataStreamerImpl::StartEntry(InteropOutputStream& out)
+            {
+                if (closed)
+                    throw IgniteError(IgniteError::IGNITE_ERR_ILLEGAL_STATE, "Data streamer has been closed.");
+
+                if (batchSize == 0)
+                    batchMetaVer = GetEnvironment().GetTypeManager()->GetVersion();
+
+                out.Position(batchPos);
+            }
+
+            void DataStreamerImpl::FinishEntry(InteropOutputStream& out)
+            {
+                out.Synchronize();
+
+                batchPos = out.Position();
+                ++batchSize;
+
+                if (batchSize >= perNodeBufferSize * topology.Get()->GetSize())
+                    SendBatch(Policy::CONTINUE);
+            }
+
+            void DataStreamerImpl::SendBatch(Policy::Type plc)
+            {
+                if (batchSize == 0 && plc == Policy::CONTINUE)
+                    return;
+
+                IgniteError err;
+
+                ProcessMetaUpdates(batchMetaVer, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                HandleRegistry& registry = GetEnvironment().GetHandleRegistry();
+
+                SharedPointer< JavaComputeTaskHolder<void> > fut;
+                int64_t futHandle = 0;
+
+                if (batchSize > 0)
+                {
+                    fut = SharedPointer< JavaComputeTaskHolder<void> >(new JavaComputeTaskHolder<void>());
+                    futHandle = registry.Allocate(fut);
+                }
+
+                InteropOutputStream out(batchMem.Get());
+
+                out.WriteInt32(POLICY_POS, plc);
+                out.WriteInt64(FUTURE_POS, futHandle);
+                out.WriteInt32(SIZE_POS, batchSize);
+
+                out.Position(batchPos);
+
+                out.Synchronize();
+
+                OutOp(Operation::UPDATE, *batchMem.Get(), err);
+
+                batchPos = ENTRIES_POS;
+                batchSize = 0;
+
+                if (err.GetCode() != IgniteError::IGNITE_SUCCESS)
+                {
+                    if (fut.Get())
+                        registry.Release(futHandle);
+
+                    throw err;
+                }
+
+                if (!fut.Get())
+                    return;
+
+                // Forgetting batches that are already done to keep the list short.
+                std::vector< Future<void> >::iterator it = batchFuts.begin();
+
+                while (it != batchFuts.end() && it->IsReady())
+                    ++it;
+
+                batchFuts.erase(batchFuts.begin(), it);
+
+                batchFuts.push_back(fut.Get()->GetPromise().GetFuture());
+            }
+
+            void DataStreamerImpl::ProcessMetaUpdates(int32_t metaVer, IgniteError& err)
+            {
+                BinaryTypeManager* metaMgr = GetEnvironment().GetTypeManager();
+
+                if (metaMgr->IsUpdatedSince(metaVer))
+                    metaMgr->ProcessPendingUpdates(err);
+            }
+
+            void DataStreamerImpl::WaitAll(const std::vector< Future<void> >& futs)
+            {
+                for (std::vector< Future<void> >::const_iterator it = futs.begin(); it != futs.end(); ++it)
+                    it->GetValue();
+            }
+
+            bool DataStreamerImpl::GetBoolProperty(Operation::Type op)
+            {
+                return GetLongProperty(op) == 1;
+            }
+
+            int64_t DataStreamerImpl::GetLongProperty(Operation::Type op)
+            {
+                IgniteError err;
+
+                int64_t res = OutInOpLong(op, 0, err);
+
+                IgniteError::ThrowIfNeeded(err);
+
+                return res;
+            }
+
+            void DataStreamerImpl::SetProperty(Operation::Type op, int64_t val)
+            {
+                IgniteError err;
+
+                OutInOpLong(op, val, err);
+
+                IgniteError::ThrowIfNeeded(err);
+            }
+        }
+    }
+}
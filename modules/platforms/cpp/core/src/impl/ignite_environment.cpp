@@ -15,13 +15,18 @@
  * limitations under the License.
  */
 
+#include <sstream>
+
 #include <ignite/impl/interop/interop_external_memory.h>
+#include <ignite/impl/interop/interop_memory_pool.h>
 #include <ignite/impl/binary/binary_reader_impl.h>
 #include <ignite/impl/binary/binary_type_updater_impl.h>
 #include <ignite/impl/module_manager.h>
 #include <ignite/impl/ignite_binding_impl.h>
 #include <ignite/impl/compute/compute_task_holder.h>
+#include <ignite/impl/compute/native_compute_task_holder.h>
 #include <ignite/impl/cluster/cluster_node_impl.h>
+#include <ignite/impl/datastreamer/data_streamer_impl.h>
 
 #include <ignite/ignite.h>
 #include <ignite/binary/binary.h>
@@ -41,6 +46,58 @@ namespace ignite
 {
     namespace impl
     {
+        /**
+         * Continuous query listener task.
+         */
+        class ContinuousQueryListenerTask : public ThreadPoolTask
+        {
+        public:
+            /**
+             * Constructor.
+             *
+             * @param registry Handle registry.
+             * @param qryHandle Continuous query handle.
+             * @param mem Memory with the events.
+             */
+            ContinuousQueryListenerTask(HandleRegistry& registry, int64_t qryHandle,
+                const SharedPointer<InteropMemory>& mem) :
+                registry(registry),
+                qryHandle(qryHandle),
+                mem(mem)
+            {
+                // No-op.
+            }
+
+            virtual void Execute()
+            {
+                // Query could have been closed by the listener while the events were queued.
+                SharedPointer<void> qry = registry.Get(qryHandle);
+
+                if (!qry.IsValid())
+                    return;
+
+                InteropInputStream stream(mem.Get());
+                BinaryReaderImpl reader(&stream);
+
+                // Skip query handle.
+                reader.ReadInt64();
+
+                BinaryRawReader rawReader(&reader);
+
+                static_cast<ContinuousQueryImplBase*>(qry.Get())->ReadAndProcessEvents(rawReader);
+            }
+
+        private:
+            /** Handle registry. */
+            HandleRegistry& registry;
+
+            /** Continuous query handle. */
+            int64_t qryHandle;
+
+            /** Memory with the events. */
+            SharedPointer<InteropMemory> mem;
+        };
+
         /**
          * Callback codes.
          */
@@ -49,6 +106,7 @@ namespace ignite
             enum Type
             {
                 CACHE_INVOKE = 8,
+                COMPUTE_TASK_MAP = 9,
                 COMPUTE_TASK_JOB_RESULT = 10,
                 COMPUTE_TASK_REDUCE = 11,
                 COMPUTE_TASK_COMPLETE = 12,
@@ -59,6 +117,8 @@ namespace ignite
                 CONTINUOUS_QUERY_FILTER_CREATE = 19,
                 CONTINUOUS_QUERY_FILTER_APPLY = 20,
                 CONTINUOUS_QUERY_FILTER_RELEASE = 21,
+                DATA_STREAMER_TOPOLOGY_UPDATE = 22,
+                DATA_STREAMER_STREAM_RECEIVER_INVOKE = 23,
                 FUTURE_BYTE_RESULT = 24,
                 FUTURE_BOOL_RESULT = 25,
                 FUTURE_SHORT_RESULT = 26,
@@ -88,6 +148,7 @@ namespace ignite
         {
             enum Type
             {
+                GET_CACHE = 1,
                 GET_BINARY_PROCESSOR = 21,
                 RELEASE_START = 22
             };
@@ -214,6 +275,15 @@ namespace ignite
                     break;
                 }
 
+                case OperationCallback::COMPUTE_TASK_MAP:
+                {
+                    SharedPointer<InteropMemory> mem = env->Get()->GetMemory(val);
+
+                    env->Get()->ComputeTaskMap(mem);
+
+                    break;
+                }
+
                 case OperationCallback::COMPUTE_TASK_JOB_RESULT:
                 {
                     SharedPointer<InteropMemory> mem = env->Get()->GetMemory(val);
@@ -312,8 +382,6 @@ namespace ignite
         int64_t IGNITE_CALL InLongLongLongObjectOutLong(void* target, int type, int64_t val1, int64_t val2,
             int64_t val3, void* arg)
         {
-            IGNITE_UNUSED(val3);
-
             int64_t res = 0;
             SharedPointer<IgniteEnvironment>* env = static_cast<SharedPointer<IgniteEnvironment>*>(target);
 
@@ -335,7 +403,7 @@ namespace ignite
 
                 case OperationCallback::COMPUTE_TASK_COMPLETE:
                 {
-                    env->Get()->ComputeTaskComplete(val1);
+                    env->Get()->ComputeTaskComplete(val1, val2);
 
                     break;
                 }
@@ -388,6 +456,22 @@ namespace ignite
                     break;
                 }
 
+                case OperationCallback::DATA_STREAMER_TOPOLOGY_UPDATE:
+                {
+                    env->Get()->OnDataStreamerTopologyUpdate(val1, val2, static_cast<int32_t>(val3));
+
+                    break;
+                }
+
+                case OperationCallback::DATA_STREAMER_STREAM_RECEIVER_INVOKE:
+                {
+                    SharedPointer<InteropMemory> mem = env->Get()->GetMemory(val1);
+
+                    env->Get()->OnDataStreamerStreamReceiverInvoke(mem);
+
+                    break;
+                }
+
                 default:
                 {
                     break;
@@ -409,8 +493,12 @@ namespace ignite
             binding(),
             moduleMgr(),
             nodes(new ClusterNodesHolder()),
-            ignite(0)
+            ignite(0),
+            threadPool(0)
         {
+            if (cfg.nativeThreadPoolSize > 0)
+                threadPool = new ThreadPool(cfg.nativeThreadPoolSize);
+
             binding = SharedPointer<IgniteBindingImpl>(new IgniteBindingImpl(*this));
 
             IgniteBindingContext bindingContext(cfg, GetBinding());
@@ -420,6 +508,9 @@ namespace ignite
 
         IgniteEnvironment::~IgniteEnvironment()
         {
+            // Stop the pool first as pending tasks can use the environment.
+            delete threadPool;
+
             delete[] name;
 
             delete ignite;
@@ -489,14 +580,15 @@ namespace ignite
 
         SharedPointer<InteropMemory> IgniteEnvironment::AllocateMemory()
         {
-            SharedPointer<InteropMemory> ptr(new InteropUnpooledMemory(DEFAULT_ALLOCATION_SIZE));
-
-            return ptr;
+            return AllocateMemory(DEFAULT_ALLOCATION_SIZE);
         }
 
         SharedPointer<InteropMemory> IgniteEnvironment::AllocateMemory(int32_t cap)
         {
-            SharedPointer<InteropMemory> ptr(new InteropUnpooledMemory(cap));
+            SharedPointer<InteropMemory> ptr = InteropMemoryPool::AllocateThreadLocal(cap, DEFAULT_ALLOCATION_SIZE);
+
+            if (!ptr.IsValid())
+                ptr = SharedPointer<InteropMemory>(new InteropUnpooledMemory(cap));
 
             return ptr;
         }
@@ -561,6 +653,30 @@ namespace ignite
             return res;
         }
 
+        jobject IgniteEnvironment::GetProcessorCache(const std::string& name)
+        {
+            SharedPointer<InteropMemory> mem = AllocateMemory();
+            InteropOutputStream out(mem.Get());
+            BinaryWriterImpl writer(&out, GetTypeManager());
+
+            writer.WriteString(name.data(), static_cast<int32_t>(name.size()));
+
+            out.Synchronize();
+
+            JniErrorInfo jniErr;
+
+            jobject res = ctx.Get()->TargetInStreamOutObject(proc.Get(), ProcessorOp::GET_CACHE,
+                mem.Get()->PointerLong(), &jniErr);
+
+            IgniteError err;
+
+            IgniteError::SetError(jniErr.code, jniErr.errCls, jniErr.errMsg, err);
+
+            IgniteError::ThrowIfNeeded(err);
+
+            return res;
+        }
+
         void IgniteEnvironment::ComputeJobExecuteLocal(int64_t jobHandle)
         {
             SharedPointer<compute::ComputeJobHolder> job0 =
@@ -623,7 +739,77 @@ namespace ignite
             }
         }
 
-        void IgniteEnvironment::ComputeTaskComplete(int64_t taskHandle)
+        void IgniteEnvironment::ComputeTaskMap(SharedPointer<InteropMemory>& mem)
+        {
+            InteropInputStream inStream(mem.Get());
+            BinaryReaderImpl reader(&inStream);
+
+            int64_t taskHandle = reader.ReadInt64();
+
+            std::vector<ignite::cluster::ClusterNode> subgrid;
+
+            // Topology is always passed as the task is started with zero topology version.
+            bool topChanged = reader.ReadBool();
+
+            if (topChanged)
+            {
+                // Topology version.
+                reader.ReadInt64();
+
+                int32_t nodeCnt = reader.ReadInt32();
+                int32_t subgridCnt = reader.ReadInt32();
+
+                subgrid.reserve(subgridCnt);
+
+                for (int32_t i = 0; i < nodeCnt; ++i)
+                {
+                    SP_ClusterNodeImpl node = GetNode(reader.ReadGuid());
+
+                    if (reader.ReadBool() && node.IsValid())
+                        subgrid.push_back(ignite::cluster::ClusterNode(node));
+                }
+            }
+
+            SharedPointer<compute::NativeComputeTaskHolder> task0 =
+                StaticPointerCast<compute::NativeComputeTaskHolder>(registry.Get(taskHandle));
+
+            compute::NativeComputeTaskHolder* task = task0.Get();
+
+            InteropOutputStream outStream(mem.Get());
+            BinaryWriterImpl writer(&outStream, GetTypeManager());
+
+            try
+            {
+                if (!task)
+                {
+                    IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_COMPUTE_USER_UNDECLARED_EXCEPTION,
+                        "Task is not registred for handle", "taskHandle", taskHandle);
+                }
+
+                if (!topChanged)
+                    throw IgniteError(IgniteError::IGNITE_ERR_GENERIC, "Subgrid is not passed to the task map.");
+
+                task->Map(*this, subgrid, writer);
+            }
+            catch (const IgniteError& err)
+            {
+                outStream.Position(0);
+
+                writer.WriteBool(false);
+                writer.WriteString(err.GetText());
+            }
+            catch (const std::exception& err)
+            {
+                outStream.Position(0);
+
+                writer.WriteBool(false);
+                writer.WriteString(err.what());
+            }
+
+            outStream.Synchronize();
+        }
+
+        void IgniteEnvironment::ComputeTaskComplete(int64_t taskHandle, int64_t memPtr)
         {
             SharedPointer<compute::ComputeTaskHolder> task0 =
                 StaticPointerCast<compute::ComputeTaskHolder>(registry.Get(taskHandle));
@@ -632,6 +818,34 @@ namespace ignite
 
             if (task)
             {
+                IgniteError err;
+
+                if (memPtr)
+                {
+                    SharedPointer<InteropMemory> mem = GetMemory(memPtr);
+                    InteropInputStream inStream(mem.Get());
+                    BinaryReaderImpl reader(&inStream);
+
+                    bool native = reader.ReadBool();
+
+                    if (native)
+                        err = reader.ReadObject<IgniteError>();
+                    else
+                    {
+                        std::stringstream buf;
+
+                        buf << reader.ReadObject<std::string>() << " : ";
+                        buf << reader.ReadObject<std::string>() << ", ";
+                        buf << reader.ReadObject<std::string>();
+
+                        std::string msg = buf.str();
+
+                        err = IgniteError(IgniteError::IGNITE_ERR_GENERIC, msg.c_str());
+                    }
+                }
+
+                task->Complete(*this, err);
+
                 registry.Release(task->GetJobHandle());
                 registry.Release(taskHandle);
             }
@@ -741,6 +955,12 @@ namespace ignite
             return registry;
         }
 
+        void IgniteEnvironment::AwaitContinuousQueryListener(int64_t handle)
+        {
+            if (threadPool)
+                threadPool->Await(handle);
+        }
+
         void IgniteEnvironment::OnStartCallback(int64_t memPtr, jobject proc)
         {
             this->proc = jni::JavaGlobalRef(ctx, proc);
@@ -768,13 +988,29 @@ namespace ignite
 
             int64_t qryHandle = reader.ReadInt64();
 
-            ContinuousQueryImplBase* contQry = reinterpret_cast<ContinuousQueryImplBase*>(registry.Get(qryHandle).Get());
+            SharedPointer<void> contQry = registry.Get(qryHandle);
+
+            if (!contQry.IsValid())
+                return;
+
+            if (threadPool)
+            {
+                // Java memory is only valid during the callback, so events are copied.
+                int32_t len = mem.Get()->Length();
+
+                SharedPointer<InteropMemory> copy = AllocateMemory(len);
 
-            if (contQry)
+                memcpy(copy.Get()->Data(), mem.Get()->Data(), len);
+                copy.Get()->Length(len);
+
+                // Events of the same query are processed by the same worker to keep the order.
+                threadPool->Dispatch(qryHandle, SP_ThreadPoolTask(new ContinuousQueryListenerTask(registry, qryHandle, copy)));
+            }
+            else
             {
                 BinaryRawReader rawReader(&reader);
 
-                contQry->ReadAndProcessEvents(rawReader);
+                static_cast<ContinuousQueryImplBase*>(contQry.Get())->ReadAndProcessEvents(rawReader);
             }
         }
 
@@ -996,5 +1232,47 @@ namespace ignite
 
             outStream.Synchronize();
         }
+
+        void IgniteEnvironment::OnDataStreamerTopologyUpdate(int64_t handle, int64_t topVer, int32_t topSize)
+        {
+            SharedPointer<datastreamer::DataStreamerTopology> top =
+                StaticPointerCast<datastreamer::DataStreamerTopology>(registry.Get(handle));
+
+            if (top.Get())
+                top.Get()->Update(topVer, topSize);
+        }
+
+        void IgniteEnvironment::OnDataStreamerStreamReceiverInvoke(SharedPointer<InteropMemory>& mem)
+        {
+            if (!binding.Get())
+                throw IgniteError(IgniteError::IGNITE_ERR_UNKNOWN, "IgniteBinding is not initialized.");
+
+            InteropInputStream inStream(mem.Get());
+            BinaryReaderImpl reader(&inStream);
+
+            InteropOutputStream outStream(mem.Get());
+            BinaryWriterImpl writer(&outStream, GetTypeManager());
+
+            // Native receiver pointer and keep binary flag.
+            reader.ReadInt64();
+            reader.ReadBool();
+
+            BinaryObjectImpl binRcvHolder = BinaryObjectImpl::FromMemory(*mem.Get(), inStream.Position(), 0);
+            BinaryObjectImpl binRcv = binRcvHolder.GetField(0);
+
+            int32_t rcvId = binRcv.GetTypeId();
+
+            bool invoked = false;
+
+            binding.Get()->InvokeCallback(invoked,
+                IgniteBindingImpl::CallbackType::STREAM_RECEIVER_INVOKE, rcvId, reader, writer);
+
+            if (!invoked)
+            {
+                IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_COMPUTE_USER_UNDECLARED_EXCEPTION,
+                    "C++ stream receiver is not registered on the node (did you compile your program without -rdynamic?).",
+                    "rcvId", rcvId);
+            }
+        }
     }
 }
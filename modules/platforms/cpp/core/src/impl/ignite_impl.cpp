@@ -44,6 +44,7 @@ namespace ignite
                 CREATE_CACHE = 2,
                 GET_OR_CREATE_CACHE = 3,
                 GET_AFFINITY = 7,
+                GET_DATA_STREAMER = 8,
                 GET_TRANSACTIONS = 9,
                 GET_CLUSTER_GROUP = 10,
                 SET_BASELINE_TOPOLOGY_VERSION = 24,
@@ -116,6 +117,40 @@ namespace ignite
             return GetOrCreateCache(name, err, ProcessorOp::CREATE_CACHE);
         }
 
+        datastreamer::DataStreamerImpl* IgniteImpl::GetDataStreamer(const char* cacheName, IgniteError& err)
+        {
+            SharedPointer<InteropMemory> mem = env.Get()->AllocateMemory();
+            InteropMemory* mem0 = mem.Get();
+            InteropOutputStream out(mem0);
+            BinaryWriterImpl writer(&out, env.Get()->GetTypeManager());
+            BinaryRawWriter rawWriter(&writer);
+
+            rawWriter.WriteString(cacheName);
+
+            // Entries are always passed to the Java streamer in binary form.
+            rawWriter.WriteBool(true);
+
+            out.Synchronize();
+
+            jobject streamerJavaRef = InStreamOutObject(ProcessorOp::GET_DATA_STREAMER, *mem0, err);
+
+            if (!streamerJavaRef)
+            {
+                return NULL;
+            }
+
+            try
+            {
+                return new datastreamer::DataStreamerImpl(env, streamerJavaRef, cacheName);
+            }
+            catch (const IgniteError& err0)
+            {
+                err = err0;
+
+                return NULL;
+            }
+        }
+
         IgniteImpl::SP_IgniteBindingImpl IgniteImpl::GetBinding()
         {
             return env.Get()->GetBinding();
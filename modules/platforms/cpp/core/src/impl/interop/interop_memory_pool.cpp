@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+
+#include "ignite/impl/interop/interop_memory_pool.h"
+
+using namespace ignite::common::concurrent;
+
+namespace
+{
+    /** Memory pool of the current thread. */
+    ThreadLocalInstance< SharedPointer<ignite::impl::interop::InteropMemoryPool> > threadPool;
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace interop
+        {
+            InteropPooledMemory::InteropPooledMemory(int32_t cap) :
+                initCap(cap),
+                state(State::FREE)
+            {
+                memPtr = static_cast<int8_t*>(malloc(IGNITE_MEM_HDR_LEN));
+
+                Data(memPtr, malloc(cap));
+                Capacity(memPtr, cap);
+                Length(memPtr, 0);
+                Flags(memPtr, IGNITE_MEM_FLAG_EXT | IGNITE_MEM_FLAG_POOLED);
+            }
+
+            InteropPooledMemory::~InteropPooledMemory()
+            {
+                free(Data());
+                free(memPtr);
+            }
+
+            void InteropPooledMemory::Reallocate(int32_t cap)
+            {
+                int doubledCap = Capacity() << 1;
+
+                if (doubledCap > cap)
+                    cap = doubledCap;
+
+                Data(memPtr, realloc(Data(memPtr), cap));
+                Capacity(memPtr, cap);
+            }
+
+            bool InteropPooledMemory::TryAcquire()
+            {
+                return Atomics::CompareAndSet32(&state, State::FREE, State::ACQUIRED);
+            }
+
+            void InteropPooledMemory::Release()
+            {
+                if (Capacity() > InteropMemoryPool::MAX_POOLED_CAPACITY)
+                {
+                    Data(memPtr, realloc(Data(memPtr), initCap));
+                    Capacity(memPtr, initCap);
+                }
+
+                // Fails only if the pool has been destroyed while the chunk was in use.
+                if (!Atomics::CompareAndSet32(&state, State::ACQUIRED, State::FREE))
+                    delete this;
+            }
+
+            void InteropPooledMemory::Orphan()
+            {
+                // Chunk can only be released concurrently, so failure means it is free.
+                if (!Atomics::CompareAndSet32(&state, State::ACQUIRED, State::ORPHANED))
+                    delete this;
+            }
+
+            InteropMemoryPool::InteropMemoryPool(int32_t initCap) :
+                initCap(initCap)
+            {
+                for (int32_t i = 0; i < MAX_CHUNKS; ++i)
+                    chunks[i] = 0;
+            }
+
+            InteropMemoryPool::~InteropMemoryPool()
+            {
+                for (int32_t i = 0; i < MAX_CHUNKS; ++i)
+                {
+                    if (chunks[i])
+                        chunks[i]->Orphan();
+                }
+            }
+
+            SP_InteropMemory InteropMemoryPool::Allocate(int32_t cap)
+            {
+                InteropPooledMemory* res = 0;
+                int32_t emptyIdx = -1;
+
+                // Prefer the smallest free chunk which fits, then the largest one which does not.
+                for (int32_t i = 0; i < MAX_CHUNKS; ++i)
+                {
+                    InteropPooledMemory* chunk = chunks[i];
+
+                    if (!chunk)
+                    {
+                        if (emptyIdx < 0)
+                            emptyIdx = i;
+
+                        continue;
+                    }
+
+                    if (!chunk->IsFree())
+                        continue;
+
+                    if (!res)
+                    {
+                        res = chunk;
+
+                        continue;
+                    }
+
+                    bool fits = chunk->Capacity() >= cap;
+                    bool resFits = res->Capacity() >= cap;
+
+                    if (fits && (!resFits || chunk->Capacity() < res->Capacity()))
+                        res = chunk;
+                    else if (!fits && !resFits && chunk->Capacity() > res->Capacity())
+                        res = chunk;
+                }
+
+                if (!res || (res->Capacity() < cap && emptyIdx >= 0))
+                {
+                    if (emptyIdx < 0)
+                        return SP_InteropMemory();
+
+                    res = new InteropPooledMemory(initCap);
+
+                    chunks[emptyIdx] = res;
+                }
+
+                res->TryAcquire();
+
+                if (res->Capacity() < cap)
+                    res->Reallocate(cap);
+
+                res->Length(0);
+
+                return SP_InteropMemory(res, &InteropMemoryPool::ReleaseMemory);
+            }
+
+            SP_InteropMemory InteropMemoryPool::AllocateThreadLocal(int32_t cap, int32_t initCap)
+            {
+                SharedPointer<InteropMemoryPool> pool = threadPool.Get();
+
+                if (!pool.IsValid())
+                {
+                    pool = SharedPointer<InteropMemoryPool>(new InteropMemoryPool(initCap));
+
+                    threadPool.Set(pool);
+                }
+
+                return pool.Get()->Allocate(cap);
+            }
+
+            void InteropMemoryPool::ReleaseMemory(InteropMemory* mem)
+            {
+                static_cast<InteropPooledMemory*>(mem)->Release();
+            }
+        }
+    }
+}
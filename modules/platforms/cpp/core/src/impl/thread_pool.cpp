@@ -0,0 +1,205 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/impl/thread_pool.h"
+
+using namespace ignite::common::concurrent;
+
+namespace
+{
+    using namespace ignite::impl;
+
+    /**
+     * Task which lets know that the tasks dispatched before it are executed.
+     */
+    class BarrierTask : public ThreadPoolTask
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param latch Latch to count down.
+         */
+        explicit BarrierTask(SingleLatch& latch) :
+            latch(latch)
+        {
+            // No-op.
+        }
+
+        virtual void Execute()
+        {
+            latch.CountDown();
+        }
+
+    private:
+        /** Latch. */
+        SingleLatch& latch;
+    };
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        ThreadPool::Worker::Worker(ThreadPool& pool) :
+            queue(),
+            cond(),
+            pool(pool)
+        {
+            // No-op.
+        }
+
+        ThreadPool::Worker::~Worker()
+        {
+            // No-op.
+        }
+
+        void ThreadPool::Worker::Run()
+        {
+            pool.current.Set(this);
+
+            while (true)
+            {
+                SP_ThreadPoolTask task = pool.Take(*this);
+
+                if (!task.IsValid())
+                    break;
+
+                ExecuteSafe(task);
+            }
+        }
+
+        ThreadPool::ThreadPool(int32_t size) :
+            lock(),
+            workers(),
+            current(),
+            stopped(false)
+        {
+            workers.reserve(size);
+
+            for (int32_t i = 0; i < size; ++i)
+                workers.push_back(new Worker(*this));
+
+            for (size_t i = 0; i < workers.size(); ++i)
+                workers[i]->Start();
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            Stop();
+
+            for (size_t i = 0; i < workers.size(); ++i)
+                delete workers[i];
+        }
+
+        void ThreadPool::Dispatch(int64_t key, const SP_ThreadPoolTask& task)
+        {
+            {
+                CsLockGuard guard(lock);
+
+                if (!stopped)
+                {
+                    Worker& worker = GetWorker(key);
+
+                    worker.queue.push_back(task);
+
+                    worker.cond.NotifyOne();
+
+                    return;
+                }
+            }
+
+            ExecuteSafe(task);
+        }
+
+        void ThreadPool::Await(int64_t key)
+        {
+            SingleLatch latch;
+
+            {
+                CsLockGuard guard(lock);
+
+                // Workers execute all the dispatched tasks before they stop.
+                if (stopped)
+                    return;
+
+                Worker& worker = GetWorker(key);
+
+                if (current.Get() == &worker)
+                    return;
+
+                worker.queue.push_back(SP_ThreadPoolTask(new BarrierTask(latch)));
+
+                worker.cond.NotifyOne();
+            }
+
+            latch.Await();
+        }
+
+        void ThreadPool::Stop()
+        {
+            {
+                CsLockGuard guard(lock);
+
+                if (stopped)
+                    return;
+
+                stopped = true;
+
+                for (size_t i = 0; i < workers.size(); ++i)
+                    workers[i]->cond.NotifyOne();
+            }
+
+            for (size_t i = 0; i < workers.size(); ++i)
+                workers[i]->Join();
+        }
+
+        SP_ThreadPoolTask ThreadPool::Take(Worker& worker)
+        {
+            CsLockGuard guard(lock);
+
+            while (true)
+            {
+                if (!worker.queue.empty())
+                {
+                    SP_ThreadPoolTask task = worker.queue.front();
+
+                    worker.queue.pop_front();
+
+                    return task;
+                }
+
+                if (stopped)
+                    return SP_ThreadPoolTask();
+
+                worker.cond.Wait(lock);
+            }
+        }
+
+        void ThreadPool::ExecuteSafe(SP_ThreadPoolTask task)
+        {
+            try
+            {
+                task.Get()->Execute();
+            }
+            catch (...)
+            {
+                // No-op.
+            }
+        }
+    }
+}
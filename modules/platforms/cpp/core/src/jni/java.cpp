@@ -248,6 +248,30 @@ namespace ignite
 
             /* HELPER METHODS. */
 
+            /**
+             * Attach current thread to JVM. JNI environment is remembered on the
+             * first attach of the thread, so subsequent calls do not cross into JVM.
+             *
+             * @param jvm JVM.
+             * @return JNI environment or NULL on failure.
+             */
+            JNIEnv* AttachCurrentThread(JavaVM* jvm)
+            {
+                JNIEnv* env = AttachHelper::GetAttachedEnv();
+
+                if (env)
+                    return env;
+
+                jint attachRes = jvm->AttachCurrentThread(reinterpret_cast<void**>(&env), NULL);
+
+                if (attachRes != JNI_OK)
+                    return NULL;
+
+                AttachHelper::OnThreadAttach(env);
+
+                return env;
+            }
+
             /**
              * Throw exception to Java in case of missing callback pointer. It means that callback is not implemented in
              * native platform and Java -> platform operation cannot proceede further. As JniContext is not available at
@@ -687,15 +711,9 @@ namespace ignite
             }
 
             int JniContext::Reallocate(int64_t memPtr, int cap) {
-                JavaVM* jvm = JVM.GetJvm();
+                JNIEnv* env = AttachCurrentThread(JVM.GetJvm());
 
-                JNIEnv* env;
-
-                int attachRes = jvm->AttachCurrentThread(reinterpret_cast<void**>(&env), NULL);
-
-                if (attachRes == JNI_OK)
-                    AttachHelper::OnThreadAttach();
-                else
+                if (!env)
                     return -1;
 
                 env->CallStaticVoidMethod(JVM.GetMembers().c_PlatformUtils, JVM.GetMembers().m_PlatformUtils_reallocate, memPtr, cap);
@@ -929,16 +947,10 @@ namespace ignite
 
                     if (jvm)
                     {
-                        JNIEnv* env;
-
-                        jint attachRes = jvm->AttachCurrentThread(reinterpret_cast<void**>(&env), NULL);
-
-                        if (attachRes == JNI_OK)
-                        {
-                            AttachHelper::OnThreadAttach();
+                        JNIEnv* env = AttachCurrentThread(jvm);
 
+                        if (env)
                             env->DeleteGlobalRef(obj);
-                        }
                     }
                 }
             }
@@ -986,16 +998,10 @@ namespace ignite
              * Attach thread to JVM.
              */
             JNIEnv* JniContext::Attach() {
-                JNIEnv* env;
+                JNIEnv* env = AttachCurrentThread(jvm->GetJvm());
 
-                jint attachRes = jvm->GetJvm()->AttachCurrentThread(reinterpret_cast<void**>(&env), NULL);
-
-                if (attachRes == JNI_OK)
-                    AttachHelper::OnThreadAttach();
-                else {
-                    if (hnds.error)
-                        hnds.error(hnds.target, IGNITE_JNI_ERR_JVM_ATTACH, NULL, 0, NULL, 0, NULL, 0, NULL, 0);
-                }
+                if (!env && hnds.error)
+                    hnds.error(hnds.target, IGNITE_JNI_ERR_JVM_ATTACH, NULL, 0, NULL, 0, NULL, 0, NULL, 0);
 
                 return env;
             }
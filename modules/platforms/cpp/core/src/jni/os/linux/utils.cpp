@@ -70,14 +70,23 @@ namespace ignite
             JniContext::Detach();
         }
         
-        void AttachHelper::OnThreadAttach()
+        void AttachHelper::OnThreadAttach(JNIEnv* env)
         {
             pthread_once(&attachKeyInit, AllocateAttachKey);
             
             void* val = pthread_getspecific(attachKey);
             
             if (!val)
-                pthread_setspecific(attachKey, new AttachHelper());
+                pthread_setspecific(attachKey, new AttachHelper(env));
+        }
+
+        JNIEnv* AttachHelper::GetAttachedEnv()
+        {
+            pthread_once(&attachKeyInit, AllocateAttachKey);
+
+            void* val = pthread_getspecific(attachKey);
+
+            return val ? static_cast<AttachHelper*>(val)->env : NULL;
         }
 
         /**
@@ -45,14 +45,26 @@ namespace ignite
         /** Excluded modules from test classpath. */
         const char* TEST_EXCLUDED_MODULES[] = { "rest-http" };
 
+        /** TLS index of the JNI environment of the attached thread. */
+        static DWORD attachTlsIdx = TLS_OUT_OF_INDEXES;
+
         AttachHelper::~AttachHelper()
         {
             // No-op.
         }
 
-        void AttachHelper::OnThreadAttach()
+        void AttachHelper::OnThreadAttach(JNIEnv* env)
         {
-            // No-op.
+            if (attachTlsIdx != TLS_OUT_OF_INDEXES)
+                TlsSetValue(attachTlsIdx, env);
+        }
+
+        JNIEnv* AttachHelper::GetAttachedEnv()
+        {
+            if (attachTlsIdx == TLS_OUT_OF_INDEXES)
+                return NULL;
+
+            return static_cast<JNIEnv*>(TlsGetValue(attachTlsIdx));
         }
 
         /**
@@ -434,6 +446,8 @@ BOOL WINAPI DllMain(_In_ HINSTANCE hinstDLL, _In_ DWORD fdwReason, _In_ LPVOID l
             if (!ThreadLocal::OnProcessAttach())
                 return FALSE;
 
+            ignite::jni::attachTlsIdx = TlsAlloc();
+
             break;
 
         case DLL_THREAD_DETACH:
@@ -441,11 +455,17 @@ BOOL WINAPI DllMain(_In_ HINSTANCE hinstDLL, _In_ DWORD fdwReason, _In_ LPVOID l
 
             JniContext::Detach();
 
+            if (ignite::jni::attachTlsIdx != TLS_OUT_OF_INDEXES)
+                TlsSetValue(ignite::jni::attachTlsIdx, NULL);
+
             break;
 
         case DLL_PROCESS_DETACH:
             ThreadLocal::OnProcessDetach();
 
+            if (ignite::jni::attachTlsIdx != TLS_OUT_OF_INDEXES)
+                TlsFree(ignite::jni::attachTlsIdx);
+
             break;
 
         default:
@@ -42,8 +42,11 @@ public:
      * Construct new instance of class.
      * @param service Asio service.
      * @param responses Responses to provide to requests.
+     * @param repeatFrom Index of the response to continue from when all responses are provided. If it is not less
+     *     than the number of responses, session is closed instead.
      */
-    TestServerSession(boost::asio::io_service& service, const std::vector< std::vector<int8_t> >& responses);
+    TestServerSession(boost::asio::io_service& service, const std::vector< std::vector<int8_t> >& responses,
+        size_t repeatFrom);
 
     /**
      * Get socket.
@@ -98,13 +101,16 @@ private:
     // The socket used to communicate with the client.
     boost::asio::ip::tcp::socket socket;
 
-    // Received requests.
-    std::vector< std::vector<int8_t> > requests;
+    // Last received request.
+    std::vector<int8_t> request;
 
     // Responses to provide.
     const std::vector< std::vector<int8_t> > responses;
 
-    // Number of requests answered.
+    // Index of the response to continue from when all responses are provided.
+    const size_t repeatFrom;
+
+    // Index of the next response.
     size_t requestsResponded;
 };
 
@@ -147,6 +153,16 @@ public:
         responses.push_back(resp);
     }
 
+    /**
+     * Make sessions provide responses in cycle.
+     * Should be called before server start.
+     * @param idx Index of the response to continue from when all responses are provided.
+     */
+    void SetRepeatFrom(size_t idx)
+    {
+        repeatFrom = idx;
+    }
+
     /**
      * Get specified session.
      * @param idx Index.
@@ -189,6 +205,9 @@ private:
     // Reponses.
     std::vector< std::vector<int8_t> > responses;
 
+    // Index of the response to continue from when all responses are provided.
+    size_t repeatFrom;
+
     // Sessions.
     std::vector< boost::shared_ptr<TestServerSession> > sessions;
 
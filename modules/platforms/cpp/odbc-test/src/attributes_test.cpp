@@ -223,6 +223,28 @@ BOOST_AUTO_TEST_CASE(StatementAttributeQueryTimeout)
     BOOST_REQUIRE_EQUAL(timeout, 7);
 }
 
+BOOST_AUTO_TEST_CASE(StatementAttributeAsyncEnable)
+{
+    Connect("DRIVER={Apache Ignite};address=127.0.0.1:11110;schema=cache");
+
+    SQLULEN async = -1;
+    SQLRETURN ret = SQLGetStmtAttr(stmt, SQL_ATTR_ASYNC_ENABLE, &async, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+    BOOST_REQUIRE_EQUAL(async, SQL_ASYNC_ENABLE_OFF);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_ON), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    async = -1;
+
+    ret = SQLGetStmtAttr(stmt, SQL_ATTR_ASYNC_ENABLE, &async, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+    BOOST_REQUIRE_EQUAL(async, SQL_ASYNC_ENABLE_ON);
+}
+
 BOOST_AUTO_TEST_CASE(ConnectionAttributeConnectionTimeout)
 {
     Connect("DRIVER={Apache Ignite};address=127.0.0.1:11110;schema=cache");
@@ -198,4 +198,86 @@ BOOST_AUTO_TEST_CASE(TestCursorUpdateOneRow)
     BOOST_REQUIRE(!cursor.Increment());
 }
 
+BOOST_AUTO_TEST_CASE(TestCursorHasCachedRows)
+{
+    const int32_t pageSize = 16;
+
+    Cursor cursor(testQueryId);
+
+    BOOST_REQUIRE(!cursor.HasCachedRows(1));
+
+    std::auto_ptr<ResultPage> resultPage = CreateTestPage(false, pageSize);
+
+    cursor.UpdateData(resultPage);
+
+    // First row is current, so the rest of the page can be fetched.
+    BOOST_REQUIRE(cursor.HasCachedRows(pageSize - 1));
+    BOOST_REQUIRE(!cursor.HasCachedRows(pageSize));
+
+    for (int32_t i = 0; i < pageSize - 1; ++i)
+        BOOST_REQUIRE(cursor.Increment());
+
+    BOOST_REQUIRE(!cursor.HasCachedRows(1));
+
+    BOOST_REQUIRE(cursor.Increment());
+
+    resultPage = CreateTestPage(true, pageSize);
+
+    cursor.UpdateData(resultPage);
+
+    // Nothing to request after the last page.
+    BOOST_REQUIRE(cursor.HasCachedRows(pageSize * 2));
+}
+
+BOOST_AUTO_TEST_CASE(TestCursorReleasePage)
+{
+    using namespace ignite::impl::interop;
+
+    const int32_t pageSize = 16;
+
+    Cursor cursor(testQueryId);
+
+    std::auto_ptr<ResultPage> resultPage = CreateTestPage(false, pageSize);
+
+    const int8_t* pageData = resultPage->GetData().Data();
+
+    cursor.UpdateData(resultPage);
+
+    std::auto_ptr<ResultPage> released;
+
+    // Page is not released until it is read to the end.
+    cursor.ReleasePage(released);
+
+    BOOST_REQUIRE(!released.get());
+
+    for (int32_t i = 0; i < pageSize; ++i)
+        BOOST_REQUIRE(cursor.Increment());
+
+    cursor.ReleasePage(released);
+
+    BOOST_REQUIRE(released.get());
+
+    CheckCursorNeedUpdate(cursor);
+
+    // Reading the next page into the released one hands its memory over
+    // to the receive buffer.
+    InteropUnpooledMemory recvMem(1024);
+    InteropOutputStream outStream(&recvMem);
+
+    outStream.WriteBool(true);
+    outStream.WriteInt32(0);
+    outStream.Synchronize();
+
+    InteropInputStream inStream(&recvMem);
+    ignite::impl::binary::BinaryReaderImpl reader(&inStream);
+
+    released->Read(reader);
+
+    BOOST_CHECK(recvMem.Data() == pageData);
+
+    cursor.UpdateData(released);
+
+    BOOST_REQUIRE(!cursor.HasData());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,1394 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ODBC driver benchmark.
+ *
+ * Driver is connected to the TestServer, which replays pre-encoded responses
+ * without doing any work, so the measured time is spent in the driver, the
+ * Driver Manager and the loopback network only.
+ *
+ * Every result is printed to stdout as a single-line JSON object.
+ *
+ * Usage: ignite-odbc-benchmark [--iterations N] [--warmup N] [--port N] [--filter NAME]
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#endif
+
+#include <sql.h>
+#include <sqlext.h>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/chrono.hpp>
+
+#include <ignite/timestamp.h>
+#include <ignite/impl/binary/binary_writer_impl.h>
+
+#include "test_server.h"
+
+using namespace ignite;
+using namespace ignite::impl::binary;
+using namespace ignite::impl::interop;
+
+namespace
+{
+    /** Ignite ODBC protocol request page size. */
+    const int32_t PAGE_SIZE = 1024;
+
+    /** Length of the string values. */
+    const int32_t STRING_LEN = 32;
+
+    /** Application buffer size for the string values. */
+    const SQLLEN STRING_BUFFER_LEN = 64;
+
+    /**
+     * Benchmark options.
+     */
+    struct Options
+    {
+        /** Measured iterations. */
+        int32_t iterations;
+
+        /** Warm-up iterations. */
+        int32_t warmup;
+
+        /** TCP port of the test server. */
+        uint16_t port;
+
+        /** Only benchmarks with names starting with the filter are run. */
+        std::string filter;
+    };
+
+    /**
+     * Column type of the result set.
+     */
+    struct ColumnType
+    {
+        enum Type
+        {
+            LONG,
+
+            DOUBLE,
+
+            STRING,
+
+            TIMESTAMP
+        };
+    };
+
+    /**
+     * Benchmark error.
+     */
+    struct BenchmarkError
+    {
+        BenchmarkError(const std::string& msg) :
+            msg(msg)
+        {
+            // No-op.
+        }
+
+        /** Message. */
+        std::string msg;
+    };
+
+    /**
+     * Encoded response message.
+     */
+    class ResponseBuilder
+    {
+    public:
+        /**
+         * Constructor.
+         * Writes message header and successful status.
+         */
+        ResponseBuilder() :
+            mem(1024),
+            stream(&mem),
+            writer(&stream, 0)
+        {
+            // Message length, written on finish.
+            writer.WriteInt32(0);
+
+            // Response status.
+            writer.WriteInt32(0);
+        }
+
+        /**
+         * Get writer.
+         *
+         * @return Writer.
+         */
+        BinaryWriterImpl& GetWriter()
+        {
+            return writer;
+        }
+
+        /**
+         * Finish message.
+         *
+         * @return Encoded message.
+         */
+        std::vector<int8_t> Finish()
+        {
+            stream.WriteInt32(0, stream.Position() - 4);
+            stream.Synchronize();
+
+            return std::vector<int8_t>(mem.Data(), mem.Data() + mem.Length());
+        }
+
+    private:
+        /** Memory. */
+        InteropUnpooledMemory mem;
+
+        /** Stream. */
+        InteropOutputStream stream;
+
+        /** Writer. */
+        BinaryWriterImpl writer;
+    };
+
+    /**
+     * Write string the way the server does.
+     *
+     * @param writer Writer.
+     * @param str String.
+     */
+    void WriteString(BinaryWriterImpl& writer, const std::string& str)
+    {
+        writer.WriteString(str.data(), static_cast<int32_t>(str.size()));
+    }
+
+    /**
+     * Write column metadata.
+     *
+     * @param writer Writer.
+     * @param name Column name.
+     * @param typeId Column type ID.
+     */
+    void WriteColumnMeta(BinaryWriterImpl& writer, const std::string& name, int8_t typeId)
+    {
+        WriteString(writer, "PUBLIC");
+        WriteString(writer, "BENCH");
+        WriteString(writer, name);
+
+        writer.WriteInt8(typeId);
+
+        // Precision, scale and nullability.
+        writer.WriteInt32(-1);
+        writer.WriteInt32(-1);
+        writer.WriteInt8(1);
+    }
+
+    /**
+     * Get binary type ID for the column type.
+     *
+     * @param type Column type.
+     * @return Type ID.
+     */
+    int8_t GetTypeId(ColumnType::Type type)
+    {
+        switch (type)
+        {
+            case ColumnType::LONG:
+                return IGNITE_TYPE_LONG;
+
+            case ColumnType::DOUBLE:
+                return IGNITE_TYPE_DOUBLE;
+
+            case ColumnType::STRING:
+                return IGNITE_TYPE_STRING;
+
+            case ColumnType::TIMESTAMP:
+            default:
+                return IGNITE_TYPE_TIMESTAMP;
+        }
+    }
+
+    /**
+     * Get ODBC C type for the column type.
+     *
+     * @param type Column type.
+     * @return C type.
+     */
+    SQLSMALLINT GetCType(ColumnType::Type type)
+    {
+        switch (type)
+        {
+            case ColumnType::LONG:
+                return SQL_C_SBIGINT;
+
+            case ColumnType::DOUBLE:
+                return SQL_C_DOUBLE;
+
+            case ColumnType::STRING:
+                return SQL_C_CHAR;
+
+            case ColumnType::TIMESTAMP:
+            default:
+                return SQL_C_TYPE_TIMESTAMP;
+        }
+    }
+
+    /**
+     * Get application buffer element size for the column type.
+     *
+     * @param type Column type.
+     * @return Element size.
+     */
+    SQLLEN GetElementSize(ColumnType::Type type)
+    {
+        switch (type)
+        {
+            case ColumnType::LONG:
+                return sizeof(SQLBIGINT);
+
+            case ColumnType::DOUBLE:
+                return sizeof(SQLDOUBLE);
+
+            case ColumnType::STRING:
+                return STRING_BUFFER_LEN;
+
+            case ColumnType::TIMESTAMP:
+            default:
+                return sizeof(SQL_TIMESTAMP_STRUCT);
+        }
+    }
+
+    /**
+     * Get name of the column type.
+     *
+     * @param type Column type.
+     * @return Name.
+     */
+    const char* GetTypeName(ColumnType::Type type)
+    {
+        switch (type)
+        {
+            case ColumnType::LONG:
+                return "long";
+
+            case ColumnType::DOUBLE:
+                return "double";
+
+            case ColumnType::STRING:
+                return "string";
+
+            case ColumnType::TIMESTAMP:
+            default:
+                return "timestamp";
+        }
+    }
+
+    /**
+     * Make string value of the specified length.
+     *
+     * @param idx Value index.
+     * @return String.
+     */
+    std::string MakeString(int64_t idx)
+    {
+        std::stringstream ss;
+
+        ss << "value_" << idx << '_';
+
+        std::string res = ss.str();
+
+        res.resize(STRING_LEN, 'x');
+
+        return res;
+    }
+
+    /**
+     * Write result set value.
+     *
+     * @param writer Writer.
+     * @param type Column type.
+     * @param idx Row index.
+     */
+    void WriteValue(BinaryWriterImpl& writer, ColumnType::Type type, int64_t idx)
+    {
+        switch (type)
+        {
+            case ColumnType::LONG:
+            {
+                writer.WriteInt8(IGNITE_TYPE_LONG);
+                writer.WriteInt64(idx);
+
+                break;
+            }
+
+            case ColumnType::DOUBLE:
+            {
+                writer.WriteInt8(IGNITE_TYPE_DOUBLE);
+                writer.WriteDouble(idx * 0.5);
+
+                break;
+            }
+
+            case ColumnType::STRING:
+            {
+                WriteString(writer, MakeString(idx));
+
+                break;
+            }
+
+            case ColumnType::TIMESTAMP:
+            default:
+            {
+                writer.WriteTimestamp(Timestamp(1500000000 + idx, static_cast<int32_t>(idx % 1000) * 1000000));
+
+                break;
+            }
+        }
+    }
+
+    /**
+     * Make successful query execution response.
+     *
+     * @param columns Result set columns. Can be empty.
+     * @param affected Affected rows. Negative for the result set.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeExecuteResponse(const std::vector<ColumnType::Type>& columns, int64_t affected)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        // Query ID.
+        writer.WriteInt64(1);
+
+        writer.WriteInt32(static_cast<int32_t>(columns.size()));
+
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            std::stringstream name;
+
+            name << "COL" << i;
+
+            WriteColumnMeta(writer, name.str(), GetTypeId(columns[i]));
+        }
+
+        writer.WriteInt32(1);
+        writer.WriteInt64(affected);
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make result page response.
+     *
+     * @param columns Result set columns.
+     * @param begin Index of the first row.
+     * @param size Page size.
+     * @param last Last page flag.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeFetchResponse(const std::vector<ColumnType::Type>& columns, int64_t begin,
+        int32_t size, bool last)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        // Query ID.
+        writer.WriteInt64(1);
+
+        writer.WriteBool(last);
+        writer.WriteInt32(size);
+
+        for (int64_t row = begin; row < begin + size; ++row)
+        {
+            writer.WriteInt32(static_cast<int32_t>(columns.size()));
+
+            for (size_t i = 0; i < columns.size(); ++i)
+                WriteValue(writer, columns[i], row);
+        }
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make query close response.
+     *
+     * @return Response.
+     */
+    std::vector<int8_t> MakeCloseResponse()
+    {
+        ResponseBuilder rsp;
+
+        // Query ID.
+        rsp.GetWriter().WriteInt64(1);
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make batch execution response.
+     *
+     * @param rows Rows in batch.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeExecuteBatchResponse(int32_t rows)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        // Success flag.
+        writer.WriteBool(true);
+
+        writer.WriteInt32(rows);
+
+        for (int32_t i = 0; i < rows; ++i)
+            writer.WriteInt64(1);
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make streaming batch response.
+     *
+     * @param order Batch order.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeStreamingBatchResponse(int64_t order)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        // Error message and code.
+        writer.WriteNull();
+        writer.WriteInt32(0);
+
+        writer.WriteInt64(order);
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make tables metadata response.
+     *
+     * @param tables Number of tables.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeTablesMetaResponse(int32_t tables)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        writer.WriteInt32(tables);
+
+        for (int32_t i = 0; i < tables; ++i)
+        {
+            std::stringstream name;
+
+            name << "TABLE" << i;
+
+            WriteString(writer, "");
+            WriteString(writer, "PUBLIC");
+            WriteString(writer, name.str());
+            WriteString(writer, "TABLE");
+        }
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Make columns metadata response.
+     *
+     * @param columns Number of columns.
+     * @return Response.
+     */
+    std::vector<int8_t> MakeColumnsMetaResponse(int32_t columns)
+    {
+        ResponseBuilder rsp;
+        BinaryWriterImpl& writer = rsp.GetWriter();
+
+        writer.WriteInt32(columns);
+
+        for (int32_t i = 0; i < columns; ++i)
+        {
+            std::stringstream name;
+
+            name << "COL" << i;
+
+            WriteColumnMeta(writer, name.str(), GetTypeId(static_cast<ColumnType::Type>(i % 4)));
+        }
+
+        return rsp.Finish();
+    }
+
+    /**
+     * Throw error with the diagnostic message of the handle.
+     *
+     * @param ret Return code.
+     * @param handleType Handle type.
+     * @param handle Handle.
+     * @param what Failed operation.
+     */
+    void CheckRet(SQLRETURN ret, SQLSMALLINT handleType, SQLHANDLE handle, const char* what)
+    {
+        if (SQL_SUCCEEDED(ret))
+            return;
+
+        SQLCHAR sqlstate[7] = {};
+        SQLINTEGER nativeCode = 0;
+        SQLCHAR message[1024] = {};
+        SQLSMALLINT messageLen = 0;
+
+        SQLGetDiagRec(handleType, handle, 1, sqlstate, &nativeCode, message, sizeof(message), &messageLen);
+
+        std::stringstream ss;
+
+        ss << what << " failed: " << reinterpret_cast<char*>(sqlstate) << ": " << reinterpret_cast<char*>(message);
+
+        throw BenchmarkError(ss.str());
+    }
+
+    /**
+     * Benchmark result.
+     */
+    class Result
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param name Benchmark name.
+         */
+        Result(const std::string& name) :
+            name(name),
+            params(),
+            latencies(),
+            rows(0)
+        {
+            // No-op.
+        }
+
+        /**
+         * Add benchmark parameter.
+         *
+         * @param key Key.
+         * @param value Value.
+         */
+        template<typename T>
+        void AddParam(const std::string& key, const T& value)
+        {
+            std::stringstream ss;
+
+            ss << ",\"" << key << "\":" << value;
+
+            params += ss.str();
+        }
+
+        /**
+         * Add measured iteration.
+         *
+         * @param latencyUs Iteration latency in microseconds.
+         * @param processedRows Rows processed by iteration.
+         */
+        void AddIteration(double latencyUs, int64_t processedRows)
+        {
+            latencies.push_back(latencyUs);
+
+            rows += processedRows;
+        }
+
+        /**
+         * Print result as JSON object.
+         *
+         * @param os Output stream.
+         */
+        void Print(std::ostream& os)
+        {
+            std::sort(latencies.begin(), latencies.end());
+
+            double total = 0;
+
+            for (size_t i = 0; i < latencies.size(); ++i)
+                total += latencies[i];
+
+            double iterations = static_cast<double>(latencies.size());
+
+            os << "{\"benchmark\":\"" << name << "\"" << params
+               << ",\"iterations\":" << latencies.size()
+               << ",\"rows\":" << rows
+               << ",\"total_us\":" << total
+               << ",\"ops_per_sec\":" << (total > 0 ? iterations * 1e6 / total : 0)
+               << ",\"rows_per_sec\":" << (total > 0 ? rows * 1e6 / total : 0)
+               << ",\"latency_avg_us\":" << (iterations > 0 ? total / iterations : 0)
+               << ",\"latency_p50_us\":" << Percentile(0.5)
+               << ",\"latency_p99_us\":" << Percentile(0.99)
+               << ",\"latency_max_us\":" << (latencies.empty() ? 0 : latencies.back())
+               << "}" << std::endl;
+        }
+
+    private:
+        /**
+         * Get latency percentile. Latencies should be sorted.
+         *
+         * @param p Percentile in range [0, 1].
+         * @return Latency.
+         */
+        double Percentile(double p) const
+        {
+            if (latencies.empty())
+                return 0;
+
+            size_t idx = static_cast<size_t>(p * (latencies.size() - 1) + 0.5);
+
+            return latencies[idx];
+        }
+
+        /** Name. */
+        std::string name;
+
+        /** Parameters as JSON fields. */
+        std::string params;
+
+        /** Latencies. */
+        std::vector<double> latencies;
+
+        /** Processed rows. */
+        int64_t rows;
+    };
+
+    /**
+     * Benchmark. Connects the driver to the test server replaying responses
+     * of a single iteration.
+     */
+    class Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param opts Options.
+         */
+        Benchmark(const Options& opts) :
+            opts(opts),
+            server(opts.port),
+            env(SQL_NULL_HANDLE),
+            dbc(SQL_NULL_HANDLE),
+            stmt(SQL_NULL_HANDLE)
+        {
+            server.PushHandshakeResponse(true);
+            server.SetRepeatFrom(1);
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~Benchmark()
+        {
+            if (stmt != SQL_NULL_HANDLE)
+                SQLFreeHandle(SQL_HANDLE_STMT, stmt);
+
+            if (dbc != SQL_NULL_HANDLE)
+            {
+                SQLDisconnect(dbc);
+
+                SQLFreeHandle(SQL_HANDLE_DBC, dbc);
+            }
+
+            if (env != SQL_NULL_HANDLE)
+                SQLFreeHandle(SQL_HANDLE_ENV, env);
+
+            server.Stop();
+        }
+
+        /**
+         * Run benchmark.
+         *
+         * @param res Result.
+         */
+        void Run(Result& res)
+        {
+            PushResponses(server);
+
+            server.Start();
+
+            Connect();
+
+            Setup();
+
+            for (int32_t i = 0; i < opts.warmup; ++i)
+                Iteration();
+
+            for (int32_t i = 0; i < opts.iterations; ++i)
+            {
+                boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+
+                int64_t rows = Iteration();
+
+                boost::chrono::duration<double, boost::micro> latency = boost::chrono::steady_clock::now() - start;
+
+                res.AddIteration(latency.count(), rows);
+            }
+        }
+
+    protected:
+        /**
+         * Push responses of a single iteration.
+         *
+         * @param srv Server.
+         */
+        virtual void PushResponses(TestServer& srv) = 0;
+
+        /**
+         * Prepare statement before iterations.
+         */
+        virtual void Setup()
+        {
+            // No-op.
+        }
+
+        /**
+         * Run single iteration.
+         *
+         * @return Number of processed rows.
+         */
+        virtual int64_t Iteration() = 0;
+
+        /**
+         * Connect to the test server.
+         */
+        void Connect()
+        {
+            SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &env);
+
+            if (env == SQL_NULL_HANDLE)
+                throw BenchmarkError("Can not allocate environment handle");
+
+            SQLSetEnvAttr(env, SQL_ATTR_ODBC_VERSION, reinterpret_cast<void*>(SQL_OV_ODBC3), 0);
+
+            SQLAllocHandle(SQL_HANDLE_DBC, env, &dbc);
+
+            if (dbc == SQL_NULL_HANDLE)
+                throw BenchmarkError("Can not allocate connection handle");
+
+            std::stringstream connectStr;
+
+            connectStr << "DRIVER={Apache Ignite};ADDRESS=127.0.0.1:" << opts.port
+                       << ";SCHEMA=PUBLIC;PAGE_SIZE=" << PAGE_SIZE;
+
+            std::string connectStr0 = connectStr.str();
+            std::vector<SQLCHAR> buf(connectStr0.begin(), connectStr0.end());
+
+            SQLCHAR outstr[1024];
+            SQLSMALLINT outstrlen;
+
+            SQLRETURN ret = SQLDriverConnect(dbc, NULL, &buf[0], static_cast<SQLSMALLINT>(buf.size()),
+                outstr, sizeof(outstr), &outstrlen, SQL_DRIVER_COMPLETE);
+
+            CheckRet(ret, SQL_HANDLE_DBC, dbc, "SQLDriverConnect");
+
+            SQLAllocHandle(SQL_HANDLE_STMT, dbc, &stmt);
+
+            if (stmt == SQL_NULL_HANDLE)
+                throw BenchmarkError("Can not allocate statement handle");
+        }
+
+        /** Options. */
+        const Options& opts;
+
+        /** Test server. */
+        TestServer server;
+
+        /** Environment handle. */
+        SQLHENV env;
+
+        /** Connection handle. */
+        SQLHDBC dbc;
+
+        /** Statement handle. */
+        SQLHSTMT stmt;
+    };
+
+    /**
+     * SELECT with SQLFetch over the result set.
+     */
+    class FetchBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param opts Options.
+         * @param columns Result set columns.
+         * @param rows Rows in result set.
+         * @param rowsetSize Rows fetched by a single SQLFetch call.
+         */
+        FetchBenchmark(const Options& opts, const std::vector<ColumnType::Type>& columns, int32_t rows,
+            int32_t rowsetSize) :
+            Benchmark(opts),
+            columns(columns),
+            rows(rows),
+            rowsetSize(rowsetSize),
+            buffers(columns.size()),
+            indicators(columns.size())
+        {
+            // No-op.
+        }
+
+    protected:
+        virtual void PushResponses(TestServer& srv)
+        {
+            srv.PushResponse(MakeExecuteResponse(columns, -1));
+
+            for (int32_t begin = 0; begin < rows; begin += PAGE_SIZE)
+            {
+                int32_t size = std::min(PAGE_SIZE, rows - begin);
+
+                srv.PushResponse(MakeFetchResponse(columns, begin, size, begin + size == rows));
+            }
+
+            srv.PushResponse(MakeCloseResponse());
+        }
+
+        virtual void Setup()
+        {
+            SQLRETURN ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                reinterpret_cast<SQLPOINTER>(static_cast<ptrdiff_t>(rowsetSize)), 0);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE)");
+
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                SQLLEN elemSize = GetElementSize(columns[i]);
+
+                buffers[i].resize(static_cast<size_t>(elemSize * rowsetSize));
+                indicators[i].resize(static_cast<size_t>(rowsetSize));
+
+                ret = SQLBindCol(stmt, static_cast<SQLUSMALLINT>(i + 1), GetCType(columns[i]), &buffers[i][0],
+                    elemSize, &indicators[i][0]);
+
+                CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindCol");
+            }
+        }
+
+        virtual int64_t Iteration()
+        {
+            SQLCHAR req[] = "SELECT * FROM BENCH";
+
+            SQLRETURN ret = SQLExecDirect(stmt, req, SQL_NTS);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLExecDirect");
+
+            int64_t fetches = 0;
+
+            while ((ret = SQLFetch(stmt)) != SQL_NO_DATA)
+            {
+                CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLFetch");
+
+                ++fetches;
+            }
+
+            if (fetches != (rows + rowsetSize - 1) / rowsetSize)
+                throw BenchmarkError("Unexpected number of fetched rowsets");
+
+            ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLFreeStmt(SQL_CLOSE)");
+
+            return rows;
+        }
+
+    private:
+        /** Result set columns. */
+        std::vector<ColumnType::Type> columns;
+
+        /** Rows in result set. */
+        int32_t rows;
+
+        /** Rowset size. */
+        int32_t rowsetSize;
+
+        /** Column buffers. */
+        std::vector< std::vector<int8_t> > buffers;
+
+        /** Column indicators. */
+        std::vector< std::vector<SQLLEN> > indicators;
+    };
+
+    /**
+     * INSERT with arrays of parameters bound with SQLBindParameter.
+     */
+    class BatchBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param opts Options.
+         * @param paramsetSize Parameter set size.
+         */
+        BatchBenchmark(const Options& opts, int32_t paramsetSize) :
+            Benchmark(opts),
+            paramsetSize(paramsetSize),
+            keys(paramsetSize),
+            strs(static_cast<size_t>(paramsetSize * STRING_BUFFER_LEN)),
+            strLens(paramsetSize)
+        {
+            for (int32_t i = 0; i < paramsetSize; ++i)
+            {
+                keys[i] = i;
+
+                std::string str = MakeString(i);
+
+                memcpy(&strs[i * STRING_BUFFER_LEN], str.data(), str.size());
+
+                strLens[i] = static_cast<SQLLEN>(str.size());
+            }
+        }
+
+    protected:
+        virtual void PushResponses(TestServer& srv)
+        {
+            // Single parameter set is executed as a regular query.
+            if (paramsetSize == 1)
+            {
+                srv.PushResponse(MakeExecuteResponse(std::vector<ColumnType::Type>(), 1));
+
+                return;
+            }
+
+            for (int32_t begin = 0; begin < paramsetSize; begin += PAGE_SIZE)
+                srv.PushResponse(MakeExecuteBatchResponse(std::min(PAGE_SIZE, paramsetSize - begin)));
+        }
+
+        virtual void Setup()
+        {
+            SQLCHAR req[] = "INSERT INTO BENCH(_KEY, STR) VALUES(?, ?)";
+
+            SQLRETURN ret = SQLPrepare(stmt, req, SQL_NTS);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLPrepare");
+
+            ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_BIGINT, 0, 0, &keys[0], 0, 0);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindParameter");
+
+            ret = SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, STRING_BUFFER_LEN, 0,
+                &strs[0], STRING_BUFFER_LEN, &strLens[0]);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindParameter");
+
+            ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAMSET_SIZE,
+                reinterpret_cast<SQLPOINTER>(static_cast<ptrdiff_t>(paramsetSize)), 0);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLSetStmtAttr(SQL_ATTR_PARAMSET_SIZE)");
+        }
+
+        virtual int64_t Iteration()
+        {
+            SQLRETURN ret = SQLExecute(stmt);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLExecute");
+
+            ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLFreeStmt(SQL_CLOSE)");
+
+            return paramsetSize;
+        }
+
+    private:
+        /** Parameter set size. */
+        int32_t paramsetSize;
+
+        /** Keys. */
+        std::vector<SQLBIGINT> keys;
+
+        /** Strings. */
+        std::vector<SQLCHAR> strs;
+
+        /** String lengths. */
+        std::vector<SQLLEN> strLens;
+    };
+
+    /**
+     * INSERTs in streaming mode.
+     */
+    class StreamingBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param opts Options.
+         * @param rows Rows inserted by iteration.
+         * @param batchSize Streaming batch size. Should divide rows.
+         */
+        StreamingBenchmark(const Options& opts, int32_t rows, int32_t batchSize) :
+            Benchmark(opts),
+            rows(rows),
+            batchSize(batchSize),
+            key(0),
+            str(),
+            strLen(0)
+        {
+            // No-op.
+        }
+
+    protected:
+        virtual void PushResponses(TestServer& srv)
+        {
+            // SET STREAMING ON.
+            srv.PushResponse(MakeExecuteResponse(std::vector<ColumnType::Type>(), 0));
+
+            int32_t batches = rows / batchSize;
+
+            // Full batches and the last one sent by SET STREAMING OFF.
+            for (int32_t i = 0; i <= batches; ++i)
+                srv.PushResponse(MakeStreamingBatchResponse(i));
+        }
+
+        virtual void Setup()
+        {
+            std::string val = MakeString(0);
+
+            memset(str, 0, sizeof(str));
+            memcpy(str, val.data(), val.size());
+
+            strLen = static_cast<SQLLEN>(val.size());
+
+            SQLRETURN ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_BIGINT, 0, 0, &key, 0, 0);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindParameter");
+
+            ret = SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(str), 0,
+                str, sizeof(str), &strLen);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindParameter");
+        }
+
+        virtual int64_t Iteration()
+        {
+            std::stringstream streamingOn;
+
+            streamingOn << "SET STREAMING ON BATCH_SIZE " << batchSize;
+
+            std::string streamingOn0 = streamingOn.str();
+            std::vector<SQLCHAR> req(streamingOn0.begin(), streamingOn0.end());
+
+            SQLRETURN ret = SQLExecDirect(stmt, &req[0], static_cast<SQLINTEGER>(req.size()));
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLExecDirect(SET STREAMING ON)");
+
+            SQLCHAR insertReq[] = "INSERT INTO BENCH(_KEY, STR) VALUES(?, ?)";
+
+            ret = SQLPrepare(stmt, insertReq, SQL_NTS);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLPrepare");
+
+            for (int32_t i = 0; i < rows; ++i)
+            {
+                key = i;
+
+                ret = SQLExecute(stmt);
+
+                CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLExecute");
+            }
+
+            SQLCHAR offReq[] = "SET STREAMING OFF";
+
+            ret = SQLExecDirect(stmt, offReq, SQL_NTS);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLExecDirect(SET STREAMING OFF)");
+
+            return rows;
+        }
+
+    private:
+        /** Rows inserted by iteration. */
+        int32_t rows;
+
+        /** Streaming batch size. */
+        int32_t batchSize;
+
+        /** Key parameter. */
+        SQLBIGINT key;
+
+        /** String parameter. */
+        SQLCHAR str[STRING_BUFFER_LEN];
+
+        /** String parameter length. */
+        SQLLEN strLen;
+    };
+
+    /**
+     * SQLTables or SQLColumns with SQLFetch over the result.
+     */
+    class MetadataBenchmark : public Benchmark
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param opts Options.
+         * @param columns Use SQLColumns if @c true and SQLTables otherwise.
+         * @param rows Rows in result.
+         */
+        MetadataBenchmark(const Options& opts, bool columns, int32_t rows) :
+            Benchmark(opts),
+            columns(columns),
+            rows(rows)
+        {
+            // No-op.
+        }
+
+    protected:
+        virtual void PushResponses(TestServer& srv)
+        {
+            if (columns)
+                srv.PushResponse(MakeColumnsMetaResponse(rows));
+            else
+                srv.PushResponse(MakeTablesMetaResponse(rows));
+        }
+
+        virtual void Setup()
+        {
+            SQLRETURN ret = SQLBindCol(stmt, 3, SQL_C_CHAR, name, sizeof(name), &nameLen);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLBindCol");
+        }
+
+        virtual int64_t Iteration()
+        {
+            SQLCHAR empty[] = "";
+            SQLCHAR schema[] = "PUBLIC";
+            SQLCHAR any[] = "%";
+
+            SQLRETURN ret;
+
+            if (columns)
+                ret = SQLColumns(stmt, empty, SQL_NTS, schema, SQL_NTS, any, SQL_NTS, any, SQL_NTS);
+            else
+                ret = SQLTables(stmt, empty, SQL_NTS, schema, SQL_NTS, any, SQL_NTS, empty, SQL_NTS);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, columns ? "SQLColumns" : "SQLTables");
+
+            int64_t fetched = 0;
+
+            while ((ret = SQLFetch(stmt)) != SQL_NO_DATA)
+            {
+                CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLFetch");
+
+                ++fetched;
+            }
+
+            ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+            CheckRet(ret, SQL_HANDLE_STMT, stmt, "SQLFreeStmt(SQL_CLOSE)");
+
+            return fetched;
+        }
+
+    private:
+        /** Use SQLColumns. */
+        bool columns;
+
+        /** Rows in result. */
+        int32_t rows;
+
+        /** Name column buffer. */
+        SQLCHAR name[STRING_BUFFER_LEN];
+
+        /** Name column length. */
+        SQLLEN nameLen;
+    };
+
+    /**
+     * Check if the benchmark should be run.
+     *
+     * @param opts Options.
+     * @param name Benchmark name.
+     * @return @c true if the benchmark should be run.
+     */
+    bool Selected(const Options& opts, const std::string& name)
+    {
+        return name.compare(0, opts.filter.size(), opts.filter) == 0;
+    }
+
+    /**
+     * Run benchmark and print its result.
+     *
+     * @param bench Benchmark.
+     * @param res Result.
+     * @return @c true on success.
+     */
+    bool RunAndPrint(Benchmark& bench, Result& res)
+    {
+        try
+        {
+            bench.Run(res);
+        }
+        catch (const BenchmarkError& err)
+        {
+            std::cerr << err.msg << std::endl;
+
+            return false;
+        }
+
+        res.Print(std::cout);
+
+        return true;
+    }
+
+    /**
+     * Parse options.
+     *
+     * @param argc Arguments number.
+     * @param argv Arguments.
+     * @param opts Options.
+     * @return @c true on success.
+     */
+    bool ParseOptions(int argc, char** argv, Options& opts)
+    {
+        opts.iterations = 100;
+        opts.warmup = 10;
+        opts.port = 11120;
+
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string key(argv[i]);
+            const char* val = argv[i + 1];
+
+            if (key == "--iterations")
+                opts.iterations = std::atoi(val);
+            else if (key == "--warmup")
+                opts.warmup = std::atoi(val);
+            else if (key == "--port")
+                opts.port = static_cast<uint16_t>(std::atoi(val));
+            else if (key == "--filter")
+                opts.filter = val;
+            else
+                return false;
+        }
+
+        return argc % 2 == 1 && opts.iterations > 0 && opts.warmup >= 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    if (!ParseOptions(argc, argv, opts))
+    {
+        std::cerr << "Usage: " << argv[0] << " [--iterations N] [--warmup N] [--port N] [--filter NAME]"
+                  << std::endl;
+
+        return 1;
+    }
+
+    bool success = true;
+
+    const ColumnType::Type allTypes[] = {
+        ColumnType::LONG,
+        ColumnType::DOUBLE,
+        ColumnType::STRING,
+        ColumnType::TIMESTAMP
+    };
+
+    const int32_t rowsetSizes[] = { 1, 16, 256 };
+
+    const int32_t fetchRows = 10000;
+
+    for (size_t t = 0; t < sizeof(allTypes) / sizeof(allTypes[0]); ++t)
+    {
+        for (size_t r = 0; r < sizeof(rowsetSizes) / sizeof(rowsetSizes[0]); ++r)
+        {
+            if (!Selected(opts, "fetch"))
+                continue;
+
+            std::vector<ColumnType::Type> columns(4, allTypes[t]);
+
+            FetchBenchmark bench(opts, columns, fetchRows, rowsetSizes[r]);
+
+            Result res("fetch");
+
+            res.AddParam("columns", std::string("\"") + GetTypeName(allTypes[t]) + "\"");
+            res.AddParam("columns_num", columns.size());
+            res.AddParam("rowset_size", rowsetSizes[r]);
+
+            success &= RunAndPrint(bench, res);
+        }
+    }
+
+    const int32_t paramsetSizes[] = { 1, 64, 1024, 8192 };
+
+    for (size_t p = 0; p < sizeof(paramsetSizes) / sizeof(paramsetSizes[0]); ++p)
+    {
+        if (!Selected(opts, "batch"))
+            continue;
+
+        BatchBenchmark bench(opts, paramsetSizes[p]);
+
+        Result res("batch");
+
+        res.AddParam("paramset_size", paramsetSizes[p]);
+
+        success &= RunAndPrint(bench, res);
+    }
+
+    const int32_t streamingBatchSizes[] = { 64, 1024 };
+
+    for (size_t b = 0; b < sizeof(streamingBatchSizes) / sizeof(streamingBatchSizes[0]); ++b)
+    {
+        if (!Selected(opts, "streaming"))
+            continue;
+
+        StreamingBenchmark bench(opts, 8192, streamingBatchSizes[b]);
+
+        Result res("streaming");
+
+        res.AddParam("batch_size", streamingBatchSizes[b]);
+
+        success &= RunAndPrint(bench, res);
+    }
+
+    if (Selected(opts, "tables"))
+    {
+        MetadataBenchmark bench(opts, false, 100);
+
+        Result res("tables");
+
+        success &= RunAndPrint(bench, res);
+    }
+
+    if (Selected(opts, "columns"))
+    {
+        MetadataBenchmark bench(opts, true, 100);
+
+        Result res("columns");
+
+        success &= RunAndPrint(bench, res);
+    }
+
+    return success ? 0 : 1;
+}
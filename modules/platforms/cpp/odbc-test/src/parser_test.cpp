@@ -75,7 +75,12 @@ BOOST_AUTO_TEST_CASE(TestParserEncodeDecode)
 
     parser.Encode(outMsg, buffer);
 
-    parser.Decode(inMsg, buffer);
+    ignite::impl::interop::InteropUnpooledMemory mem(static_cast<int32_t>(buffer.size()));
+
+    memcpy(mem.Data(), &buffer[0], buffer.size());
+    mem.Length(static_cast<int32_t>(buffer.size()));
+
+    parser.Decode(inMsg, mem);
 
     BOOST_REQUIRE(outMsg == inMsg);
 }
@@ -1210,6 +1210,189 @@ BOOST_AUTO_TEST_CASE(TestNotFullInsertBatchSelect4096)
     InsertNonFullBatchSelect(4096, 1024);
 }
 
+BOOST_AUTO_TEST_CASE(TestInsertBatchNullIndicators)
+{
+    Connect("DRIVER={Apache Ignite};ADDRESS=127.0.0.1:11110;SCHEMA=cache");
+
+    const SQLINTEGER recordsNum = 100;
+
+    SQLBIGINT keys[recordsNum];
+    SQLCHAR strFields[recordsNum][ODBC_BUFFER_SIZE];
+    SQLLEN strFieldsInd[recordsNum];
+
+    for (SQLINTEGER i = 0; i < recordsNum; ++i)
+    {
+        keys[i] = i;
+
+        std::string val = "str" + LexicalCast<std::string>(i);
+        strncpy(reinterpret_cast<char*>(strFields[i]), val.c_str(), ODBC_BUFFER_SIZE);
+
+        strFieldsInd[i] = i % 3 ? SQL_NTS : SQL_NULL_DATA;
+    }
+
+    SQLCHAR request[] = "INSERT INTO TestType(_key, strField) VALUES(?, ?)";
+
+    SQLRETURN ret = SQLPrepare(stmt, request, SQL_NTS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_BIGINT, 0, 0, keys, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, ODBC_BUFFER_SIZE, 0,
+        strFields, ODBC_BUFFER_SIZE, strFieldsInd);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(recordsNum), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLExecute(stmt);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(1), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLBIGINT key = 0;
+    SQLCHAR strField[ODBC_BUFFER_SIZE];
+    SQLLEN strFieldInd = 0;
+
+    ret = SQLBindCol(stmt, 1, SQL_C_SBIGINT, &key, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindCol(stmt, 2, SQL_C_CHAR, strField, ODBC_BUFFER_SIZE, &strFieldInd);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLCHAR selectReq[] = "SELECT _key, strField FROM TestType ORDER BY _key";
+
+    ret = SQLExecDirect(stmt, selectReq, SQL_NTS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    for (SQLINTEGER i = 0; i < recordsNum; ++i)
+    {
+        ret = SQLFetch(stmt);
+
+        ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+        BOOST_CHECK_EQUAL(key, i);
+
+        if (i % 3)
+            BOOST_CHECK_EQUAL(std::string(reinterpret_cast<char*>(strField)), "str" + LexicalCast<std::string>(i));
+        else
+            BOOST_CHECK_EQUAL(strFieldInd, SQL_NULL_DATA);
+    }
+
+    ret = SQLFetch(stmt);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_NO_DATA);
+}
+
+BOOST_AUTO_TEST_CASE(TestInsertBatchBindOffset)
+{
+    Connect("DRIVER={Apache Ignite};ADDRESS=127.0.0.1:11110;SCHEMA=cache");
+
+    const SQLINTEGER recordsNum = 100;
+
+    // Bound buffers start with the stale values which are skipped by the offset.
+    SQLULEN offset = ODBC_BUFFER_SIZE;
+
+    std::vector<SQLBIGINT> keys(offset / sizeof(SQLBIGINT) + recordsNum, -1);
+    std::vector<SQLCHAR> strFields(offset + recordsNum * ODBC_BUFFER_SIZE, 'x');
+    std::vector<SQLLEN> strFieldsInd(offset / sizeof(SQLLEN) + recordsNum, SQL_NULL_DATA);
+
+    for (SQLINTEGER i = 0; i < recordsNum; ++i)
+    {
+        keys[offset / sizeof(SQLBIGINT) + i] = i;
+
+        std::string val = "str" + LexicalCast<std::string>(i);
+        strncpy(reinterpret_cast<char*>(&strFields[offset + i * ODBC_BUFFER_SIZE]), val.c_str(), ODBC_BUFFER_SIZE);
+
+        strFieldsInd[offset / sizeof(SQLLEN) + i] = SQL_NTS;
+    }
+
+    SQLCHAR request[] = "INSERT INTO TestType(_key, strField) VALUES(?, ?)";
+
+    SQLRETURN ret = SQLPrepare(stmt, request, SQL_NTS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_BIGINT, 0, 0, &keys[0], 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, ODBC_BUFFER_SIZE, 0,
+        &strFields[0], ODBC_BUFFER_SIZE, &strFieldsInd[0]);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, &offset, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(recordsNum), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLExecute(stmt);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(1), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLBIGINT key = 0;
+    SQLCHAR strField[ODBC_BUFFER_SIZE];
+    SQLLEN strFieldInd = 0;
+
+    ret = SQLBindCol(stmt, 1, SQL_C_SBIGINT, &key, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    ret = SQLBindCol(stmt, 2, SQL_C_CHAR, strField, ODBC_BUFFER_SIZE, &strFieldInd);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLCHAR selectReq[] = "SELECT _key, strField FROM TestType ORDER BY _key";
+
+    ret = SQLExecDirect(stmt, selectReq, SQL_NTS);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    for (SQLINTEGER i = 0; i < recordsNum; ++i)
+    {
+        ret = SQLFetch(stmt);
+
+        ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+        BOOST_CHECK_EQUAL(key, i);
+        BOOST_CHECK_EQUAL(std::string(reinterpret_cast<char*>(strField)), "str" + LexicalCast<std::string>(i));
+    }
+
+    ret = SQLFetch(stmt);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_NO_DATA);
+}
+
 template<size_t n, size_t k>
 void CheckMeta(char columns[n][k], SQLLEN columnsLen[n])
 {
@@ -2244,4 +2427,125 @@ BOOST_AUTO_TEST_CASE(TestManyCursorsSelectMerge2)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestAsyncExecution)
+{
+    Connect("DRIVER={Apache Ignite};ADDRESS=127.0.0.1:11110;SCHEMA=cache");
+
+    for (int64_t i = 0; i < 10; ++i)
+        cache1.Put(i, TestType(1, 2, static_cast<int32_t>(i), 4, "5", 6.0f, 7.0, true, Guid(8, 9),
+            MakeDateGmt(1987, 6, 5), MakeTimeGmt(12, 48, 12), MakeTimestampGmt(1998, 12, 27, 1, 2, 3, 456)));
+
+    SQLRETURN ret = SQLSetStmtAttr(stmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_ON), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLINTEGER i32Field = -1;
+
+    ret = SQLBindCol(stmt, 1, SQL_C_SLONG, &i32Field, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLCHAR request[] = "SELECT i32Field FROM TestType ORDER BY i32Field";
+
+    do
+        ret = SQLExecDirect(stmt, request, SQL_NTS);
+    while (ret == SQL_STILL_EXECUTING);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    for (SQLINTEGER i = 0; i < 10; ++i)
+    {
+        do
+            ret = SQLFetch(stmt);
+        while (ret == SQL_STILL_EXECUTING);
+
+        ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+        BOOST_CHECK_EQUAL(i32Field, i);
+    }
+
+    do
+        ret = SQLFetch(stmt);
+    while (ret == SQL_STILL_EXECUTING);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_NO_DATA);
+}
+
+BOOST_AUTO_TEST_CASE(TestAsyncExecutionPending)
+{
+    Connect("DRIVER={Apache Ignite};ADDRESS=127.0.0.1:11110;SCHEMA=cache");
+
+    cache1.Put(1, TestType(1, 2, 3, 4, "5", 6.0f, 7.0, true, Guid(8, 9), MakeDateGmt(1987, 6, 5),
+        MakeTimeGmt(12, 48, 12), MakeTimestampGmt(1998, 12, 27, 1, 2, 3, 456)));
+
+    SQLRETURN ret = SQLSetStmtAttr(stmt, SQL_ATTR_ASYNC_ENABLE, reinterpret_cast<SQLPOINTER>(SQL_ASYNC_ENABLE_ON), 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    SQLCHAR request[] = "SELECT i32Field FROM TestType";
+
+    ret = SQLExecDirect(stmt, request, SQL_NTS);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_STILL_EXECUTING);
+
+    // Operation stays pending until its result is retrieved, whether it is complete or not.
+    SQLINTEGER i32Field = -1;
+    SQLLEN i32FieldLen = 0;
+
+    ret = SQLGetData(stmt, 1, SQL_C_SLONG, &i32Field, 0, &i32FieldLen);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    ret = SQLBindCol(stmt, 1, SQL_C_SLONG, &i32Field, 0, 0);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    ret = SQLMoreResults(stmt);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    SQLLEN affected = 0;
+
+    ret = SQLRowCount(stmt, &affected);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    ret = SQLFetch(stmt);
+
+    BOOST_REQUIRE_EQUAL(ret, SQL_ERROR);
+    CheckSQLStatementDiagnosticError("HY010");
+
+    do
+        ret = SQLExecDirect(stmt, request, SQL_NTS);
+    while (ret == SQL_STILL_EXECUTING);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    // Statement functions are available again once the result is retrieved.
+    ret = SQLBindCol(stmt, 1, SQL_C_SLONG, &i32Field, 0, 0);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    do
+        ret = SQLFetch(stmt);
+    while (ret == SQL_STILL_EXECUTING);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+
+    BOOST_CHECK_EQUAL(i32Field, 3);
+
+    ret = SQLFreeStmt(stmt, SQL_CLOSE);
+
+    ODBC_FAIL_ON_ERROR(ret, SQL_HANDLE_STMT, stmt);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
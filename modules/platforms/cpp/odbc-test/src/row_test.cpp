@@ -21,6 +21,7 @@
 
 #include "ignite/odbc/diagnostic/diagnosable_adapter.h"
 #include "ignite/odbc/system/odbc_constants.h"
+#include "ignite/odbc/result_page.h"
 #include "ignite/odbc/row.h"
 
 using namespace ignite::odbc::app;
@@ -36,14 +37,21 @@ std::string GetStrColumnValue(size_t rowIdx)
     return generator.str();
 }
 
-void FillMemWithData(ignite::impl::interop::InteropUnpooledMemory& mem, size_t rowNum)
+void FillPageWithData(ResultPage& page, size_t rowNum)
 {
     using namespace ignite::impl::binary;
     using namespace ignite::impl::interop;
-    
+
+    InteropUnpooledMemory mem(4096);
     InteropOutputStream stream(&mem);
     BinaryWriterImpl writer(&stream, 0);
 
+    // Last page flag.
+    writer.WriteBool(true);
+
+    // Page size.
+    writer.WriteInt32(static_cast<int32_t>(rowNum));
+
     for (size_t i = 0; i < rowNum; ++i)
     {
         // Number of columns in page.
@@ -69,6 +77,13 @@ void FillMemWithData(ignite::impl::interop::InteropUnpooledMemory& mem, size_t r
     }
 
     stream.Synchronize();
+
+    InteropInputStream inStream(&mem);
+    BinaryReaderImpl reader(&inStream);
+
+    page.Read(reader);
+
+    BOOST_REQUIRE_EQUAL(page.GetIndexedRowsNum(), static_cast<int32_t>(rowNum));
 }
 
 void CheckRowData(Row& row, size_t rowIdx)
@@ -126,13 +141,13 @@ BOOST_AUTO_TEST_SUITE(RowTestSuite)
 
 BOOST_AUTO_TEST_CASE(TestRowMoveToNext)
 {
-    ignite::impl::interop::InteropUnpooledMemory mem(4096);
+    ResultPage page;
 
     const size_t rowNum = 32;
 
-    FillMemWithData(mem, rowNum);
+    FillPageWithData(page, rowNum);
 
-    Row row(mem);
+    Row row(page);
 
     for (size_t i = 0; i < rowNum - 1; ++i)
     {
@@ -142,17 +157,53 @@ BOOST_AUTO_TEST_CASE(TestRowMoveToNext)
     }
 
     BOOST_REQUIRE(row.GetSize() == 4);
+
+    BOOST_REQUIRE(!row.MoveToNext());
+}
+
+BOOST_AUTO_TEST_CASE(TestRowReadReverseColumnOrder)
+{
+    ResultPage page;
+
+    const size_t rowNum = 4;
+
+    FillPageWithData(page, rowNum);
+
+    Row row(page);
+
+    for (size_t i = 0; i < rowNum; ++i)
+    {
+        SqlLen reslen;
+
+        char bitBuf;
+        SQLINTEGER longBuf;
+
+        ApplicationDataBuffer appBitBuf(type_traits::OdbcNativeType::AI_BIT, &bitBuf, sizeof(bitBuf), &reslen);
+        ApplicationDataBuffer appLongBuf(type_traits::OdbcNativeType::AI_SIGNED_LONG, &longBuf, sizeof(longBuf),
+            &reslen);
+
+        BOOST_REQUIRE(row.ReadColumnToBuffer(4, appBitBuf) == ConversionResult::AI_SUCCESS);
+        BOOST_REQUIRE_EQUAL(static_cast<size_t>(bitBuf), i % 2);
+
+        BOOST_REQUIRE(row.ReadColumnToBuffer(1, appLongBuf) == ConversionResult::AI_SUCCESS);
+        BOOST_REQUIRE_EQUAL(static_cast<size_t>(longBuf), i * 10);
+
+        BOOST_REQUIRE(row.ReadColumnToBuffer(5, appLongBuf) == ConversionResult::AI_FAILURE);
+
+        if (i + 1 < rowNum)
+            BOOST_REQUIRE(row.MoveToNext());
+    }
 }
 
 BOOST_AUTO_TEST_CASE(TestRowRead)
 {
-    ignite::impl::interop::InteropUnpooledMemory mem(4096);
+    ResultPage page;
 
     const size_t rowNum = 8;
 
-    FillMemWithData(mem, rowNum);
+    FillPageWithData(page, rowNum);
 
-    Row row(mem);
+    Row row(page);
 
     BOOST_REQUIRE(row.GetSize() == 4);
 
@@ -168,11 +219,11 @@ BOOST_AUTO_TEST_CASE(TestRowRead)
 
 BOOST_AUTO_TEST_CASE(TestSingleRow)
 {
-    ignite::impl::interop::InteropUnpooledMemory mem(4096);
+    ResultPage page;
 
-    FillMemWithData(mem, 1);
+    FillPageWithData(page, 1);
 
-    Row row(mem);
+    Row row(page);
 
     BOOST_REQUIRE(row.GetSize() == 4);
 
@@ -181,11 +232,11 @@ BOOST_AUTO_TEST_CASE(TestSingleRow)
 
 BOOST_AUTO_TEST_CASE(TestTwoRows)
 {
-    ignite::impl::interop::InteropUnpooledMemory mem(4096);
+    ResultPage page;
 
-    FillMemWithData(mem, 2);
+    FillPageWithData(page, 2);
 
-    Row row(mem);
+    Row row(page);
 
     BOOST_REQUIRE(row.GetSize() == 4);
 
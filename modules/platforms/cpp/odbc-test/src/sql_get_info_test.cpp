@@ -141,7 +141,7 @@ BOOST_AUTO_TEST_CASE(TestValues)
     CheckStrInfo(SQL_SERVER_NAME, "Apache Ignite");
     CheckStrInfo(SQL_USER_NAME, "apache_ignite_user");
 
-    CheckIntInfo(SQL_ASYNC_MODE, SQL_AM_NONE);
+    CheckIntInfo(SQL_ASYNC_MODE, SQL_AM_STATEMENT);
     CheckIntInfo(SQL_BATCH_ROW_COUNT, SQL_BRC_ROLLED_UP | SQL_BRC_EXPLICIT);
     CheckIntInfo(SQL_BATCH_SUPPORT, SQL_BS_ROW_COUNT_EXPLICIT);
     CheckIntInfo(SQL_BOOKMARK_PERSISTENCE, 0);
@@ -18,6 +18,7 @@
 #include <stdint.h>
 
 #include <vector>
+#include <limits>
 
 #ifdef _MSC_VER
 #   pragma warning(push)
@@ -44,9 +45,11 @@
 namespace ignite
 {
 
-TestServerSession::TestServerSession(boost::asio::io_service& service, const std::vector< std::vector<int8_t> >& responses) :
+TestServerSession::TestServerSession(boost::asio::io_service& service,
+    const std::vector< std::vector<int8_t> >& responses, size_t repeatFrom) :
     socket(service),
     responses(responses),
+    repeatFrom(repeatFrom),
     requestsResponded(0)
 {
     // No-op.
@@ -59,12 +62,9 @@ void TestServerSession::Start()
 
 void TestServerSession::ReadNextRequest()
 {
-    requests.push_back(std::vector<int8_t>());
+    request.resize(4);
 
-    std::vector<int8_t>& newRequest = requests.back();
-    newRequest.resize(4);
-
-    async_read(socket, boost::asio::buffer(newRequest.data(), newRequest.size()),
+    async_read(socket, boost::asio::buffer(request.data(), request.size()),
         boost::bind(&TestServerSession::HandleRequestSizeReceived, this,
             boost::asio::placeholders::error,
             boost::asio::placeholders::bytes_transferred));
@@ -79,16 +79,15 @@ void TestServerSession::HandleRequestSizeReceived(const boost::system::error_cod
         return;
     }
 
-    std::vector<int8_t>& newRequest = requests.back();
     impl::interop::InteropUnpooledMemory mem(4);
     mem.Length(4);
 
-    memcpy(mem.Data(), newRequest.data(), newRequest.size());
+    memcpy(mem.Data(), request.data(), request.size());
     int32_t size = impl::binary::BinaryUtils::ReadInt32(mem, 0);
 
-    newRequest.resize(4 + size);
+    request.resize(4 + size);
 
-    async_read(socket, boost::asio::buffer(newRequest.data() + 4, size),
+    async_read(socket, boost::asio::buffer(request.data() + 4, size),
         boost::bind(&TestServerSession::HandleRequestReceived, this,
             boost::asio::placeholders::error,
             boost::asio::placeholders::bytes_transferred));
@@ -96,6 +95,9 @@ void TestServerSession::HandleRequestSizeReceived(const boost::system::error_cod
 
 void TestServerSession::HandleRequestReceived(const boost::system::error_code& error, size_t bytesTransferred)
 {
+    if (requestsResponded == responses.size() && repeatFrom < responses.size())
+        requestsResponded = repeatFrom;
+
     if (error || !bytesTransferred || requestsResponded == responses.size())
     {
         socket.close();
@@ -127,7 +129,8 @@ void TestServerSession::HandleResponseSent(const boost::system::error_code& erro
 
 
 TestServer::TestServer(uint16_t port) :
-    acceptor(service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port))
+    acceptor(service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
+    repeatFrom(std::numeric_limits<size_t>::max())
 {
     // No-op.
 }
@@ -161,7 +164,7 @@ void TestServer::StartAccept()
     using namespace boost::asio;
 
     boost::shared_ptr<TestServerSession> newSession;
-    newSession.reset(new TestServerSession(service, responses));
+    newSession.reset(new TestServerSession(service, responses, repeatFrom));
 
     acceptor.async_accept(newSession->GetSocket(),
         boost::bind(&TestServer::HandleAccept, this, newSession, placeholders::error));
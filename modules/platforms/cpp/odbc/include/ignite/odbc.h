@@ -58,6 +58,8 @@ namespace ignite
 
     SQLRETURN SQLCloseCursor(SQLHSTMT stmt);
 
+    SQLRETURN SQLCancel(SQLHSTMT stmt);
+
     SQLRETURN SQLDriverConnect(SQLHDBC      conn,
                                SQLHWND      windowHandle,
                                SQLCHAR*     inConnectionString,
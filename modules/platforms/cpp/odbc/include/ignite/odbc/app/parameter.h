@@ -21,6 +21,7 @@
 #include <stdint.h>
 
 #include <map>
+#include <vector>
 
 #include <ignite/impl/binary/binary_writer_impl.h>
 #include <ignite/impl/binary/binary_reader_impl.h>
@@ -83,6 +84,22 @@ namespace ignite
                  */
                 void Write(impl::binary::BinaryWriterImpl& writer, int offset = 0, SqlUlen idx = 0) const;
 
+                /**
+                 * Write parameter values for the rows [begin, end) of the
+                 * array of parameters using provided writer.
+                 *
+                 * Values are written one after another. End position of every
+                 * value in the writer's stream is appended to the rowEnds.
+                 *
+                 * @param writer Writer.
+                 * @param offset Offset for the buffer.
+                 * @param begin Beginning of the interval.
+                 * @param end End of the interval.
+                 * @param rowEnds End positions of the written values.
+                 */
+                void WriteColumn(impl::binary::BinaryWriterImpl& writer, int offset, SqlUlen begin, SqlUlen end,
+                    std::vector<int32_t>& rowEnds) const;
+
                 /**
                  * Get data buffer.
                  *
@@ -256,6 +256,18 @@ namespace ignite
                  */
                 void WriteRow(impl::binary::BinaryWriterImpl& writer, SqlUlen idx) const;
 
+                /**
+                 * Write rows of the param set in interval [begin, end) using provided writer.
+                 *
+                 * Every bound parameter array is encoded in a single pass and
+                 * then rows are assembled from the encoded values.
+                 *
+                 * @param writer Writer.
+                 * @param begin Beginning of the interval.
+                 * @param end End of the interval.
+                 */
+                void WriteColumns(impl::binary::BinaryWriterImpl& writer, SqlUlen begin, SqlUlen end) const;
+
                 IGNITE_NO_COPY_ASSIGNMENT(ParameterSet);
 
                 /** Parameters. */
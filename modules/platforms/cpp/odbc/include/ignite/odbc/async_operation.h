@@ -0,0 +1,249 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _IGNITE_ODBC_ASYNC_OPERATION
+#define _IGNITE_ODBC_ASYNC_OPERATION
+
+#include <stdint.h>
+
+#include <string>
+
+#include <ignite/common/concurrent.h>
+
+#include "ignite/odbc/system/odbc_constants.h"
+#include "ignite/odbc/common_types.h"
+#include "ignite/odbc/diagnostic/diagnostic_record_storage.h"
+
+namespace ignite
+{
+    namespace odbc
+    {
+        class Statement;
+
+        /**
+         * Statement function that can be executed asynchronously.
+         */
+        struct AsyncFunction
+        {
+            enum Type
+            {
+                /** SQLExecDirect. */
+                EXECUTE_DIRECT,
+
+                /** SQLExecute. */
+                EXECUTE,
+
+                /** SQLFetch. */
+                FETCH,
+
+                /** SQLFetchScroll. */
+                FETCH_SCROLL
+            };
+        };
+
+        /**
+         * Statement function executed in a separate thread.
+         *
+         * Application polls operation by calling the same function again
+         * until it returns anything but SQL_STILL_EXECUTING.
+         *
+         * Diagnostic records produced while the operation runs are collected
+         * by the operation itself, as the statement records may be read by the
+         * application at the same time. They are passed to the statement once
+         * the operation is complete.
+         */
+        class AsyncOperation : protected common::concurrent::Thread
+        {
+        public:
+            /**
+             * Constructor.
+             *
+             * @param statement Statement.
+             * @param function Function to execute.
+             */
+            AsyncOperation(Statement& statement, AsyncFunction::Type function);
+
+            /**
+             * Destructor.
+             * Waits for the operation to complete.
+             */
+            virtual ~AsyncOperation();
+
+            /**
+             * Set query for the SQLExecDirect.
+             *
+             * @param sql Query.
+             */
+            void SetQuery(const std::string& sql)
+            {
+                query = sql;
+            }
+
+            /**
+             * Get query.
+             *
+             * @return Query.
+             */
+            const std::string& GetQuery() const
+            {
+                return query;
+            }
+
+            /**
+             * Set fetch orientation for the SQLFetchScroll.
+             *
+             * @param fetchOrientation Fetch orientation.
+             * @param fetchOffset Fetch offset.
+             */
+            void SetFetchOrientation(int16_t fetchOrientation, int64_t fetchOffset)
+            {
+                orientation = fetchOrientation;
+                offset = fetchOffset;
+            }
+
+            /**
+             * Get fetch orientation.
+             *
+             * @return Fetch orientation.
+             */
+            int16_t GetFetchOrientation() const
+            {
+                return orientation;
+            }
+
+            /**
+             * Get fetch offset.
+             *
+             * @return Fetch offset.
+             */
+            int64_t GetFetchOffset() const
+            {
+                return offset;
+            }
+
+            /**
+             * Get executed function.
+             *
+             * @return Function.
+             */
+            AsyncFunction::Type GetFunction() const
+            {
+                return function;
+            }
+
+            /**
+             * Add status record produced by the operation.
+             *
+             * @param rec Record.
+             */
+            void AddStatusRecord(const diagnostic::DiagnosticRecord& rec)
+            {
+                records.AddStatusRecord(rec);
+            }
+
+            /**
+             * Get diagnostic records produced by the operation.
+             * Should only be called once the operation is complete.
+             *
+             * @return Diagnostic records.
+             */
+            const diagnostic::DiagnosticRecordStorage& GetDiagnosticRecords() const
+            {
+                return records;
+            }
+
+            /**
+             * Start operation.
+             */
+            void Start0();
+
+            /**
+             * Cancel operation.
+             * Operation is not interrupted, but its result is discarded.
+             */
+            void Cancel();
+
+            /**
+             * Check whether the operation is canceled.
+             *
+             * @return @c true if canceled.
+             */
+            bool IsCanceled() const;
+
+            /**
+             * Check whether the operation is complete.
+             *
+             * @return @c true if complete.
+             */
+            bool IsCompleted() const;
+
+            /**
+             * Wait for the operation to complete and get its result.
+             *
+             * @return Operation result.
+             */
+            SqlResult::Type Wait();
+
+        private:
+            IGNITE_NO_COPY_ASSIGNMENT(AsyncOperation);
+
+            /**
+             * Run thread.
+             */
+            virtual void Run();
+
+            /** Statement. */
+            Statement& statement;
+
+            /** Function. */
+            AsyncFunction::Type function;
+
+            /** Query. */
+            std::string query;
+
+            /** Fetch orientation. */
+            int16_t orientation;
+
+            /** Fetch offset. */
+            int64_t offset;
+
+            /** Diagnostic records produced by the operation. */
+            diagnostic::DiagnosticRecordStorage records;
+
+            /** Result. */
+            SqlResult::Type result;
+
+            /** Started flag. */
+            bool started;
+
+            /** Completed flag. */
+            bool completed;
+
+            /** Canceled flag. */
+            bool canceled;
+
+            /** Joined flag. */
+            bool joined;
+
+            /** Mutex for the flags. */
+            mutable common::concurrent::CriticalSection mutex;
+        };
+    }
+}
+
+#endif //_IGNITE_ODBC_ASYNC_OPERATION
@@ -66,6 +66,18 @@ namespace ignite
              */
             Column(ignite::impl::binary::BinaryReaderImpl& reader);
 
+            /**
+             * Skip column data without decoding it.
+             *
+             * Stream should be positioned at the column header. On success
+             * stream is positioned right after the column data.
+             *
+             * @param stream Stream to use.
+             * @return True on success and false if the column can not be
+             * skipped (unknown type or not enough data).
+             */
+            static bool Skip(ignite::impl::interop::InteropInputStream& stream);
+
             /**
              * Get column size in bytes.
              *
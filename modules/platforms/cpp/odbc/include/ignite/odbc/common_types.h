@@ -48,7 +48,10 @@ namespace ignite
                 AI_NO_DATA,
 
                 /** No more data. */
-                AI_NEED_DATA
+                AI_NEED_DATA,
+
+                /** Asynchronous operation is still executing. */
+                AI_STILL_EXECUTING
             };
         };
 
@@ -180,6 +183,9 @@ namespace ignite
                 /** Function sequence error. */
                 SHY010_SEQUENCE_ERROR,
 
+                /** Invalid attribute value. */
+                SHY024_INVALID_ATTRIBUTE_VALUE,
+
                 /**
                  * Invalid string or buffer length
                  */
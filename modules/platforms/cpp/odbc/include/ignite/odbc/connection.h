@@ -22,6 +22,7 @@
 
 #include <vector>
 
+#include <ignite/common/concurrent.h>
 #include <ignite/network/socket_client.h>
 
 #include "ignite/odbc/parser.h"
@@ -148,12 +149,16 @@ namespace ignite
             /**
              * Receive next message.
              *
-             * @param msg Buffer for message.
+             * Memory is only grown when the message does not fit and is never
+             * zero-initialized, so the same memory can be reused as a receive
+             * buffer across messages.
+             *
+             * @param msg Memory for message.
              * @param timeout Timeout.
              * @return @c true on success, @c false on timeout.
              * @throw OdbcError on error.
              */
-            bool Receive(std::vector<int8_t>& msg, int32_t timeout);
+            bool Receive(impl::interop::InteropUnpooledMemory& msg, int32_t timeout);
 
             /**
              * Get name of the assotiated schema.
@@ -211,6 +216,8 @@ namespace ignite
             template<typename ReqT, typename RspT>
             bool SyncMessage(const ReqT& req, RspT& rsp, int32_t timeout)
             {
+                common::concurrent::CsLockGuard lock(ioMutex);
+
                 EnsureConnected();
 
                 std::vector<int8_t> tempBuffer;
@@ -222,12 +229,12 @@ namespace ignite
                 if (!success)
                     return false;
 
-                success = Receive(tempBuffer, timeout);
+                success = Receive(recvMem, timeout);
 
                 if (!success)
                     return false;
 
-                parser.Decode(rsp, tempBuffer);
+                parser.Decode(rsp, recvMem);
 
                 return true;
             }
@@ -243,6 +250,8 @@ namespace ignite
             template<typename ReqT, typename RspT>
             void SyncMessage(const ReqT& req, RspT& rsp)
             {
+                common::concurrent::CsLockGuard lock(ioMutex);
+
                 EnsureConnected();
 
                 std::vector<int8_t> tempBuffer;
@@ -254,12 +263,12 @@ namespace ignite
                 if (!success)
                     throw OdbcError(SqlState::SHYT01_CONNECTION_TIMEOUT, "Send operation timed out");
 
-                success = Receive(tempBuffer, timeout);
+                success = Receive(recvMem, timeout);
 
                 if (!success)
                     throw OdbcError(SqlState::SHYT01_CONNECTION_TIMEOUT, "Receive operation timed out");
 
-                parser.Decode(rsp, tempBuffer);
+                parser.Decode(rsp, recvMem);
             }
 
             /**
@@ -272,6 +281,8 @@ namespace ignite
             template<typename ReqT>
             void SendRequest(const ReqT& req)
             {
+                common::concurrent::CsLockGuard lock(ioMutex);
+
                 EnsureConnected();
 
                 std::vector<int8_t> tempBuffer;
@@ -346,12 +357,12 @@ namespace ignite
                 if (!success)
                     return false;
 
-                success = Receive(tempBuffer, timeout);
+                success = Receive(recvMem, timeout);
 
                 if (!success)
                     return false;
 
-                parser.Decode(rsp, tempBuffer);
+                parser.Decode(rsp, recvMem);
 
                 return true;
             }
@@ -529,6 +540,12 @@ namespace ignite
             /** Message parser. */
             Parser parser;
 
+            /** Receive buffer. Reused across messages. */
+            impl::interop::InteropUnpooledMemory recvMem;
+
+            /** I/O mutex. Serializes messages of statements executed in different threads. */
+            common::concurrent::CriticalSection ioMutex;
+
             /** Configuration. */
             config::Configuration config;
 
@@ -69,6 +69,15 @@ namespace ignite
              */
             bool HasData() const;
 
+            /**
+             * Check if the specified number of next rows can be read without
+             * data update.
+             *
+             * @param rowsNum Number of rows.
+             * @return True if the rows are received or there are no more rows.
+             */
+            bool HasCachedRows(int64_t rowsNum) const;
+
             /**
              * Check whether cursor closed remotely.
              *
@@ -93,6 +102,16 @@ namespace ignite
              */
             void UpdateData(std::auto_ptr<ResultPage>& newPage);
 
+            /**
+             * Release current page if it has been read to the end and is not
+             * the last one. The page can be reused to read the next page, so
+             * the receive buffer gets the memory of the released page.
+             *
+             * @param page Released page. Left unchanged if the page can not
+             *     be released.
+             */
+            void ReleasePage(std::auto_ptr<ResultPage>& page);
+
             /**
              * Get current row.
              *
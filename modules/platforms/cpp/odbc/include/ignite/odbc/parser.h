@@ -49,7 +49,6 @@ namespace ignite
              */
             Parser(int32_t cap = DEFAULT_MEM_ALLOCATION) :
                 protocolVer(ProtocolVersion::GetCurrent()),
-                inMem(cap),
                 outMem(cap),
                 outStream(&outMem)
             {
@@ -87,25 +86,20 @@ namespace ignite
             }
 
             /**
-             * Decode message from data in buffer.
+             * Decode message from data in memory.
+             *
+             * Message is decoded in place. Decoded message can take
+             * ownership of the memory (see ResultPage::Read()).
              *
              * @param msg Message to decode.
-             * @param buf Data buffer.
-             * @note Can be optimized after InteropMemory refactoring.
+             * @param mem Memory containing message data.
              */
             template<typename MsgT>
-            void Decode(MsgT& msg, const std::vector<int8_t>& buf)
+            void Decode(MsgT& msg, impl::interop::InteropUnpooledMemory& mem)
             {
                 using namespace impl::binary;
 
-                if (inMem.Capacity() < static_cast<int32_t>(buf.size()))
-                    inMem.Reallocate(static_cast<int32_t>(buf.size()));
-
-                memcpy(inMem.Data(), buf.data(), buf.size());
-
-                inMem.Length(static_cast<int32_t>(buf.size()));
-
-                impl::interop::InteropInputStream inStream(&inMem);
+                impl::interop::InteropInputStream inStream(&mem);
 
                 BinaryReaderImpl reader(&inStream);
 
@@ -138,9 +132,6 @@ namespace ignite
             /** Protocol version. */
             ProtocolVersion protocolVer;
 
-            /** Input operational memory. */
-            impl::interop::InteropUnpooledMemory inMem;
-
             /** Output operational memory. */
             impl::interop::InteropUnpooledMemory outMem;
 
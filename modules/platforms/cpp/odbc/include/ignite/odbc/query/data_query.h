@@ -99,6 +99,15 @@ namespace ignite
                  */
                 virtual bool DataAvailable() const;
 
+                /**
+                 * Check if the specified number of next rows can be fetched
+                 * without a request to the server.
+                 *
+                 * @param rowsNum Number of rows.
+                 * @return True if no request to the server is needed.
+                 */
+                virtual bool IsFetchLocal(int64_t rowsNum) const;
+
                 /**
                  * Get number of rows affected by the statement.
                  *
@@ -129,6 +129,20 @@ namespace ignite
                  */
                 virtual bool DataAvailable() const = 0;
 
+                /**
+                 * Check if the specified number of next rows can be fetched
+                 * without a request to the server.
+                 *
+                 * @param rowsNum Number of rows.
+                 * @return True if no request to the server is needed.
+                 */
+                virtual bool IsFetchLocal(int64_t rowsNum) const
+                {
+                    IGNITE_UNUSED(rowsNum);
+
+                    return true;
+                }
+
                 /**
                  * Get number of rows affected by the statement.
                  *
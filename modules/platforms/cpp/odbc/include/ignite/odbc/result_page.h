@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include <ignite/impl/binary/binary_reader_impl.h>
 
 #include "ignite/odbc/app/application_data_buffer.h"
@@ -49,6 +51,11 @@ namespace ignite
             
             /**
              * Read result page using provided reader.
+             *
+             * If the reader memory is owning, page takes ownership of it and
+             * uses row data in place, giving its previous memory in return.
+             * Otherwise row data is copied.
+             *
              * @param reader Reader.
              */
             void Read(ignite::impl::binary::BinaryReaderImpl& reader);
@@ -73,6 +80,10 @@ namespace ignite
 
             /**
              * Get page data.
+             *
+             * Row data does not necessarily start at the beginning of the
+             * memory. Use GetColumnPosition() to locate data.
+             *
              * @return Page data.
              */
             ignite::impl::interop::InteropUnpooledMemory& GetData()
@@ -80,9 +91,52 @@ namespace ignite
                 return data;
             }
 
+            /**
+             * Get number of indexed rows.
+             *
+             * Can be less than page size only if the page data is malformed.
+             *
+             * @return Number of indexed rows.
+             */
+            int32_t GetIndexedRowsNum() const
+            {
+                return static_cast<int32_t>(rowIndex.size()) - 1;
+            }
+
+            /**
+             * Get size of the row in columns.
+             *
+             * @param rowIdx Row index. Indexing starts at 0.
+             * @return Row size in columns.
+             */
+            int32_t GetRowSize(int32_t rowIdx) const;
+
+            /**
+             * Get position of the column data in the page.
+             *
+             * @param rowIdx Row index. Indexing starts at 0.
+             * @param columnIdx Column index. Indexing starts at 1.
+             * @return Position of the column header in the page data or -1
+             *  if the column can not be found.
+             */
+            int32_t GetColumnPosition(int32_t rowIdx, int32_t columnIdx) const
+            {
+                int32_t idx = rowIndex[rowIdx] + columnIdx;
+
+                if (columnIdx < 1 || idx >= rowIndex[rowIdx + 1])
+                    return -1;
+
+                return columnIndex[idx];
+            }
+
         private:
             IGNITE_NO_COPY_ASSIGNMENT(ResultPage);
 
+            /**
+             * Build row and column offset index for the page data.
+             */
+            void BuildIndex();
+
             /** Last page flag. */
             bool last;
 
@@ -91,6 +145,22 @@ namespace ignite
 
             /** Memory that contains current row page data. */
             ignite::impl::interop::InteropUnpooledMemory data;
+
+            /** Position of the first row in the page data. */
+            int32_t startPos;
+
+            /**
+             * Index of the first entry of every row in the columnIndex.
+             * Contains additional trailing element so the entries of the
+             * row are always in [rowIndex[i], rowIndex[i + 1]).
+             */
+            std::vector<int32_t> rowIndex;
+
+            /**
+             * Positions in the page data. For every row contains position
+             * of the row header followed by positions of the row columns.
+             */
+            std::vector<int32_t> columnIndex;
         };
     }
 }
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ignite/odbc/column.h"
+#include "ignite/odbc/result_page.h"
 #include "ignite/odbc/app/application_data_buffer.h"
 
 
@@ -31,6 +32,10 @@ namespace ignite
     {
         /**
          * Query result row.
+         *
+         * Row does not parse column data by itself, but uses offset index
+         * built by the result page, so any column of the row can be reached
+         * directly. Columns are only constructed when accessed.
          */
         class Row
         {
@@ -38,9 +43,9 @@ namespace ignite
             /**
              * Constructor.
              *
-             * @param pageData Page data.
+             * @param page Result page.
              */
-            Row(ignite::impl::interop::InteropUnpooledMemory& pageData);
+            Row(ResultPage& page);
 
             /**
              * Destructor.
@@ -77,48 +82,30 @@ namespace ignite
             IGNITE_NO_COPY_ASSIGNMENT(Row);
 
             /**
-             * Reinitialize row state using stream data.
-             * @note Stream must be positioned at the beginning of the row.
+             * Reinitialize row state for the current row index.
              */
             void Reinit();
 
             /**
-             * Get columns by its index.
+             * Get column by its index.
              *
-             * Column indexing starts at 1.
-             *
-             * @note This operation is private because it's unsafe to use:
-             *       It is neccessary to ensure that column is discovered prior
-             *       to calling this method using EnsureColumnDiscovered().
-             *
-             * @param columnIdx Column index.
-             * @return Reference to specified column.
-             */
-            Column& GetColumn(uint16_t columnIdx)
-            {
-                return columns[columnIdx - 1];
-            }
-
-            /**
-             * Ensure that column data is discovered.
+             * Column indexing starts at 1. Column is created on first access
+             * within the current row and then reused, so the state of the
+             * partially read column is preserved.
              *
              * @param columnIdx Column index.
-             * @return True if the column is discovered and false if it can not
-             * be discovered.
+             * @return Pointer to the column or null if it can not be found.
              */
-            bool EnsureColumnDiscovered(uint16_t columnIdx);
+            Column* GetColumn(uint16_t columnIdx);
 
-            /** Row position in current page. */
-            int32_t rowBeginPos;
-
-            /** Current position in row. */
-            int32_t pos;
+            /** Row index in current page. */
+            int32_t rowIdx;
 
             /** Row size in columns. */
             int32_t size;
 
-            /** Memory that contains current row data. */
-            ignite::impl::interop::InteropUnpooledMemory& pageData;
+            /** Page that contains the row. */
+            ResultPage& page;
 
             /** Page data input stream. */
             ignite::impl::interop::InteropInputStream stream;
@@ -126,8 +113,11 @@ namespace ignite
             /** Data reader. */
             ignite::impl::binary::BinaryReaderImpl reader;
 
-            /** Columns. */
+            /** Accessed columns indexed by column index. */
             std::vector<Column> columns;
+
+            /** Index of the row each of the columns has been accessed within. */
+            std::vector<int32_t> columnRows;
         };
     }
 }
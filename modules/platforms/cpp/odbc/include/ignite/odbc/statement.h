@@ -29,6 +29,7 @@
 #include "ignite/odbc/app/parameter_set.h"
 #include "ignite/odbc/diagnostic/diagnosable_adapter.h"
 #include "ignite/odbc/common_types.h"
+#include "ignite/odbc/async_operation.h"
 #include "sql/sql_set_streaming_command.h"
 
 namespace ignite
@@ -44,6 +45,7 @@ namespace ignite
         class Statement : public diagnostic::DiagnosableAdapter
         {
             friend class Connection;
+            friend class AsyncOperation;
         public:
             /**
              * Destructor.
@@ -250,6 +252,11 @@ namespace ignite
              */
             void FetchRow();
 
+            /**
+             * Cancel asynchronously executed function.
+             */
+            void Cancel();
+
             /**
              * Get column metadata.
              *
@@ -346,9 +353,84 @@ namespace ignite
             void DescribeParam(int16_t paramNum, int16_t* dataType,
                 SqlUlen* paramSize, int16_t* decimalDigits, int16_t* nullable);
 
+            using diagnostic::DiagnosableAdapter::AddStatusRecord;
+
+            /**
+             * Add new status record.
+             * Records added while asynchronous operation is pending are
+             * collected by the operation. Only the operation thread adds them,
+             * as other calls are rejected until the operation result is
+             * retrieved.
+             *
+             * @param rec Record.
+             */
+            virtual void AddStatusRecord(const diagnostic::DiagnosticRecord& rec);
+
         private:
             IGNITE_NO_COPY_ASSIGNMENT(Statement);
 
+            /**
+             * Check if the call should be processed asynchronously.
+             *
+             * @return @c true if asynchronous execution is enabled or there
+             *  is a pending asynchronous operation.
+             */
+            bool IsAsyncCall() const
+            {
+                return asyncEnabled || asyncOperation.get() != 0;
+            }
+
+            /**
+             * Check if the next fetch can be completed without a request to
+             * the server, so there is no point in executing it asynchronously.
+             *
+             * @return @c true if there is no pending asynchronous operation and
+             *  the rows to fetch are already received.
+             */
+            bool IsFetchLocal() const
+            {
+                return !asyncOperation.get() &&
+                    (!currentQuery.get() || currentQuery->IsFetchLocal(static_cast<int64_t>(rowArraySize)));
+            }
+
+            /**
+             * Check that there is no pending asynchronous operation. Only
+             * the function of the operation, SQLCancel and the diagnostic
+             * functions can be called until the operation result is
+             * retrieved, so otherwise HY010 error is set as the call result.
+             *
+             * @return @c true if the function can be executed.
+             */
+            bool CheckNoAsyncOperation();
+
+            /**
+             * Prepare asynchronous call of the function.
+             *
+             * If there is a pending operation for the function, polls it and
+             * sets its result (or SQL_STILL_EXECUTING) as the call result.
+             * Otherwise creates new operation, which should be configured by
+             * the caller and started with StartAsyncCall().
+             *
+             * @param function Function.
+             * @return New operation to start or null if the call is already
+             *  processed.
+             */
+            AsyncOperation* PrepareAsyncCall(AsyncFunction::Type function);
+
+            /**
+             * Start prepared asynchronous operation.
+             */
+            void StartAsyncCall();
+
+            /**
+             * Call function of the asynchronous operation.
+             * Called by the operation in a separate thread.
+             *
+             * @param op Operation.
+             * @return Operation result.
+             */
+            SqlResult::Type InternalCallAsyncFunction(const AsyncOperation& op);
+
 
             /**
              * Bind result column to specified data buffer.
@@ -711,6 +793,12 @@ namespace ignite
 
             /** Query timeout in seconds. */
             int32_t timeout;
+
+            /** Asynchronous execution enabled flag. */
+            bool asyncEnabled;
+
+            /** Pending asynchronous operation. */
+            std::auto_ptr<AsyncOperation> asyncOperation;
         };
     }
 }
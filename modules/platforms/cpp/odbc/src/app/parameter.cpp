@@ -21,6 +21,134 @@
 #include "ignite/odbc/app/parameter.h"
 #include "ignite/odbc/utility.h"
 
+namespace
+{
+    using ignite::odbc::SqlLen;
+    using ignite::odbc::SqlUlen;
+    using ignite::odbc::app::ApplicationDataBuffer;
+    using ignite::impl::binary::BinaryWriterImpl;
+
+    /**
+     * Check whether value of any row of the bound array is provided at execution.
+     *
+     * @param buf Buffer pointing to the first value.
+     * @param num Number of values.
+     * @return @c true if any row is data-at-execution.
+     */
+    bool IsAnyDataAtExec(const ApplicationDataBuffer& buf, SqlUlen num)
+    {
+        const SqlLen* resLen = buf.GetResLen();
+
+        if (!resLen)
+            return false;
+
+        for (SqlUlen i = 0; i < num; ++i)
+        {
+            int32_t ilen = static_cast<int32_t>(resLen[i]);
+
+            if (ilen <= SQL_LEN_DATA_AT_EXEC_OFFSET || ilen == SQL_DATA_AT_EXEC)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Write numeric values of the bound array.
+     *
+     * @param writer Writer.
+     * @param buf Buffer pointing to the first value.
+     * @param num Number of values.
+     * @param rowEnds End positions of the written values.
+     */
+    template<typename AppT, typename T>
+    void WriteNumValues(BinaryWriterImpl& writer, const ApplicationDataBuffer& buf, SqlUlen num,
+        std::vector<int32_t>& rowEnds)
+    {
+        const int8_t* data = reinterpret_cast<const int8_t*>(buf.GetData());
+        const SqlLen* resLen = buf.GetResLen();
+        size_t stride = static_cast<size_t>(buf.GetElementSize());
+
+        ignite::impl::interop::InteropOutputStream* stream = writer.GetStream();
+
+        for (SqlUlen i = 0; i < num; ++i)
+        {
+            if (resLen && resLen[i] == SQL_NULL_DATA)
+                writer.WriteNull();
+            else
+                writer.WriteObject<T>(static_cast<T>(*reinterpret_cast<const AppT*>(data + i * stride)));
+
+            rowEnds.push_back(stream->Position());
+        }
+    }
+
+    /**
+     * Write numeric values of the bound array, dispatching on the buffer type once.
+     *
+     * @param writer Writer.
+     * @param buf Buffer pointing to the first value.
+     * @param num Number of values.
+     * @param rowEnds End positions of the written values.
+     * @return @c true if values were written and @c false if the buffer type
+     *  is not supported.
+     */
+    template<typename T>
+    bool WriteNumColumn(BinaryWriterImpl& writer, const ApplicationDataBuffer& buf, SqlUlen num,
+        std::vector<int32_t>& rowEnds)
+    {
+        using ignite::odbc::type_traits::OdbcNativeType;
+
+        switch (buf.GetType())
+        {
+            case OdbcNativeType::AI_SIGNED_TINYINT:
+                WriteNumValues<signed char, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_BIT:
+            case OdbcNativeType::AI_UNSIGNED_TINYINT:
+                WriteNumValues<unsigned char, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_SIGNED_SHORT:
+                WriteNumValues<SQLSMALLINT, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_UNSIGNED_SHORT:
+                WriteNumValues<SQLUSMALLINT, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_SIGNED_LONG:
+                WriteNumValues<SQLINTEGER, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_UNSIGNED_LONG:
+                WriteNumValues<SQLUINTEGER, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_SIGNED_BIGINT:
+                WriteNumValues<SQLBIGINT, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_UNSIGNED_BIGINT:
+                WriteNumValues<SQLUBIGINT, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_FLOAT:
+                WriteNumValues<SQLREAL, T>(writer, buf, num, rowEnds);
+                return true;
+
+            case OdbcNativeType::AI_DOUBLE:
+                WriteNumValues<SQLDOUBLE, T>(writer, buf, num, rowEnds);
+                return true;
+
+            default:
+                break;
+        }
+
+        return false;
+    }
+}
+
 namespace ignite
 {
     namespace odbc
@@ -78,18 +206,18 @@ namespace ignite
 
             void Parameter::Write(impl::binary::BinaryWriterImpl& writer, int offset, SqlUlen idx) const
             {
-                if (buffer.GetInputSize() == SQL_NULL_DATA)
+                // Buffer to use to get data.
+                ApplicationDataBuffer buf(buffer);
+                buf.SetByteOffset(offset);
+                buf.SetElementOffset(idx);
+
+                if (buf.GetInputSize() == SQL_NULL_DATA)
                 {
                     writer.WriteNull();
 
                     return;
                 }
 
-                // Buffer to use to get data.
-                ApplicationDataBuffer buf(buffer);
-                buf.SetByteOffset(offset);
-                buf.SetElementOffset(idx);
-
                 SqlLen storedDataLen = static_cast<SqlLen>(storedData.size());
 
                 if (buffer.IsDataAtExec())
@@ -211,6 +339,90 @@ namespace ignite
                 }
             }
 
+            void Parameter::WriteColumn(impl::binary::BinaryWriterImpl& writer, int offset, SqlUlen begin,
+                SqlUlen end, std::vector<int32_t>& rowEnds) const
+            {
+                ApplicationDataBuffer buf(buffer);
+                buf.SetByteOffset(offset);
+                buf.SetElementOffset(begin);
+
+                SqlUlen num = end - begin;
+
+                if (buf.GetData() && !IsAnyDataAtExec(buf, num))
+                {
+
+                    switch (sqlType)
+                    {
+                        case SQL_TINYINT:
+                        {
+                            if (WriteNumColumn<int8_t>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_BIT:
+                        {
+                            // Wider values are truncated to a byte before the check, so only byte types are taken.
+                            if (buf.GetElementSize() == 1 && WriteNumColumn<bool>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_SMALLINT:
+                        {
+                            if (WriteNumColumn<int16_t>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_INTEGER:
+                        {
+                            if (WriteNumColumn<int32_t>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_BIGINT:
+                        {
+                            if (WriteNumColumn<int64_t>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_FLOAT:
+                        {
+                            if (WriteNumColumn<float>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        case SQL_DOUBLE:
+                        {
+                            if (WriteNumColumn<double>(writer, buf, num, rowEnds))
+                                return;
+
+                            break;
+                        }
+
+                        default:
+                            break;
+                    }
+                }
+
+                for (SqlUlen i = begin; i < end; ++i)
+                {
+                    Write(writer, offset, i);
+
+                    rowEnds.push_back(writer.GetStream()->Position());
+                }
+            }
+
             ApplicationDataBuffer& Parameter::GetBuffer()
             {
                 return buffer;
@@ -216,8 +216,10 @@ namespace ignite
 
                 if (rowLen)
                 {
-                    for (SqlUlen i = begin; i < intervalEnd; ++i)
-                        WriteRow(writer, i);
+                    if (intervalLen > 1)
+                        WriteColumns(writer, begin, intervalEnd);
+                    else
+                        WriteRow(writer, begin);
                 }
             }
 
@@ -244,6 +246,58 @@ namespace ignite
                 }
             }
 
+            void ParameterSet::WriteColumns(impl::binary::BinaryWriterImpl& writer, SqlUlen begin, SqlUlen end) const
+            {
+                using impl::interop::InteropUnpooledMemory;
+                using impl::interop::InteropOutputStream;
+
+                size_t rowsNum = static_cast<size_t>(end - begin);
+                size_t valuesNum = rowsNum * parameters.size();
+
+                int appOffset = paramBindOffset ? *paramBindOffset : 0;
+
+                // Most of the values are primitives of up to eight bytes plus a header.
+                InteropUnpooledMemory mem(static_cast<int32_t>(valuesNum * 9));
+                InteropOutputStream stream(&mem);
+                impl::binary::BinaryWriterImpl columnWriter(&stream, 0);
+
+                // End positions of the encoded values, column by column.
+                std::vector<int32_t> valueEnds;
+                valueEnds.reserve(valuesNum);
+
+                for (ParameterBindingMap::const_iterator it = parameters.begin(); it != parameters.end(); ++it)
+                    it->second.WriteColumn(columnWriter, appOffset, begin, end, valueEnds);
+
+                stream.Synchronize();
+
+                const int8_t* data = mem.Data();
+                InteropOutputStream* out = writer.GetStream();
+
+                for (size_t row = 0; row < rowsNum; ++row)
+                {
+                    uint16_t prev = 0;
+                    size_t valueIdx = row;
+
+                    for (ParameterBindingMap::const_iterator it = parameters.begin(); it != parameters.end(); ++it)
+                    {
+                        uint16_t paramIdx = it->first;
+
+                        while ((paramIdx - prev) > 1)
+                        {
+                            writer.WriteNull();
+                            ++prev;
+                        }
+
+                        int32_t valueBegin = valueIdx ? valueEnds[valueIdx - 1] : 0;
+
+                        out->WriteInt8Array(data + valueBegin, valueEnds[valueIdx] - valueBegin);
+
+                        valueIdx += rowsNum;
+                        prev = paramIdx;
+                    }
+                }
+            }
+
             int32_t ParameterSet::CalculateRowLen() const
             {
                 if (!parameters.empty())
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ignite/odbc/async_operation.h"
+#include "ignite/odbc/statement.h"
+#include "ignite/odbc/log.h"
+
+namespace ignite
+{
+    namespace odbc
+    {
+        AsyncOperation::AsyncOperation(Statement& statement, AsyncFunction::Type function) :
+            statement(statement),
+            function(function),
+            query(),
+            orientation(SQL_FETCH_NEXT),
+            offset(0),
+            records(),
+            result(SqlResult::AI_ERROR),
+            started(false),
+            completed(false),
+            canceled(false),
+            joined(false),
+            mutex()
+        {
+            // No-op.
+        }
+
+        AsyncOperation::~AsyncOperation()
+        {
+            Wait();
+        }
+
+        void AsyncOperation::Start0()
+        {
+            started = true;
+
+            Start();
+        }
+
+        void AsyncOperation::Cancel()
+        {
+            common::concurrent::CsLockGuard lock(mutex);
+
+            canceled = true;
+        }
+
+        bool AsyncOperation::IsCanceled() const
+        {
+            common::concurrent::CsLockGuard lock(mutex);
+
+            return canceled;
+        }
+
+        bool AsyncOperation::IsCompleted() const
+        {
+            common::concurrent::CsLockGuard lock(mutex);
+
+            return completed;
+        }
+
+        SqlResult::Type AsyncOperation::Wait()
+        {
+            if (started && !joined)
+            {
+                Join();
+
+                joined = true;
+            }
+
+            return result;
+        }
+
+        void AsyncOperation::Run()
+        {
+            LOG_MSG("Async operation started: " << function);
+
+            SqlResult::Type res = statement.InternalCallAsyncFunction(*this);
+
+            {
+                common::concurrent::CsLockGuard lock(mutex);
+
+                result = res;
+                completed = true;
+            }
+
+            LOG_MSG("Async operation completed: " << function << ", result: " << res);
+        }
+    }
+}
@@ -230,10 +230,10 @@ namespace ignite
 
                 case IGNITE_TYPE_STRING:
                 {
-                    std::string str;
-                    utility::ReadString(reader, str);
+                    // Reading length without copying the string itself.
+                    sizeTmp = stream->ReadInt32(startPosTmp + 1);
 
-                    sizeTmp = static_cast<int32_t>(str.size());
+                    stream->Position(startPosTmp + 1 + 4 + sizeTmp);
 
                     break;
                 }
@@ -325,6 +325,121 @@ namespace ignite
             size = sizeTmp;
         }
 
+        bool Column::Skip(InteropInputStream& stream)
+        {
+            if (stream.Remaining() < 1)
+                return false;
+
+            int32_t headerPos = stream.Position();
+
+            int8_t hdr = stream.ReadInt8();
+
+            int32_t len = 0;
+
+            switch (hdr)
+            {
+                case IGNITE_HDR_NULL:
+                    break;
+
+                case IGNITE_TYPE_BYTE:
+                case IGNITE_TYPE_BOOL:
+                {
+                    len = 1;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_SHORT:
+                case IGNITE_TYPE_CHAR:
+                {
+                    len = 2;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_INT:
+                case IGNITE_TYPE_FLOAT:
+                {
+                    len = 4;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_LONG:
+                case IGNITE_TYPE_DOUBLE:
+                case IGNITE_TYPE_DATE:
+                case IGNITE_TYPE_TIME:
+                {
+                    len = 8;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_TIMESTAMP:
+                {
+                    len = 12;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_UUID:
+                {
+                    len = 16;
+
+                    break;
+                }
+
+                case IGNITE_TYPE_STRING:
+                case IGNITE_TYPE_ARRAY_BYTE:
+                {
+                    if (stream.Remaining() < 4)
+                        return false;
+
+                    len = stream.ReadInt32();
+
+                    break;
+                }
+
+                case IGNITE_TYPE_DECIMAL:
+                {
+                    if (stream.Remaining() < 8)
+                        return false;
+
+                    // Skipping scale.
+                    stream.Ignore(4);
+
+                    len = stream.ReadInt32();
+
+                    break;
+                }
+
+                case IGNITE_TYPE_BINARY:
+                case IGNITE_TYPE_OBJECT:
+                {
+                    stream.Position(headerPos);
+
+                    // Header field + Length field for binary, header + version + flags + typeId + hash + length
+                    // fields for object.
+                    int32_t minLen = hdr == IGNITE_TYPE_BINARY ? 1 + 4 : 1 + 1 + 2 + 4 + 4 + 4;
+
+                    if (stream.Remaining() < minLen || !GetObjectLength(stream, len))
+                        return false;
+
+                    break;
+                }
+
+                default:
+                    return false;
+            }
+
+            if (len < 0 || stream.Remaining() < len)
+                return false;
+
+            stream.Ignore(len);
+
+            return true;
+        }
+
         app::ConversionResult::Type Column::ReadToBuffer(BinaryReaderImpl& reader, app::ApplicationDataBuffer& dataBuf)
         {
             if (!IsValid())
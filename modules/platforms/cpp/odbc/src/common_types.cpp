@@ -40,6 +40,9 @@ namespace ignite
                 case SqlResult::AI_NEED_DATA:
                     return SQL_NEED_DATA;
 
+                case SqlResult::AI_STILL_EXECUTING:
+                    return SQL_STILL_EXECUTING;
+
                 case SqlResult::AI_ERROR:
                 default:
                     return SQL_ERROR;
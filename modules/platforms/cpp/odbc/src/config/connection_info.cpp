@@ -840,7 +840,7 @@ namespace ignite
                 //    associated with a connection handle can be in asynchronous mode, while other statement handles on
                 //    the same connection are in synchronous mode.
                 // SQL_AM_NONE = Asynchronous mode is not supported.
-                intParams[SQL_ASYNC_MODE] = SQL_AM_NONE;
+                intParams[SQL_ASYNC_MODE] = SQL_AM_STATEMENT;
 #endif // SQL_ASYNC_MODE
 
 #ifdef SQL_ASYNC_NOTIFICATION
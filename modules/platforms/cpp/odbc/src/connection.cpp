@@ -62,6 +62,8 @@ namespace ignite
             loginTimeout(DEFAULT_CONNECT_TIMEOUT),
             autoCommit(true),
             parser(),
+            recvMem(Parser::DEFAULT_MEM_ALLOCATION),
+            ioMutex(),
             config(),
             info(config),
             streamingContext()
@@ -319,12 +321,12 @@ namespace ignite
             return OperationResult::SUCCESS;
         }
 
-        bool Connection::Receive(std::vector<int8_t>& msg, int32_t timeout)
+        bool Connection::Receive(impl::interop::InteropUnpooledMemory& msg, int32_t timeout)
         {
             if (socket.get() == 0)
                 throw OdbcError(SqlState::S08003_NOT_CONNECTED, "Connection is not established");
 
-            msg.clear();
+            msg.Length(0);
 
             OdbcProtocolHeader hdr;
 
@@ -346,9 +348,10 @@ namespace ignite
             if (hdr.len == 0)
                 return false;
 
-            msg.resize(hdr.len);
+            if (msg.Capacity() < hdr.len)
+                msg.Reallocate(hdr.len);
 
-            res = ReceiveAll(&msg[0], hdr.len, timeout);
+            res = ReceiveAll(msg.Data(), hdr.len, timeout);
 
             if (res == OperationResult::TIMEOUT)
                 return false;
@@ -356,8 +359,10 @@ namespace ignite
             if (res == OperationResult::FAIL)
                 throw OdbcError(SqlState::S08S01_LINK_FAILURE, "Can not receive message body");
 
+            msg.Length(hdr.len);
+
 #ifdef PER_BYTE_DEBUG
-            LOG_MSG("Message received: " << common::HexDump(&msg[0], msg.size()));
+            LOG_MSG("Message received: " << common::HexDump(msg.Data(), msg.Length()));
 #endif //PER_BYTE_DEBUG
 
             return true;
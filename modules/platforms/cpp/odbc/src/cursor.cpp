@@ -67,6 +67,12 @@ namespace ignite
                 currentPagePos < currentPage->GetSize();
         }
 
+        bool Cursor::HasCachedRows(int64_t rowsNum) const
+        {
+            return currentPage.get() && (currentPage->IsLast() ||
+                currentPagePos + rowsNum < currentPage->GetSize());
+        }
+
         bool Cursor::IsClosedRemotely() const
         {
             return currentPage.get() && currentPage->IsLast();
@@ -78,7 +84,17 @@ namespace ignite
 
             currentPagePos = 0;
 
-            currentRow.reset(new Row(currentPage->GetData()));
+            currentRow.reset(new Row(*currentPage));
+        }
+
+        void Cursor::ReleasePage(std::auto_ptr<ResultPage>& page)
+        {
+            if (!NeedDataUpdate() || !currentPage.get())
+                return;
+
+            page = currentPage;
+
+            currentPagePos = 0;
         }
 
         Row* Cursor::GetRow()
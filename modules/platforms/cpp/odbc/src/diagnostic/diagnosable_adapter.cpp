@@ -32,15 +32,9 @@ namespace ignite
                 LOG_MSG("Adding new record: " << message << ", rowNum: " << rowNum << ", columnNum: " << columnNum);
 
                 if (connection)
-                {
-                    diagnosticRecords.AddStatusRecord(
-                        connection->CreateStatusRecord(sqlState, message, rowNum, columnNum));
-                }
+                    AddStatusRecord(connection->CreateStatusRecord(sqlState, message, rowNum, columnNum));
                 else
-                {
-                    diagnosticRecords.AddStatusRecord(
-                        DiagnosticRecord(sqlState, message, "", "", rowNum, columnNum));
-                }
+                    AddStatusRecord(DiagnosticRecord(sqlState, message, "", "", rowNum, columnNum));
             }
 
             void DiagnosableAdapter::AddStatusRecord(SqlState::Type  sqlState, const std::string& message)
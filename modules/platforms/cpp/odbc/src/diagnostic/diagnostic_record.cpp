@@ -121,12 +121,18 @@ namespace
     /** SQL state HY004 constant. */
     const std::string STATE_HY004 = "HY004";
 
+    /** SQL state HY008 constant. */
+    const std::string STATE_HY008 = "HY008";
+
     /** SQL state HY009 constant. */
     const std::string STATE_HY009 = "HY009";
 
     /** SQL state HY010 constant. */
     const std::string STATE_HY010 = "HY010";
 
+    /** SQL state HY024 constant. */
+    const std::string STATE_HY024 = "HY024";
+
     /** SQL state HY090 constant. */
     const std::string STATE_HY090 = "HY090";
 
@@ -368,12 +374,18 @@ namespace ignite
                     case SqlState::SHY003_INVALID_APPLICATION_BUFFER_TYPE:
                         return STATE_HY003;
 
+                    case SqlState::SHY008_OPERATION_CANCELED:
+                        return STATE_HY008;
+
                     case SqlState::SHY009_INVALID_USE_OF_NULL_POINTER:
                         return STATE_HY009;
 
                     case SqlState::SHY010_SEQUENCE_ERROR:
                         return STATE_HY010;
 
+                    case SqlState::SHY024_INVALID_ATTRIBUTE_VALUE:
+                        return STATE_HY024;
+
                     case SqlState::SHY090_INVALID_STRING_OR_BUFFER_LENGTH:
                         return STATE_HY090;
 
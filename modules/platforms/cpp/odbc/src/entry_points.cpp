@@ -77,6 +77,11 @@ SQLRETURN SQL_API SQLCloseCursor(SQLHSTMT stmt)
     return ignite::SQLCloseCursor(stmt);
 }
 
+SQLRETURN SQL_API SQLCancel(SQLHSTMT stmt)
+{
+    return ignite::SQLCancel(stmt);
+}
+
 SQLRETURN SQL_API SQLDriverConnect(SQLHDBC      conn,
                                    SQLHWND      windowHandle,
                                    SQLCHAR*     inConnectionString,
@@ -448,14 +453,6 @@ SQLRETURN SQL_API SQLSetConnectAttr(SQLHDBC     conn,
 // ==== Not implemented ====
 //
 
-SQLRETURN SQL_API SQLCancel(SQLHSTMT stmt)
-{
-    IGNITE_UNUSED(stmt);
-
-    LOG_MSG("SQLCancel called");
-    return SQL_SUCCESS;
-}
-
 SQLRETURN SQL_API SQLColAttributes(SQLHSTMT     stmt,
                                    SQLUSMALLINT colNum,
                                    SQLUSMALLINT fieldId,
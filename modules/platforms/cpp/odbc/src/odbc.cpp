@@ -267,6 +267,22 @@ namespace ignite
         return statement->GetDiagnosticRecords().GetReturnCode();
     }
 
+    SQLRETURN SQLCancel(SQLHSTMT stmt)
+    {
+        using odbc::Statement;
+
+        LOG_MSG("SQLCancel called");
+
+        Statement *statement = reinterpret_cast<Statement*>(stmt);
+
+        if (!statement)
+            return SQL_INVALID_HANDLE;
+
+        statement->Cancel();
+
+        return statement->GetDiagnosticRecords().GetReturnCode();
+    }
+
     SQLRETURN SQLDriverConnect(SQLHDBC      conn,
                                SQLHWND      windowHandle,
                                SQLCHAR*     inConnectionString,
@@ -110,11 +110,11 @@ namespace ignite
                     return SqlResult::AI_ERROR;
                 }
 
-                for (int32_t i = 1; i < row->GetSize() + 1; ++i)
+                for (app::ColumnBindingMap::iterator it = columnBindings.begin(); it != columnBindings.end(); ++it)
                 {
-                    app::ColumnBindingMap::iterator it = columnBindings.find(i);
+                    int32_t i = it->first;
 
-                    if (it == columnBindings.end())
+                    if (i < 1 || i > row->GetSize())
                         continue;
 
                     app::ConversionResult::Type convRes = row->ReadColumnToBuffer(i, it->second);
@@ -186,6 +186,15 @@ namespace ignite
                 return cursor.get() && cursor->HasData();
             }
 
+            bool DataQuery::IsFetchLocal(int64_t rowsNum) const
+            {
+                if (!cursor.get() || cursor->HasCachedRows(rowsNum))
+                    return true;
+
+                // First page is received with the execution response.
+                return cachedNextPage.get() && (cachedNextPage->IsLast() || rowsNum <= cachedNextPage->GetSize());
+            }
+
             int64_t DataQuery::AffectedRows() const
             {
                 int64_t affected = rowsAffectedIdx < rowsAffected.size() ? rowsAffected[rowsAffectedIdx] : 0;
@@ -318,7 +327,13 @@ namespace ignite
 
             SqlResult::Type DataQuery::MakeRequestFetch()
             {
-                std::auto_ptr<ResultPage> resultPage(new ResultPage());
+                std::auto_ptr<ResultPage> resultPage;
+
+                // Page read to the end gives its memory to the receive buffer.
+                cursor->ReleasePage(resultPage);
+
+                if (!resultPage.get())
+                    resultPage.reset(new ResultPage());
 
                 QueryFetchRequest req(cursor->GetQueryId(), connection.GetConfiguration().GetPageSize());
                 QueryFetchResponse rsp(*resultPage);
@@ -18,14 +18,41 @@
 #include <ignite/impl/interop/interop_input_stream.h>
 
 #include "ignite/odbc/result_page.h"
+#include "ignite/odbc/column.h"
 #include "ignite/odbc/utility.h"
 
+namespace
+{
+    using namespace ignite::impl::interop;
+
+    /**
+     * Swap ownership of two memory chunks.
+     *
+     * @param mem1 First memory.
+     * @param mem2 Second memory. Should be owning.
+     * @return @c true on success and @c false if the first memory is not
+     *  owning, in which case memory is left untouched.
+     */
+    bool SwapOwnership(InteropUnpooledMemory& mem1, InteropUnpooledMemory& mem2)
+    {
+        InteropUnpooledMemory tmp;
+
+        if (!mem1.TryGetOwnership(tmp))
+            return false;
+
+        mem2.TryGetOwnership(mem1);
+        tmp.TryGetOwnership(mem2);
+
+        return true;
+    }
+}
+
 namespace ignite
 {
     namespace odbc
     {
         ResultPage::ResultPage() :
-            last(false), size(0), data(DEFAULT_ALLOCATED_MEMORY)
+            last(false), size(0), data(DEFAULT_ALLOCATED_MEMORY), startPos(0), rowIndex(1, 0), columnIndex()
         {
             //No-op.
         }
@@ -42,16 +69,82 @@ namespace ignite
 
             impl::interop::InteropInputStream& stream = *reader.GetStream();
 
-            int32_t dataToRead = stream.Remaining();
+            impl::interop::InteropUnpooledMemory* streamMem =
+                const_cast<impl::interop::InteropUnpooledMemory*>(
+                    static_cast<const impl::interop::InteropUnpooledMemory*>(stream.GetMemory()));
 
-            data.Length(dataToRead);
+            if (SwapOwnership(*streamMem, data))
+            {
+                // Page data is used in place, stream memory gets previous page buffer.
+                startPos = stream.Position();
 
-            if (dataToRead)
+                stream.Position(stream.Position() + stream.Remaining());
+            }
+            else
             {
-                data.Reallocate(dataToRead);
+                int32_t dataToRead = stream.Remaining();
+
+                startPos = 0;
+
+                data.Length(dataToRead);
+
+                if (dataToRead)
+                {
+                    data.Reallocate(dataToRead);
 
-                reader.GetStream()->ReadInt8Array(data.Data(), dataToRead);
+                    stream.ReadInt8Array(data.Data(), dataToRead);
+                }
             }
+
+            BuildIndex();
+        }
+
+        int32_t ResultPage::GetRowSize(int32_t rowIdx) const
+        {
+            impl::interop::InteropInputStream stream(&data);
+
+            return stream.ReadInt32(columnIndex[rowIndex[rowIdx]]);
+        }
+
+        void ResultPage::BuildIndex()
+        {
+            rowIndex.clear();
+            columnIndex.clear();
+
+            // Every row takes at least four bytes for its header.
+            if (size > 0 && size <= (data.Length() - startPos) / 4)
+                rowIndex.reserve(size + 1);
+
+            impl::interop::InteropInputStream stream(&data);
+
+            stream.Position(startPos);
+
+            for (int32_t i = 0; i < size; ++i)
+            {
+                if (stream.Remaining() < 4)
+                    break;
+
+                rowIndex.push_back(static_cast<int32_t>(columnIndex.size()));
+                columnIndex.push_back(stream.Position());
+
+                int32_t rowSize = stream.ReadInt32();
+
+                bool valid = true;
+                for (int32_t j = 0; j < rowSize && valid; ++j)
+                {
+                    int32_t columnPos = stream.Position();
+
+                    valid = Column::Skip(stream);
+
+                    if (valid)
+                        columnIndex.push_back(columnPos);
+                }
+
+                if (!valid)
+                    break;
+            }
+
+            rowIndex.push_back(static_cast<int32_t>(columnIndex.size()));
         }
     }
 }
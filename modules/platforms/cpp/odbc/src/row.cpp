@@ -22,14 +22,11 @@ namespace ignite
 {
     namespace odbc
     {
-        Row::Row(ignite::impl::interop::InteropUnpooledMemory& pageData) :
-            rowBeginPos(0), pos(rowBeginPos), size(0), pageData(pageData),
-            stream(&pageData), reader(&stream), columns()
+        Row::Row(ResultPage& page) :
+            rowIdx(0), size(0), page(page), stream(&page.GetData()), reader(&stream), columns(), columnRows()
         {
-            if (pageData.Length() >= 4)
-            {
+            if (page.GetIndexedRowsNum() > 0)
                 Reinit();
-            }
         }
 
         Row::~Row()
@@ -37,61 +34,48 @@ namespace ignite
             // No-op.
         }
 
-        bool Row::EnsureColumnDiscovered(uint16_t columnIdx)
+        Column* Row::GetColumn(uint16_t columnIdx)
         {
-            if (columns.size() >= columnIdx)
-                return true;
-
             if (columnIdx > GetSize() || columnIdx < 1)
-                return false;
-
-            if (columns.empty())
-            {
-                Column newColumn(reader);
+                return 0;
 
-                if (!newColumn.IsValid())
-                    return false;
+            if (columnRows[columnIdx] == rowIdx)
+                return &columns[columnIdx];
 
-                columns.push_back(newColumn);
-            }
+            int32_t columnPos = page.GetColumnPosition(rowIdx, columnIdx);
 
-            while (columns.size() < columnIdx)
-            {
-                Column& column = columns.back();
+            if (columnPos < 0)
+                return 0;
 
-                stream.Position(column.GetEndPosition());
+            stream.Position(columnPos);
 
-                Column newColumn(reader);
+            Column newColumn(reader);
 
-                if (!newColumn.IsValid())
-                    return false;
+            if (!newColumn.IsValid())
+                return 0;
 
-                columns.push_back(newColumn);
-            }
+            columns[columnIdx] = newColumn;
+            columnRows[columnIdx] = rowIdx;
 
-            return true;
+            return &columns[columnIdx];
         }
 
         app::ConversionResult::Type Row::ReadColumnToBuffer(uint16_t columnIdx, app::ApplicationDataBuffer& dataBuf)
         {
-            if (!EnsureColumnDiscovered(columnIdx))
-                return app::ConversionResult::AI_FAILURE;
+            Column* column = GetColumn(columnIdx);
 
-            Column& column = GetColumn(columnIdx);
+            if (!column)
+                return app::ConversionResult::AI_FAILURE;
 
-            return column.ReadToBuffer(reader, dataBuf);
+            return column->ReadToBuffer(reader, dataBuf);
         }
 
         bool Row::MoveToNext()
         {
-            int32_t lastColumnIdx = GetSize();
-
-            if (!EnsureColumnDiscovered(lastColumnIdx))
+            if (rowIdx + 1 >= page.GetIndexedRowsNum())
                 return false;
 
-            Column& lastColumn = GetColumn(lastColumnIdx);
-
-            stream.Position(lastColumn.GetEndPosition());
+            ++rowIdx;
 
             Reinit();
 
@@ -100,15 +84,15 @@ namespace ignite
 
         void Row::Reinit()
         {
-            size = stream.ReadInt32();
-
-            rowBeginPos = stream.Position();
+            size = page.GetRowSize(rowIdx);
 
-            columns.clear();
-
-            columns.reserve(size);
-
-            pos = 0;
+            // Slots are not reset: columns accessed within the previous rows
+            // are told apart by the row index.
+            if (columns.size() <= static_cast<size_t>(size))
+            {
+                columns.resize(size + 1);
+                columnRows.resize(size + 1, -1);
+            }
         }
     }
 }
@@ -51,7 +51,9 @@ namespace ignite
             columnBindOffset(0),
             rowArraySize(1),
             parameters(),
-            timeout(0)
+            timeout(0),
+            asyncEnabled(false),
+            asyncOperation()
         {
             // No-op.
         }
@@ -63,6 +65,9 @@ namespace ignite
 
         void Statement::BindColumn(uint16_t columnIdx, int16_t targetType, void* targetValue, SqlLen bufferLength, SqlLen* strLengthOrIndicator)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalBindColumn(columnIdx, targetType, targetValue, bufferLength, strLengthOrIndicator));
         }
 
@@ -125,7 +130,10 @@ namespace ignite
 
         int32_t Statement::GetColumnNumber()
         {
-            int32_t res;
+            int32_t res = 0;
+
+            if (!CheckNoAsyncOperation())
+                return res;
 
             IGNITE_ODBC_API_CALL(InternalGetColumnNumber(res));
 
@@ -147,6 +155,9 @@ namespace ignite
         void Statement::BindParameter(uint16_t paramIdx, int16_t ioType, int16_t bufferType, int16_t paramSqlType,
             SqlUlen columnSize, int16_t decDigits, void* buffer, SqlLen bufferLen, SqlLen* resLen)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalBindParameter(paramIdx, ioType, bufferType, paramSqlType, columnSize,
                 decDigits, buffer, bufferLen, resLen));
         }
@@ -221,6 +232,9 @@ namespace ignite
 
         void Statement::SetAttribute(int attr, void* value, SQLINTEGER valueLen)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalSetAttribute(attr, value, valueLen));
         }
 
@@ -335,6 +349,23 @@ namespace ignite
                     break;
                 }
 
+                case SQL_ATTR_ASYNC_ENABLE:
+                {
+                    SqlUlen val = reinterpret_cast<SqlUlen>(value);
+
+                    if (val != SQL_ASYNC_ENABLE_ON && val != SQL_ASYNC_ENABLE_OFF)
+                    {
+                        AddStatusRecord(SqlState::SHY024_INVALID_ATTRIBUTE_VALUE,
+                            "Invalid value for asynchronous execution mode");
+
+                        return SqlResult::AI_ERROR;
+                    }
+
+                    asyncEnabled = val == SQL_ASYNC_ENABLE_ON;
+
+                    break;
+                }
+
                 case SQL_ATTR_QUERY_TIMEOUT:
                 {
                     SqlUlen uTimeout = reinterpret_cast<SqlUlen>(value);
@@ -372,6 +403,9 @@ namespace ignite
 
         void Statement::GetAttribute(int attr, void* buf, SQLINTEGER bufLen, SQLINTEGER* valueLen)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalGetAttribute(attr, buf, bufLen, valueLen));
         }
 
@@ -410,6 +444,15 @@ namespace ignite
                     break;
                 }
 
+                case SQL_ATTR_ASYNC_ENABLE:
+                {
+                    SqlUlen* val = reinterpret_cast<SqlUlen*>(buf);
+
+                    *val = asyncEnabled ? SQL_ASYNC_ENABLE_ON : SQL_ASYNC_ENABLE_OFF;
+
+                    break;
+                }
+
                 case SQL_ATTR_ROW_ARRAY_SIZE:
                 {
                     SQLINTEGER *val = reinterpret_cast<SQLINTEGER*>(buf);
@@ -538,6 +581,9 @@ namespace ignite
 
         void Statement::GetParametersNumber(uint16_t& paramNum)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalGetParametersNumber(paramNum));
         }
 
@@ -579,6 +625,9 @@ namespace ignite
 
         void Statement::GetColumnData(uint16_t columnIdx, app::ApplicationDataBuffer& buffer)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalGetColumnData(columnIdx, buffer));
         }
 
@@ -600,6 +649,9 @@ namespace ignite
 
         void Statement::PrepareSqlQuery(const std::string& query)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalPrepareSqlQuery(query));
         }
 
@@ -662,6 +714,20 @@ namespace ignite
 
         void Statement::ExecuteSqlQuery(const std::string& query)
         {
+            if (IsAsyncCall())
+            {
+                AsyncOperation* op = PrepareAsyncCall(AsyncFunction::EXECUTE_DIRECT);
+
+                if (op)
+                {
+                    op->SetQuery(query);
+
+                    StartAsyncCall();
+                }
+
+                return;
+            }
+
             IGNITE_ODBC_API_CALL(InternalExecuteSqlQuery(query));
         }
 
@@ -677,6 +743,14 @@ namespace ignite
 
         void Statement::ExecuteSqlQuery()
         {
+            if (IsAsyncCall())
+            {
+                if (PrepareAsyncCall(AsyncFunction::EXECUTE))
+                    StartAsyncCall();
+
+                return;
+            }
+
             IGNITE_ODBC_API_CALL(InternalExecuteSqlQuery());
         }
 
@@ -774,6 +848,9 @@ namespace ignite
         void Statement::ExecuteGetColumnsMetaQuery(const std::string& schema,
             const std::string& table, const std::string& column)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteGetColumnsMetaQuery(schema, table, column));
         }
 
@@ -797,6 +874,9 @@ namespace ignite
         void Statement::ExecuteGetTablesMetaQuery(const std::string& catalog,
             const std::string& schema, const std::string& table, const std::string& tableType)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteGetTablesMetaQuery(
                 catalog, schema, table, tableType));
         }
@@ -818,6 +898,9 @@ namespace ignite
             const std::string& foreignCatalog, const std::string& foreignSchema,
             const std::string& foreignTable)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteGetForeignKeysQuery(primaryCatalog,
                 primarySchema, primaryTable, foreignCatalog, foreignSchema, foreignTable));
         }
@@ -839,6 +922,9 @@ namespace ignite
         void Statement::ExecuteGetPrimaryKeysQuery(const std::string& catalog,
             const std::string& schema, const std::string& table)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteGetPrimaryKeysQuery(catalog, schema, table));
         }
 
@@ -858,6 +944,9 @@ namespace ignite
             const std::string& catalog, const std::string& schema,
             const std::string& table, int16_t scope, int16_t nullable)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteSpecialColumnsQuery(type,
                 catalog, schema, table, scope, nullable));
         }
@@ -885,6 +974,9 @@ namespace ignite
 
         void Statement::ExecuteGetTypeInfoQuery(int16_t sqlType)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalExecuteGetTypeInfoQuery(sqlType));
         }
 
@@ -910,6 +1002,9 @@ namespace ignite
 
         void Statement::FreeResources(int16_t option)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalFreeResources(option));
         }
 
@@ -954,6 +1049,9 @@ namespace ignite
 
         void Statement::Close()
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalClose());
         }
 
@@ -981,6 +1079,20 @@ namespace ignite
 
         void Statement::FetchScroll(int16_t orientation, int64_t offset)
         {
+            if (IsAsyncCall() && !IsFetchLocal())
+            {
+                AsyncOperation* op = PrepareAsyncCall(AsyncFunction::FETCH_SCROLL);
+
+                if (op)
+                {
+                    op->SetFetchOrientation(orientation, offset);
+
+                    StartAsyncCall();
+                }
+
+                return;
+            }
+
             IGNITE_ODBC_API_CALL(InternalFetchScroll(orientation, offset));
         }
 
@@ -1001,6 +1113,14 @@ namespace ignite
 
         void Statement::FetchRow()
         {
+            if (IsAsyncCall() && !IsFetchLocal())
+            {
+                if (PrepareAsyncCall(AsyncFunction::FETCH))
+                    StartAsyncCall();
+
+                return;
+            }
+
             IGNITE_ODBC_API_CALL(InternalFetchRow());
         }
 
@@ -1067,8 +1187,154 @@ namespace ignite
             return currentQuery.get() && currentQuery->DataAvailable();
         }
 
+        void Statement::AddStatusRecord(const diagnostic::DiagnosticRecord& rec)
+        {
+            if (asyncOperation.get())
+            {
+                asyncOperation->AddStatusRecord(rec);
+
+                return;
+            }
+
+            diagnostic::DiagnosableAdapter::AddStatusRecord(rec);
+        }
+
+        void Statement::Cancel()
+        {
+            if (asyncOperation.get() && !asyncOperation->IsCanceled())
+            {
+                LOG_MSG("Canceling async operation: " << asyncOperation->GetFunction());
+
+                asyncOperation->Cancel();
+
+                diagnosticRecords.SetHeaderRecord(SqlResult::AI_SUCCESS);
+
+                return;
+            }
+
+            IGNITE_ODBC_API_CALL_ALWAYS_SUCCESS;
+        }
+
+        bool Statement::CheckNoAsyncOperation()
+        {
+            if (!asyncOperation.get())
+                return true;
+
+            diagnosticRecords.Reset();
+
+            // Records added with AddStatusRecord() would go to the running
+            // operation, so the statement storage is filled directly.
+            diagnosticRecords.AddStatusRecord(Connection::CreateStatusRecord(
+                SqlState::SHY010_SEQUENCE_ERROR, "Asynchronous operation is still executing"));
+
+            diagnosticRecords.SetHeaderRecord(SqlResult::AI_ERROR);
+
+            return false;
+        }
+
+        AsyncOperation* Statement::PrepareAsyncCall(AsyncFunction::Type function)
+        {
+            if (asyncOperation.get())
+            {
+                diagnosticRecords.Reset();
+
+                // Records added here would go to the running operation, so
+                // the statement storage is filled directly.
+                if (asyncOperation->GetFunction() != function)
+                {
+                    diagnosticRecords.AddStatusRecord(Connection::CreateStatusRecord(
+                        SqlState::SHY010_SEQUENCE_ERROR, "Another function is executed asynchronously"));
+
+                    diagnosticRecords.SetHeaderRecord(SqlResult::AI_ERROR);
+
+                    return 0;
+                }
+
+                if (!asyncOperation->IsCompleted())
+                {
+                    diagnosticRecords.SetHeaderRecord(SqlResult::AI_STILL_EXECUTING);
+
+                    return 0;
+                }
+
+                SqlResult::Type result = asyncOperation->Wait();
+                bool canceled = asyncOperation->IsCanceled();
+
+                if (!canceled)
+                {
+                    const diagnostic::DiagnosticRecordStorage& records = asyncOperation->GetDiagnosticRecords();
+
+                    for (int32_t i = 1; i <= records.GetStatusRecordsNumber(); ++i)
+                        diagnosticRecords.AddStatusRecord(records.GetStatusRecord(i));
+                }
+
+                asyncOperation.reset();
+
+                if (canceled)
+                {
+                    if (function == AsyncFunction::EXECUTE_DIRECT || function == AsyncFunction::EXECUTE)
+                        InternalClose();
+
+                    diagnosticRecords.Reset();
+
+                    AddStatusRecord(SqlState::SHY008_OPERATION_CANCELED, "Operation canceled");
+
+                    diagnosticRecords.SetHeaderRecord(SqlResult::AI_ERROR);
+
+                    return 0;
+                }
+
+                diagnosticRecords.SetHeaderRecord(result);
+
+                return 0;
+            }
+
+            asyncOperation.reset(new AsyncOperation(*this, function));
+
+            return asyncOperation.get();
+        }
+
+        void Statement::StartAsyncCall()
+        {
+            diagnosticRecords.Reset();
+            diagnosticRecords.SetHeaderRecord(SqlResult::AI_STILL_EXECUTING);
+
+            LOG_MSG("Starting async operation: " << asyncOperation->GetFunction());
+
+            asyncOperation->Start0();
+        }
+
+        SqlResult::Type Statement::InternalCallAsyncFunction(const AsyncOperation& op)
+        {
+            switch (op.GetFunction())
+            {
+                case AsyncFunction::EXECUTE_DIRECT:
+                    return InternalExecuteSqlQuery(op.GetQuery());
+
+                case AsyncFunction::EXECUTE:
+                    return InternalExecuteSqlQuery();
+
+                case AsyncFunction::FETCH:
+                    return InternalFetchRow();
+
+                case AsyncFunction::FETCH_SCROLL:
+                    return InternalFetchScroll(op.GetFetchOrientation(), op.GetFetchOffset());
+
+                default:
+                    break;
+            }
+
+            AddStatusRecord(SqlState::SHYC00_OPTIONAL_FEATURE_NOT_IMPLEMENTED,
+                "Function can not be executed asynchronously");
+
+            return SqlResult::AI_ERROR;
+        }
+
         void Statement::MoreResults()
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalMoreResults());
         }
 
@@ -1087,6 +1353,9 @@ namespace ignite
         void Statement::GetColumnAttribute(uint16_t colIdx, uint16_t attrId,
             char* strbuf, int16_t buflen, int16_t* reslen, SqlLen* numbuf)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalGetColumnAttribute(colIdx, attrId,
                 strbuf, buflen, reslen, numbuf));
         }
@@ -1146,6 +1415,9 @@ namespace ignite
         {
             int64_t rowCnt = 0;
 
+            if (!CheckNoAsyncOperation())
+                return rowCnt;
+
             IGNITE_ODBC_API_CALL(InternalAffectedRows(rowCnt));
 
             return rowCnt;
@@ -1187,6 +1459,9 @@ namespace ignite
 
         void Statement::SelectParam(void** paramPtr)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalSelectParam(paramPtr));
         }
 
@@ -1237,6 +1512,9 @@ namespace ignite
 
         void Statement::PutData(void* data, SqlLen len)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalPutData(data, len));
         }
 
@@ -1277,6 +1555,9 @@ namespace ignite
         void Statement::DescribeParam(int16_t paramNum, int16_t* dataType,
             SqlUlen* paramSize, int16_t* decimalDigits, int16_t* nullable)
         {
+            if (!CheckNoAsyncOperation())
+                return;
+
             IGNITE_ODBC_API_CALL(InternalDescribeParam(paramNum,
                 dataType, paramSize, decimalDigits, nullable));
         }